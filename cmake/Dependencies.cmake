@@ -263,4 +263,7 @@ function(setup_project_dependencies)
         "external/spdlog-1.15.3"
         STATIC  # Recommend static linking to avoid runtime dependencies
     )
+
+    # System threads (the audio thread)
+    find_package(Threads REQUIRED)
 endfunction()
@@ -0,0 +1,87 @@
+# Optimization profiles: link-time optimization, profile-guided optimization and
+# target architecture. Everything is off by default; CMakePresets.json combines them
+# into named profiles (release-lto, release-x86-64-v3, pgo-generate/pgo-use, ...).
+
+include(CheckIPOSupported)
+
+option(SIMULACRUM_ENABLE_LTO "Enable link-time optimization (IPO)" OFF)
+
+# Profile-guided optimization runs in two builds sharing one build directory:
+#   GENERATE = instrumented build; running it writes profile data to SIMULACRUM_PGO_DIR
+#   USE      = optimized build using that profile data
+set(SIMULACRUM_PGO "OFF" CACHE STRING "Profile-guided optimization stage: OFF, GENERATE or USE")
+set_property(CACHE SIMULACRUM_PGO PROPERTY STRINGS OFF GENERATE USE)
+set(SIMULACRUM_PGO_DIR "${CMAKE_BINARY_DIR}/pgo-data" CACHE PATH "Directory for profile-guided optimization data")
+
+# Target architecture, e.g. "x86-64-v3" or "native". Empty keeps the compiler's baseline,
+# which is what shipped binaries should use: the engine dispatches wider SIMD at runtime.
+set(SIMULACRUM_ARCH "" CACHE STRING "Target architecture (-march); empty for the compiler default")
+
+function(setup_optimization_options TARGET_NAME)
+    # --- Link-time optimization ---
+    if(SIMULACRUM_ENABLE_LTO)
+        check_ipo_supported(RESULT IPO_SUPPORTED OUTPUT IPO_ERROR LANGUAGES CXX)
+        if(IPO_SUPPORTED)
+            set_property(TARGET ${TARGET_NAME} PROPERTY INTERPROCEDURAL_OPTIMIZATION TRUE)
+        else()
+            message(WARNING "Link-time optimization is not supported: ${IPO_ERROR}")
+        endif()
+    endif()
+
+    # --- Target architecture ---
+    if(SIMULACRUM_ARCH)
+        if(MSVC)
+            # MSVC has no -march; x86-64-v3 (and native, as the closest match) map to AVX2
+            if(SIMULACRUM_ARCH STREQUAL "x86-64-v3" OR SIMULACRUM_ARCH STREQUAL "native")
+                target_compile_options(${TARGET_NAME} PRIVATE /arch:AVX2)
+            elseif(SIMULACRUM_ARCH STREQUAL "x86-64-v4")
+                target_compile_options(${TARGET_NAME} PRIVATE /arch:AVX512)
+            else()
+                message(WARNING "SIMULACRUM_ARCH '${SIMULACRUM_ARCH}' is not supported by MSVC; ignoring it.")
+            endif()
+        else()
+            target_compile_options(${TARGET_NAME} PRIVATE -march=${SIMULACRUM_ARCH})
+        endif()
+    endif()
+
+    # --- Profile-guided optimization ---
+    if(SIMULACRUM_PGO STREQUAL "GENERATE")
+        file(MAKE_DIRECTORY ${SIMULACRUM_PGO_DIR})
+
+        if(CMAKE_CXX_COMPILER_ID STREQUAL "GNU")
+            # Atomic counter updates keep the audio and loader threads' profiles intact
+            target_compile_options(${TARGET_NAME} PRIVATE -fprofile-generate=${SIMULACRUM_PGO_DIR} -fprofile-update=atomic)
+            target_link_options(${TARGET_NAME} PRIVATE -fprofile-generate=${SIMULACRUM_PGO_DIR})
+        elseif(CMAKE_CXX_COMPILER_ID MATCHES "Clang")
+            target_compile_options(${TARGET_NAME} PRIVATE -fprofile-instr-generate=${SIMULACRUM_PGO_DIR}/%m-%p.profraw)
+            target_link_options(${TARGET_NAME} PRIVATE -fprofile-instr-generate=${SIMULACRUM_PGO_DIR}/%m-%p.profraw)
+        elseif(MSVC)
+            target_compile_options(${TARGET_NAME} PRIVATE /GL)
+            target_link_options(${TARGET_NAME} PRIVATE /LTCG /GENPROFILE:PGD=${SIMULACRUM_PGO_DIR}/${TARGET_NAME}.pgd)
+        endif()
+
+    elseif(SIMULACRUM_PGO STREQUAL "USE")
+        if(CMAKE_CXX_COMPILER_ID STREQUAL "GNU")
+            # Code the training run never reached keeps its normal optimization
+            target_compile_options(${TARGET_NAME} PRIVATE
+                -fprofile-use=${SIMULACRUM_PGO_DIR}
+                -fprofile-partial-training
+                -Wno-missing-profile
+            )
+            target_link_options(${TARGET_NAME} PRIVATE -fprofile-use=${SIMULACRUM_PGO_DIR})
+        elseif(CMAKE_CXX_COMPILER_ID MATCHES "Clang")
+            # The .profraw files are merged by cmake/scripts/CompareProfiles.cmake (llvm-profdata)
+            target_compile_options(${TARGET_NAME} PRIVATE
+                -fprofile-instr-use=${SIMULACRUM_PGO_DIR}/simulacrum.profdata
+                -Wno-profile-instr-unprofiled
+            )
+            target_link_options(${TARGET_NAME} PRIVATE -fprofile-instr-use=${SIMULACRUM_PGO_DIR}/simulacrum.profdata)
+        elseif(MSVC)
+            target_compile_options(${TARGET_NAME} PRIVATE /GL)
+            target_link_options(${TARGET_NAME} PRIVATE /LTCG /USEPROFILE:PGD=${SIMULACRUM_PGO_DIR}/${TARGET_NAME}.pgd)
+        endif()
+
+    elseif(NOT SIMULACRUM_PGO STREQUAL "OFF")
+        message(FATAL_ERROR "SIMULACRUM_PGO must be OFF, GENERATE or USE (got '${SIMULACRUM_PGO}').")
+    endif()
+endfunction()
@@ -24,6 +24,9 @@ function(print_project_info TARGET_NAME)
         message(STATUS "  Default linking for dependency libraries: Statically linked (Static)")
     endif()
 
+    message(STATUS "  Engine library: unity build ${SIMULACRUM_UNITY_BUILD}, precompiled headers ${SIMULACRUM_ENGINE_PCH}")
+    message(STATUS "  Optimization: LTO ${SIMULACRUM_ENABLE_LTO}, PGO ${SIMULACRUM_PGO}, arch '${SIMULACRUM_ARCH}'")
+
     if(WIN32)
         message(STATUS "  Runtime library handling: Automatically detects and copies all DLLs to the exe directory")
         if(MSVC)
@@ -0,0 +1,155 @@
+# Builds simulacrum_bench with several optimization profiles, runs the same fixed
+# workload with each and prints the frame times side by side.
+#
+# Usage (from the project root):
+#   cmake -P cmake/scripts/CompareProfiles.cmake
+#   cmake -DPROFILES="release;pgo" -DFRAMES=1200 -DSCENARIOS="title_scene" -P cmake/scripts/CompareProfiles.cmake
+#
+# PROFILES are configure presets from CMakePresets.json, plus "pgo", which stands for
+# the pgo-generate build, a training run of the same workload and the pgo-use build.
+# The first profile is the baseline. Each profile's bench results are kept in
+# build/profile-comparison/<profile>.json.
+
+if(NOT DEFINED PROFILES)
+    set(PROFILES release release-lto release-x86-64-v3 pgo)
+endif()
+
+if(NOT DEFINED FRAMES)
+    set(FRAMES 600)
+endif()
+
+if(NOT DEFINED SCENARIOS)
+    set(SCENARIOS title_scene sprites ui_buttons texture_budget audio_mixer)
+endif()
+
+get_filename_component(SOURCE_DIR "${CMAKE_CURRENT_LIST_DIR}/../.." ABSOLUTE)
+set(RESULTS_DIR ${SOURCE_DIR}/build/profile-comparison)
+file(MAKE_DIRECTORY ${RESULTS_DIR})
+
+if(WIN32)
+    set(EXE_SUFFIX ".exe")
+else()
+    set(EXE_SUFFIX "")
+endif()
+
+function(build_preset PRESET)
+    message(STATUS "Building simulacrum_bench (${PRESET})...")
+    execute_process(COMMAND ${CMAKE_COMMAND} --preset ${PRESET}
+        WORKING_DIRECTORY ${SOURCE_DIR} OUTPUT_QUIET COMMAND_ERROR_IS_FATAL ANY)
+    execute_process(COMMAND ${CMAKE_COMMAND} --build --preset ${PRESET} --target simulacrum_bench
+        WORKING_DIRECTORY ${SOURCE_DIR} OUTPUT_QUIET COMMAND_ERROR_IS_FATAL ANY)
+endfunction()
+
+# Run the bench of a build directory on the fixed workload, writing its JSON to OUTPUT
+function(run_bench BUILD_DIR OUTPUT)
+    # Single-configuration generators put the executable in the build directory itself
+    set(BENCH ${BUILD_DIR}/simulacrum_bench${EXE_SUFFIX})
+    if(NOT EXISTS ${BENCH})
+        set(BENCH ${BUILD_DIR}/Release/simulacrum_bench${EXE_SUFFIX})
+    endif()
+
+    set(ARGS --frames ${FRAMES} --output ${OUTPUT})
+    foreach(SCENARIO IN LISTS SCENARIOS)
+        list(APPEND ARGS --scenario ${SCENARIO})
+    endforeach()
+
+    get_filename_component(BENCH_DIR ${BENCH} DIRECTORY)
+    execute_process(COMMAND ${BENCH} ${ARGS} WORKING_DIRECTORY ${BENCH_DIR} COMMAND_ERROR_IS_FATAL ANY)
+endfunction()
+
+# "123.456" (microseconds) -> 123456 (nanoseconds), since CMake math is integer-only
+function(us_to_ns VALUE OUT)
+    string(REGEX MATCH "^([0-9]+)\\.?([0-9]*)" _ "${VALUE}")
+    set(FRACTION "${CMAKE_MATCH_2}000")
+    string(SUBSTRING "${FRACTION}" 0 3 FRACTION)
+    math(EXPR NS "${CMAKE_MATCH_1} * 1000 + 1${FRACTION} - 1000")
+    set(${OUT} ${NS} PARENT_SCOPE)
+endfunction()
+
+# --- Build and run every profile ---
+
+foreach(PROFILE IN LISTS PROFILES)
+    if(PROFILE STREQUAL "pgo")
+        # Stale counters from an older build would be rejected or skew the profile
+        file(REMOVE_RECURSE ${SOURCE_DIR}/build/pgo-data)
+
+        build_preset(pgo-generate)
+        message(STATUS "Recording the PGO training profile...")
+        run_bench(${SOURCE_DIR}/build/pgo ${RESULTS_DIR}/pgo-training.json)
+
+        # Clang writes raw profiles that must be merged before use
+        file(GLOB RAW_PROFILES ${SOURCE_DIR}/build/pgo-data/*.profraw)
+        if(RAW_PROFILES)
+            find_program(LLVM_PROFDATA NAMES llvm-profdata REQUIRED)
+            execute_process(
+                COMMAND ${LLVM_PROFDATA} merge -output=${SOURCE_DIR}/build/pgo-data/simulacrum.profdata ${RAW_PROFILES}
+                COMMAND_ERROR_IS_FATAL ANY
+            )
+        endif()
+
+        build_preset(pgo-use)
+        set(BUILD_DIR ${SOURCE_DIR}/build/pgo)
+    else()
+        build_preset(${PROFILE})
+        set(BUILD_DIR ${SOURCE_DIR}/build/${PROFILE})
+    endif()
+
+    message(STATUS "Running the workload (${PROFILE})...")
+    run_bench(${BUILD_DIR} ${RESULTS_DIR}/${PROFILE}.json)
+endforeach()
+
+# --- Report ---
+
+list(GET PROFILES 0 BASELINE)
+message(STATUS "")
+message(STATUS "Mean / p95 frame time in microseconds over ${FRAMES} frames (vs ${BASELINE}):")
+
+foreach(SCENARIO IN LISTS SCENARIOS)
+    message(STATUS "  ${SCENARIO}")
+    unset(BASELINE_NS)
+
+    foreach(PROFILE IN LISTS PROFILES)
+        file(READ ${RESULTS_DIR}/${PROFILE}.json REPORT)
+        string(JSON COUNT LENGTH "${REPORT}" scenarios)
+        math(EXPR LAST "${COUNT} - 1")
+
+        foreach(INDEX RANGE ${LAST})
+            string(JSON NAME GET "${REPORT}" scenarios ${INDEX} name)
+            if(NOT NAME STREQUAL SCENARIO)
+                continue()
+            endif()
+
+            string(JSON MEAN GET "${REPORT}" scenarios ${INDEX} frame mean_us)
+            string(JSON P95 GET "${REPORT}" scenarios ${INDEX} frame p95_us)
+            us_to_ns(${MEAN} MEAN_NS)
+
+            if(NOT DEFINED BASELINE_NS)
+                set(BASELINE_NS ${MEAN_NS})
+                set(DELTA "")
+            else()
+                # Positive when faster than the baseline, in tenths of a percent
+                math(EXPR PERMILLE "(${BASELINE_NS} - ${MEAN_NS}) * 1000 / ${BASELINE_NS}")
+                if(PERMILLE LESS 0)
+                    math(EXPR PERMILLE "-${PERMILLE}")
+                    set(SIGN "slower")
+                else()
+                    set(SIGN "faster")
+                endif()
+                math(EXPR WHOLE "${PERMILLE} / 10")
+                math(EXPR TENTHS "${PERMILLE} % 10")
+                set(DELTA "  ${WHOLE}.${TENTHS}% ${SIGN}")
+            endif()
+
+            math(EXPR MEAN_WHOLE "${MEAN_NS} / 1000")
+            us_to_ns(${P95} P95_NS)
+            math(EXPR P95_WHOLE "${P95_NS} / 1000")
+            string(LENGTH "${PROFILE}" PROFILE_LENGTH)
+            math(EXPR PADDING "20 - ${PROFILE_LENGTH}")
+            if(PADDING LESS 1)
+                set(PADDING 1)
+            endif()
+            string(REPEAT " " ${PADDING} PAD)
+            message(STATUS "    ${PROFILE}${PAD}${MEAN_WHOLE} / ${P95_WHOLE}${DELTA}")
+        endforeach()
+    endforeach()
+endforeach()
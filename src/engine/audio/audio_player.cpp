@@ -0,0 +1,426 @@
+#include "audio_player.hpp"
+#include "mixer.hpp"
+#include "../resource/asset_pack.hpp"
+#include <SDL3_mixer/SDL_mixer.h>
+#include <algorithm>
+#include <chrono>
+#include <spdlog/spdlog.h>
+#include <stdexcept>
+
+namespace engine::audio {
+
+    namespace {
+
+        using Clock = std::chrono::steady_clock;
+
+        std::uint64_t elapsedNs(Clock::time_point start) {
+            return static_cast<std::uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count()
+            );
+        }
+
+        int toMixVolume(float volume) {
+            return static_cast<int>(std::clamp(volume, 0.0f, 1.0f) * MIX_MAX_VOLUME);
+        }
+
+    } // namespace
+
+    void AudioPlayer::MixChunkDeleter::operator()(Mix_Chunk* chunk) const {
+        if (chunk) {
+            Mix_FreeChunk(chunk);
+        }
+    }
+
+    void AudioPlayer::MixMusicDeleter::operator()(Mix_Music* music) const {
+        if (music) {
+            Mix_FreeMusic(music);
+        }
+    }
+
+    AudioPlayer::AudioPlayer(
+        const engine::resource::AssetLocator& asset_locator,
+        float music_volume,
+        float sound_volume,
+        int voice_count,
+        bool software_mixer
+    )
+        : asset_locator_(asset_locator)
+        , sound_volume_(sound_volume)
+    {
+        if (voice_count <= 0) {
+            throw std::runtime_error("AudioPlayer initialization failed: voice count must be positive.");
+        }
+
+        // The audio thread is not running yet, so the mixer can still be set up from here
+        int allocated = Mix_AllocateChannels(voice_count);
+        if (allocated != voice_count) {
+            throw std::runtime_error("AudioPlayer initialization failed: unable to allocate mixer channels.");
+        }
+        voices_.resize(static_cast<std::size_t>(voice_count));
+        Mix_VolumeMusic(toMixVolume(music_volume));
+
+        if (software_mixer) {
+            mixer_ = std::make_unique<Mixer>(48000, static_cast<std::uint32_t>(voice_count));
+            if (!mixer_->open()) {
+                spdlog::warn("Software mixer unavailable, sound effects fall back to SDL_mixer.");
+                mixer_.reset();
+            }
+        }
+
+        running_.store(true, std::memory_order_relaxed);
+        thread_ = std::thread(&AudioPlayer::run, this);
+        spdlog::trace("AudioPlayer started with {} {} voices.", voice_count, mixer_ ? "software mixer" : "SDL_mixer");
+    }
+
+    AudioPlayer::~AudioPlayer() {
+        close();
+    }
+
+    void AudioPlayer::close() {
+        if (!thread_.joinable()) {
+            return;
+        }
+
+        running_.store(false, std::memory_order_release);
+        wake_.store(true, std::memory_order_release);
+        wake_.notify_one();
+        thread_.join();
+
+        // The audio thread has exited, so its assets can be released from here
+        Mix_HaltChannel(-1);
+        Mix_HaltMusic();
+        if (mixer_) {
+            mixer_->close();
+        }
+        buffers_.clear();
+        sounds_.clear();
+        music_.clear();
+        spdlog::trace("AudioPlayer stopped.");
+    }
+
+    // --- Game thread ---
+
+    void AudioPlayer::playSound(std::string_view file_path, int priority, float volume, int max_instances) {
+        Command command;
+        command.type = CommandType::PLAY_SOUND;
+        command.asset = internAsset(file_path, command.path);
+        command.priority = priority;
+        command.volume = volume;
+        command.max_instances = max_instances;
+        post(command);
+    }
+
+    void AudioPlayer::preloadSound(std::string_view file_path) {
+        Command command;
+        command.type = CommandType::PRELOAD_SOUND;
+        command.asset = internAsset(file_path, command.path);
+        post(command);
+    }
+
+    void AudioPlayer::playMusic(std::string_view file_path, int loops, int fade_in_ms) {
+        Command command;
+        command.type = CommandType::PLAY_MUSIC;
+        command.asset = internAsset(file_path, command.path);
+        command.loops = loops;
+        command.fade_ms = fade_in_ms;
+        post(command);
+    }
+
+    void AudioPlayer::stopMusic(int fade_out_ms) {
+        Command command;
+        command.type = CommandType::STOP_MUSIC;
+        command.fade_ms = fade_out_ms;
+        post(command);
+    }
+
+    void AudioPlayer::setMusicVolume(float volume) {
+        Command command;
+        command.type = CommandType::MUSIC_VOLUME;
+        command.volume = volume;
+        post(command);
+    }
+
+    void AudioPlayer::setSoundVolume(float volume) {
+        Command command;
+        command.type = CommandType::SOUND_VOLUME;
+        command.volume = volume;
+        post(command);
+    }
+
+    AudioPlayer::Stats AudioPlayer::getStats() const {
+        Stats stats;
+        stats.commands = command_count_.load(std::memory_order_relaxed);
+        stats.dropped_commands = dropped_commands_.load(std::memory_order_relaxed);
+        stats.sounds_played = sounds_played_.load(std::memory_order_relaxed);
+        stats.sounds_dropped = sounds_dropped_.load(std::memory_order_relaxed);
+        stats.voices_stolen = voices_stolen_.load(std::memory_order_relaxed);
+        stats.voices_recycled = voices_recycled_.load(std::memory_order_relaxed);
+        stats.peak_voices = peak_voices_.load(std::memory_order_relaxed);
+        stats.decode_ns = decode_ns_.load(std::memory_order_relaxed);
+        stats.busy_ns = busy_ns_.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+    std::uint32_t AudioPlayer::internAsset(std::string_view file_path, const std::string*& path) {
+        auto it = asset_ids_.find(file_path);
+        if (it == asset_ids_.end()) {
+            it = asset_ids_.emplace(std::string(file_path), static_cast<std::uint32_t>(paths_.size())).first;
+            paths_.emplace_back(file_path);
+        }
+
+        path = &paths_[it->second];
+        return it->second;
+    }
+
+    void AudioPlayer::post(Command command) {
+        if (!thread_.joinable()) {
+            return;
+        }
+
+        if (!commands_.tryPush(command)) {
+            dropped_commands_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        command_count_.fetch_add(1, std::memory_order_relaxed);
+        if (!wake_.exchange(true, std::memory_order_release)) {
+            wake_.notify_one();
+        }
+    }
+
+    // --- Audio thread ---
+
+    void AudioPlayer::run() {
+        while (true) {
+            wake_.wait(false, std::memory_order_acquire);
+            wake_.store(false, std::memory_order_relaxed);
+
+            if (!running_.load(std::memory_order_acquire)) {
+                break;
+            }
+
+            auto start = Clock::now();
+            while (auto command = commands_.tryPop()) {
+                execute(*command);
+            }
+            busy_ns_.fetch_add(elapsedNs(start), std::memory_order_relaxed);
+        }
+    }
+
+    void AudioPlayer::execute(const Command& command) {
+        switch (command.type) {
+            case CommandType::PRELOAD_SOUND:
+                resolveSound(command);
+                break;
+
+            case CommandType::PLAY_SOUND: {
+                Mix_Chunk* chunk = resolveSound(command);
+                if (!chunk) {
+                    break;
+                }
+
+                const SoundBuffer* buffer = mixer_ ? resolveBuffer(command, *chunk) : nullptr;
+                if (mixer_ && !buffer) {
+                    break;
+                }
+
+                int channel = acquireVoice(command);
+                if (channel < 0) {
+                    sounds_dropped_.fetch_add(1, std::memory_order_relaxed);
+                    break;
+                }
+
+                if (mixer_) {
+                    float gain = std::clamp(sound_volume_ * command.volume, 0.0f, 1.0f);
+                    mixer_->playOn(static_cast<std::uint32_t>(channel), buffer, gain);
+                    auto duration = std::chrono::duration<double>(
+                        static_cast<double>(buffer->frames) / mixer_->getSampleRate()
+                    );
+                    voices_[channel].ends_at = Clock::now() + std::chrono::duration_cast<Clock::duration>(duration);
+                    sounds_played_.fetch_add(1, std::memory_order_relaxed);
+                    break;
+                }
+
+                Mix_Volume(channel, toMixVolume(sound_volume_ * command.volume));
+                if (Mix_PlayChannel(channel, chunk, 0) < 0) {
+                    spdlog::warn("Playing sound '{}' failed: {}", *command.path, SDL_GetError());
+                    break;
+                }
+                sounds_played_.fetch_add(1, std::memory_order_relaxed);
+                break;
+            }
+
+            case CommandType::PLAY_MUSIC: {
+                Mix_Music* music = resolveMusic(command);
+                if (!music) {
+                    break;
+                }
+
+                bool started = command.fade_ms > 0
+                    ? Mix_FadeInMusic(music, command.loops, command.fade_ms)
+                    : Mix_PlayMusic(music, command.loops);
+                if (!started) {
+                    spdlog::warn("Playing music '{}' failed: {}", *command.path, SDL_GetError());
+                }
+                break;
+            }
+
+            case CommandType::STOP_MUSIC:
+                if (command.fade_ms > 0) {
+                    Mix_FadeOutMusic(command.fade_ms);
+                } else {
+                    Mix_HaltMusic();
+                }
+                break;
+
+            case CommandType::MUSIC_VOLUME:
+                Mix_VolumeMusic(toMixVolume(command.volume));
+                break;
+
+            case CommandType::SOUND_VOLUME:
+                sound_volume_ = command.volume;
+                break;
+        }
+    }
+
+    Mix_Chunk* AudioPlayer::resolveSound(const Command& command) {
+        if (command.asset >= sounds_.size()) {
+            sounds_.resize(command.asset + 1);
+        }
+
+        auto& slot = sounds_[command.asset];
+        if (slot) {
+            return slot.get();
+        }
+
+        auto start = Clock::now();
+        Mix_Chunk* chunk = nullptr;
+        if (SDL_IOStream* stream = asset_locator_.openStream(*command.path)) {
+            chunk = Mix_LoadWAV_IO(stream, true);
+        } else {
+            chunk = Mix_LoadWAV(command.path->c_str());
+        }
+        decode_ns_.fetch_add(elapsedNs(start), std::memory_order_relaxed);
+
+        if (!chunk) {
+            spdlog::error("Loading sound effect failed: '{}': {}.", *command.path, SDL_GetError());
+            return nullptr;
+        }
+
+        slot.reset(chunk);
+        spdlog::debug("Decoded sound effect on the audio thread: {}.", *command.path);
+        return chunk;
+    }
+
+    const SoundBuffer* AudioPlayer::resolveBuffer(const Command& command, const Mix_Chunk& chunk) {
+        if (command.asset >= buffers_.size()) {
+            buffers_.resize(command.asset + 1, nullptr);
+        }
+
+        auto& slot = buffers_[command.asset];
+        if (!slot) {
+            auto start = Clock::now();
+            slot = mixer_->createBuffer(chunk);
+            decode_ns_.fetch_add(elapsedNs(start), std::memory_order_relaxed);
+        }
+        return slot;
+    }
+
+    Mix_Music* AudioPlayer::resolveMusic(const Command& command) {
+        if (command.asset >= music_.size()) {
+            music_.resize(command.asset + 1);
+        }
+
+        auto& slot = music_[command.asset];
+        if (slot) {
+            return slot.get();
+        }
+
+        // Only the header is parsed here; the mixer decodes the stream as it plays
+        auto start = Clock::now();
+        Mix_Music* music = nullptr;
+        if (SDL_IOStream* stream = asset_locator_.openStream(*command.path)) {
+            music = Mix_LoadMUS_IO(stream, true);
+        } else {
+            music = Mix_LoadMUS(command.path->c_str());
+        }
+        decode_ns_.fetch_add(elapsedNs(start), std::memory_order_relaxed);
+
+        if (!music) {
+            spdlog::error("Loading music failed: '{}': {}.", *command.path, SDL_GetError());
+            return nullptr;
+        }
+
+        slot.reset(music);
+        spdlog::debug("Opened music stream on the audio thread: {}.", *command.path);
+        return music;
+    }
+
+    int AudioPlayer::acquireVoice(const Command& command) {
+        int free_voice = -1;
+        int victim = -1;
+        int oldest_instance = -1;
+        int instances = 0;
+        std::uint32_t busy = 0;
+        auto now = Clock::now();
+
+        for (int channel = 0; channel < static_cast<int>(voices_.size()); ++channel) {
+            bool playing = mixer_ ? now < voices_[channel].ends_at : Mix_Playing(channel) != 0;
+            if (!playing) {
+                if (free_voice < 0) {
+                    free_voice = channel;
+                }
+                continue;
+            }
+
+            ++busy;
+            const Voice& voice = voices_[channel];
+
+            if (voice.asset == command.asset) {
+                ++instances;
+                if (oldest_instance < 0 || voice.serial < voices_[oldest_instance].serial) {
+                    oldest_instance = channel;
+                }
+            }
+
+            // Lowest priority first, then the oldest sound
+            if (victim < 0 ||
+                voice.priority < voices_[victim].priority ||
+                (voice.priority == voices_[victim].priority && voice.serial < voices_[victim].serial)) {
+                victim = channel;
+            }
+        }
+
+        int channel = -1;
+        if (command.max_instances > 0 && instances >= command.max_instances) {
+            // Restart the oldest instance rather than layering yet another copy
+            channel = oldest_instance;
+            haltVoice(channel);
+            voices_recycled_.fetch_add(1, std::memory_order_relaxed);
+        } else if (free_voice >= 0) {
+            channel = free_voice;
+            ++busy;
+        } else if (victim >= 0 && voices_[victim].priority <= command.priority) {
+            channel = victim;
+            haltVoice(channel);
+            voices_stolen_.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            return -1;
+        }
+
+        if (busy > peak_voices_.load(std::memory_order_relaxed)) {
+            peak_voices_.store(busy, std::memory_order_relaxed);
+        }
+
+        voices_[channel] = {command.asset, command.priority, next_serial_++};
+        return channel;
+    }
+
+    void AudioPlayer::haltVoice(int channel) {
+        // A mixer voice is replaced in place by the next playOn() on its slot
+        if (!mixer_) {
+            Mix_HaltChannel(channel);
+        }
+    }
+
+} // namespace engine::audio
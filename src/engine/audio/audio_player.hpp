@@ -0,0 +1,198 @@
+#ifndef AUDIO_PLAYER_HPP_
+#define AUDIO_PLAYER_HPP_
+
+#include "../utils/hash.hpp"
+#include "../utils/spsc_queue.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+struct Mix_Chunk;
+struct Mix_Music;
+
+namespace engine::resource {
+    class AssetLocator;
+}
+
+namespace engine::audio {
+
+    class Mixer;
+    struct SoundBuffer;
+
+    /// @brief Plays sound effects and music without blocking the game thread.
+    ///
+    /// Requests are posted to a lock-free queue and carried out by a dedicated audio
+    /// thread, which owns every decoded sound and open music stream and is the only
+    /// thread that touches the mixer. Music is opened there and then decoded
+    /// incrementally by the mixer in callback-sized chunks, so long tracks are never
+    /// decoded up front.
+    ///
+    /// Sound effects play on a fixed pool of voices. When every voice is busy, a new
+    /// sound steals the voice with the lowest priority (the oldest among equals),
+    /// provided that priority is not higher than its own; otherwise it is dropped.
+    /// A sound may also be capped to a number of simultaneous instances, in which case
+    /// reaching the cap recycles the oldest voice playing that same sound.
+    ///
+    /// With the software mixer enabled, sound effects are converted once to Mixer
+    /// buffers and each voice plays on the matching Mixer slot instead of an SDL_mixer
+    /// channel; music always stays on SDL_mixer. If the Mixer cannot open the device,
+    /// playback falls back to SDL_mixer channels.
+    ///
+    /// All public functions must be called from the game thread.
+    class AudioPlayer final {
+    public:
+        struct Stats {
+            std::uint64_t commands = 0;
+            /// @brief Requests rejected because the queue was full.
+            std::uint64_t dropped_commands = 0;
+            std::uint64_t sounds_played = 0;
+            /// @brief Sounds not played because every voice had a higher priority.
+            std::uint64_t sounds_dropped = 0;
+            std::uint64_t voices_stolen = 0;
+            /// @brief Voices recycled because a sound reached its instance cap.
+            std::uint64_t voices_recycled = 0;
+            /// @brief Most voices ever busy at once.
+            std::uint32_t peak_voices = 0;
+            /// @brief Time the audio thread spent loading and decoding.
+            std::uint64_t decode_ns = 0;
+            /// @brief Time the audio thread spent processing requests, decoding included.
+            std::uint64_t busy_ns = 0;
+        };
+
+        static constexpr int DEFAULT_VOICE_COUNT = 32;
+
+        AudioPlayer(
+            const engine::resource::AssetLocator& asset_locator,
+            float music_volume,
+            float sound_volume,
+            int voice_count = DEFAULT_VOICE_COUNT,
+            bool software_mixer = false
+        );
+        ~AudioPlayer();
+
+        AudioPlayer(const AudioPlayer&) = delete;
+        AudioPlayer& operator=(const AudioPlayer&) = delete;
+        AudioPlayer(AudioPlayer&&) = delete;
+        AudioPlayer& operator=(AudioPlayer&&) = delete;
+
+        /// @brief Play a sound effect, decoding it first if needed.
+        /// @param priority Higher priorities may steal voices from lower ones.
+        /// @param volume Scaled by the sound volume.
+        /// @param max_instances Instances of this sound allowed at once; 0 is unlimited.
+        void playSound(std::string_view file_path, int priority = 0, float volume = 1.0f, int max_instances = 0);
+
+        /// @brief Decode a sound effect ahead of its first playSound().
+        void preloadSound(std::string_view file_path);
+
+        /// @param loops -1 loops forever.
+        void playMusic(std::string_view file_path, int loops = -1, int fade_in_ms = 0);
+        void stopMusic(int fade_out_ms = 0);
+
+        void setMusicVolume(float volume);
+        void setSoundVolume(float volume);
+
+        /// @brief Stop all playback, join the audio thread and free every decoded asset.
+        void close();
+
+        /// @brief Whether sound effects play through the engine Mixer.
+        bool usesSoftwareMixer() const { return mixer_ != nullptr; }
+
+        Stats getStats() const;
+
+    private:
+        enum class CommandType : std::uint8_t {
+            PRELOAD_SOUND,
+            PLAY_SOUND,
+            PLAY_MUSIC,
+            STOP_MUSIC,
+            MUSIC_VOLUME,
+            SOUND_VOLUME,
+        };
+
+        struct Command {
+            CommandType type = CommandType::PLAY_SOUND;
+            std::uint32_t asset = 0;
+            /// @brief Path of `asset`; points into paths_, which never moves its strings.
+            const std::string* path = nullptr;
+            int priority = 0;
+            int max_instances = 0;
+            int loops = 0;
+            int fade_ms = 0;
+            float volume = 1.0f;
+        };
+
+        struct Voice {
+            std::uint32_t asset = 0;
+            int priority = 0;
+            std::uint64_t serial = 0;
+            /// @brief Mixer voices only: when the sound finishes, as the mixer cannot be queried.
+            std::chrono::steady_clock::time_point ends_at{};
+        };
+
+        struct MixChunkDeleter {
+            void operator()(Mix_Chunk* chunk) const;
+        };
+
+        struct MixMusicDeleter {
+            void operator()(Mix_Music* music) const;
+        };
+
+        static constexpr std::size_t QUEUE_CAPACITY = 256;
+
+        const engine::resource::AssetLocator& asset_locator_;
+
+        // --- Game thread ---
+        std::unordered_map<std::string, std::uint32_t, engine::utils::StringHash, std::equal_to<>> asset_ids_;
+        std::deque<std::string> paths_;
+
+        // --- Shared ---
+        engine::utils::SpscQueue<Command, QUEUE_CAPACITY> commands_;
+        std::atomic<bool> wake_{false};
+        std::atomic<bool> running_{false};
+        std::atomic<std::uint64_t> command_count_{0};
+        std::atomic<std::uint64_t> dropped_commands_{0};
+        std::atomic<std::uint64_t> sounds_played_{0};
+        std::atomic<std::uint64_t> sounds_dropped_{0};
+        std::atomic<std::uint64_t> voices_stolen_{0};
+        std::atomic<std::uint64_t> voices_recycled_{0};
+        std::atomic<std::uint32_t> peak_voices_{0};
+        std::atomic<std::uint64_t> decode_ns_{0};
+        std::atomic<std::uint64_t> busy_ns_{0};
+        std::thread thread_;
+
+        /// @brief Null unless the software mixer is enabled and open. Its buffers and voices
+        /// are only touched by the audio thread, which is therefore its single producer.
+        std::unique_ptr<Mixer> mixer_;
+
+        // --- Audio thread; indexed by asset id ---
+        std::vector<std::unique_ptr<Mix_Chunk, MixChunkDeleter>> sounds_;
+        /// @brief Mixer copies of sounds_, owned by mixer_.
+        std::vector<const SoundBuffer*> buffers_;
+        std::vector<std::unique_ptr<Mix_Music, MixMusicDeleter>> music_;
+        std::vector<Voice> voices_;
+        std::uint64_t next_serial_ = 0;
+        float sound_volume_ = 1.0f;
+
+        void post(Command command);
+        std::uint32_t internAsset(std::string_view file_path, const std::string*& path);
+
+        void run();
+        void execute(const Command& command);
+        Mix_Chunk* resolveSound(const Command& command);
+        const SoundBuffer* resolveBuffer(const Command& command, const Mix_Chunk& chunk);
+        Mix_Music* resolveMusic(const Command& command);
+        int acquireVoice(const Command& command);
+        void haltVoice(int channel);
+    };
+
+} // namespace engine::audio
+
+#endif // AUDIO_PLAYER_HPP_
@@ -0,0 +1,115 @@
+#include "mix_kernels.hpp"
+#include <SDL3/SDL_cpuinfo.h>
+#include <algorithm>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    #define ENGINE_MIX_X86 1
+    #include <immintrin.h>
+#endif
+
+// GCC and Clang only emit AVX for functions that ask for it; MSVC accepts the intrinsics anywhere
+#if defined(__GNUC__) || defined(__clang__)
+    #define ENGINE_TARGET_AVX __attribute__((target("avx")))
+#else
+    #define ENGINE_TARGET_AVX
+#endif
+
+namespace engine::audio {
+
+    namespace {
+
+        // --- Scalar ---
+
+        void mixStereoScalar(float* accumulator, const float* source, std::size_t frames, float gain_left, float gain_right) {
+            for (std::size_t i = 0; i < frames; ++i) {
+                accumulator[i * 2] += source[i * 2] * gain_left;
+                accumulator[i * 2 + 1] += source[i * 2 + 1] * gain_right;
+            }
+        }
+
+        void clampOutputScalar(float* output, const float* accumulator, std::size_t frames) {
+            for (std::size_t i = 0; i < frames * 2; ++i) {
+                output[i] = std::clamp(accumulator[i], -1.0f, 1.0f);
+            }
+        }
+
+#ifdef ENGINE_MIX_X86
+
+        // --- SSE2: two stereo frames per iteration ---
+
+        void mixStereoSse2(float* accumulator, const float* source, std::size_t frames, float gain_left, float gain_right) {
+            const __m128 gain = _mm_setr_ps(gain_left, gain_right, gain_left, gain_right);
+            std::size_t i = 0;
+            for (; i + 2 <= frames; i += 2) {
+                __m128 mixed = _mm_add_ps(_mm_loadu_ps(accumulator + i * 2), _mm_mul_ps(_mm_loadu_ps(source + i * 2), gain));
+                _mm_storeu_ps(accumulator + i * 2, mixed);
+            }
+            mixStereoScalar(accumulator + i * 2, source + i * 2, frames - i, gain_left, gain_right);
+        }
+
+        void clampOutputSse2(float* output, const float* accumulator, std::size_t frames) {
+            const __m128 low = _mm_set1_ps(-1.0f);
+            const __m128 high = _mm_set1_ps(1.0f);
+            std::size_t i = 0;
+            for (; i + 2 <= frames; i += 2) {
+                __m128 value = _mm_loadu_ps(accumulator + i * 2);
+                _mm_storeu_ps(output + i * 2, _mm_min_ps(_mm_max_ps(value, low), high));
+            }
+            clampOutputScalar(output + i * 2, accumulator + i * 2, frames - i);
+        }
+
+        // --- AVX: four stereo frames per iteration ---
+
+        ENGINE_TARGET_AVX
+        void mixStereoAvx(float* accumulator, const float* source, std::size_t frames, float gain_left, float gain_right) {
+            const __m256 gain = _mm256_setr_ps(
+                gain_left, gain_right, gain_left, gain_right,
+                gain_left, gain_right, gain_left, gain_right
+            );
+            std::size_t i = 0;
+            for (; i + 4 <= frames; i += 4) {
+                __m256 mixed = _mm256_add_ps(
+                    _mm256_loadu_ps(accumulator + i * 2),
+                    _mm256_mul_ps(_mm256_loadu_ps(source + i * 2), gain)
+                );
+                _mm256_storeu_ps(accumulator + i * 2, mixed);
+            }
+            mixStereoScalar(accumulator + i * 2, source + i * 2, frames - i, gain_left, gain_right);
+        }
+
+        ENGINE_TARGET_AVX
+        void clampOutputAvx(float* output, const float* accumulator, std::size_t frames) {
+            const __m256 low = _mm256_set1_ps(-1.0f);
+            const __m256 high = _mm256_set1_ps(1.0f);
+            std::size_t i = 0;
+            for (; i + 4 <= frames; i += 4) {
+                __m256 value = _mm256_loadu_ps(accumulator + i * 2);
+                _mm256_storeu_ps(output + i * 2, _mm256_min_ps(_mm256_max_ps(value, low), high));
+            }
+            clampOutputScalar(output + i * 2, accumulator + i * 2, frames - i);
+        }
+
+#endif // ENGINE_MIX_X86
+
+    } // namespace
+
+    MixKernels selectMixKernels(MixKernelSet requested) {
+#ifdef ENGINE_MIX_X86
+        bool want_avx = requested == MixKernelSet::AUTO || requested == MixKernelSet::AVX;
+        bool want_sse2 = want_avx || requested == MixKernelSet::SSE2;
+
+        if (want_avx && SDL_HasAVX()) {
+            return {mixStereoAvx, clampOutputAvx, "avx"};
+        }
+
+        if (want_sse2 && SDL_HasSSE2()) {
+            return {mixStereoSse2, clampOutputSse2, "sse2"};
+        }
+#else
+        (void)requested;
+#endif
+
+        return {mixStereoScalar, clampOutputScalar, "scalar"};
+    }
+
+} // namespace engine::audio
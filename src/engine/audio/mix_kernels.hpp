@@ -0,0 +1,32 @@
+#ifndef MIX_KERNELS_HPP_
+#define MIX_KERNELS_HPP_
+
+#include <cstddef>
+
+namespace engine::audio {
+
+    /// @brief Inner loops of the software mixer, in one implementation per instruction set.
+    ///
+    /// All buffers are interleaved stereo float32 and `frames` counts stereo frames.
+    /// selectMixKernels() picks the widest implementation the CPU supports at runtime.
+    struct MixKernels {
+        /// @brief accumulator[i] += source[i] * gain, with separate left/right gains.
+        void (*mix_stereo)(float* accumulator, const float* source, std::size_t frames, float gain_left, float gain_right);
+        /// @brief output[i] = clamp(accumulator[i], -1, 1).
+        void (*clamp_output)(float* output, const float* accumulator, std::size_t frames);
+        const char* name;
+    };
+
+    enum class MixKernelSet {
+        AUTO,
+        SCALAR,
+        SSE2,
+        AVX,
+    };
+
+    /// @brief Kernels for `requested`, falling back to narrower sets the CPU or build lacks.
+    MixKernels selectMixKernels(MixKernelSet requested = MixKernelSet::AUTO);
+
+} // namespace engine::audio
+
+#endif // MIX_KERNELS_HPP_
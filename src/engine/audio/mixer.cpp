@@ -0,0 +1,308 @@
+#include "mixer.hpp"
+#include <SDL3/SDL.h>
+#include <SDL3_mixer/SDL_mixer.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <numbers>
+#include <spdlog/spdlog.h>
+#include <stdexcept>
+
+namespace engine::audio {
+
+    namespace {
+
+        /// @brief Constant-power pan, so a voice keeps its loudness as it moves.
+        void panGains(float gain, float pan, float& left, float& right) {
+            float angle = (std::clamp(pan, -1.0f, 1.0f) + 1.0f) * std::numbers::pi_v<float> * 0.25f;
+            left = gain * std::cos(angle);
+            right = gain * std::sin(angle);
+        }
+
+    } // namespace
+
+    Mixer::Mixer(int sample_rate, std::uint32_t voice_capacity, MixKernelSet kernels)
+        : sample_rate_(sample_rate)
+        , kernels_(selectMixKernels(kernels))
+    {
+        if (sample_rate <= 0 || voice_capacity == 0) {
+            throw std::runtime_error("Mixer initialization failed: invalid sample rate or voice capacity.");
+        }
+
+        issued_generations_.resize(voice_capacity, 0);
+        voices_.resize(voice_capacity);
+        accumulator_.resize(BLOCK_FRAMES * CHANNELS);
+        resample_.resize(BLOCK_FRAMES * CHANNELS);
+        output_.resize(BLOCK_FRAMES * CHANNELS);
+
+        spdlog::debug("Mixer using {} kernels, {} voices at {} Hz.", kernels_.name, voice_capacity, sample_rate);
+    }
+
+    Mixer::~Mixer() {
+        close();
+    }
+
+    bool Mixer::open() {
+        if (stream_) {
+            return true;
+        }
+
+        SDL_AudioSpec spec{};
+        spec.format = SDL_AUDIO_F32;
+        spec.channels = CHANNELS;
+        spec.freq = sample_rate_;
+
+        stream_ = SDL_OpenAudioDeviceStream(SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK, &spec, &Mixer::streamCallback, this);
+        if (!stream_) {
+            spdlog::error("Opening the mixer audio stream failed: {}", SDL_GetError());
+            return false;
+        }
+
+        SDL_ResumeAudioStreamDevice(stream_);
+        return true;
+    }
+
+    void Mixer::close() {
+        if (stream_) {
+            SDL_DestroyAudioStream(stream_);
+            stream_ = nullptr;
+        }
+    }
+
+    // --- Game thread ---
+
+    const SoundBuffer* Mixer::createBuffer(const Mix_Chunk& chunk) {
+        int frequency = 0;
+        SDL_AudioFormat format = SDL_AUDIO_UNKNOWN;
+        int channels = 0;
+        if (!Mix_QuerySpec(&frequency, &format, &channels)) {
+            spdlog::error("Converting a chunk for the mixer failed: audio device not open.");
+            return nullptr;
+        }
+
+        SDL_AudioSpec source_spec{};
+        source_spec.format = format;
+        source_spec.channels = channels;
+        source_spec.freq = frequency;
+
+        SDL_AudioSpec mixer_spec{};
+        mixer_spec.format = SDL_AUDIO_F32;
+        mixer_spec.channels = CHANNELS;
+        mixer_spec.freq = sample_rate_;
+
+        Uint8* converted = nullptr;
+        int converted_size = 0;
+        if (!SDL_ConvertAudioSamples(
+                &source_spec, chunk.abuf, static_cast<int>(chunk.alen),
+                &mixer_spec, &converted, &converted_size)) {
+            spdlog::error("Converting a chunk for the mixer failed: {}", SDL_GetError());
+            return nullptr;
+        }
+
+        std::vector<float> samples(static_cast<std::size_t>(converted_size) / sizeof(float));
+        std::memcpy(samples.data(), converted, samples.size() * sizeof(float));
+        SDL_free(converted);
+        return createBuffer(std::move(samples));
+    }
+
+    const SoundBuffer* Mixer::createBuffer(std::vector<float> samples) {
+        SoundBuffer& buffer = buffers_.emplace_back();
+        buffer.frames = samples.size() / CHANNELS;
+        buffer.samples = std::move(samples);
+        return &buffer;
+    }
+
+    VoiceHandle Mixer::play(const SoundBuffer* buffer, float gain, float pan, float pitch, bool loop) {
+        if (!buffer || buffer->frames == 0) {
+            return {};
+        }
+
+        // Round-robin slots: past capacity, the oldest voice is the one replaced
+        std::uint32_t index = next_voice_;
+        next_voice_ = (next_voice_ + 1) % getVoiceCapacity();
+        return playOn(index, buffer, gain, pan, pitch, loop);
+    }
+
+    VoiceHandle Mixer::playOn(std::uint32_t index, const SoundBuffer* buffer, float gain, float pan, float pitch, bool loop) {
+        if (!buffer || buffer->frames == 0 || index >= getVoiceCapacity()) {
+            return {};
+        }
+
+        Command command;
+        command.type = CommandType::PLAY;
+        command.voice = {index, ++issued_generations_[index]};
+        command.buffer = buffer;
+        command.gain = gain;
+        command.pan = pan;
+        command.pitch = pitch;
+        command.loop = loop;
+        post(command);
+        return command.voice;
+    }
+
+    void Mixer::stop(VoiceHandle voice) {
+        Command command;
+        command.type = CommandType::STOP;
+        command.voice = voice;
+        post(command);
+    }
+
+    void Mixer::setVoiceParameters(VoiceHandle voice, float gain, float pan, float pitch) {
+        Command command;
+        command.type = CommandType::SET_PARAMETERS;
+        command.voice = voice;
+        command.gain = gain;
+        command.pan = pan;
+        command.pitch = pitch;
+        post(command);
+    }
+
+    void Mixer::post(const Command& command) {
+        if (!commands_.tryPush(command)) {
+            dropped_commands_.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    Mixer::Stats Mixer::getStats() const {
+        Stats stats;
+        stats.frames_mixed = frames_mixed_.load(std::memory_order_relaxed);
+        stats.voice_frames_mixed = voice_frames_mixed_.load(std::memory_order_relaxed);
+        stats.active_voices = active_voices_.load(std::memory_order_relaxed);
+        stats.dropped_commands = dropped_commands_.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+    // --- Audio thread ---
+
+    void Mixer::streamCallback(void* userdata, SDL_AudioStream* stream, int additional_amount, int /*total_amount*/) {
+        auto* mixer = static_cast<Mixer*>(userdata);
+        auto frames = static_cast<std::size_t>(additional_amount) / (sizeof(float) * CHANNELS);
+
+        mixer->applyCommands();
+        while (frames > 0) {
+            std::size_t block = std::min(frames, BLOCK_FRAMES);
+            mixer->mixBlock(mixer->output_.data(), block);
+            SDL_PutAudioStreamData(stream, mixer->output_.data(), static_cast<int>(block * sizeof(float) * CHANNELS));
+            frames -= block;
+        }
+    }
+
+    void Mixer::mix(float* output, std::size_t frames) {
+        applyCommands();
+        while (frames > 0) {
+            std::size_t block = std::min(frames, BLOCK_FRAMES);
+            mixBlock(output, block);
+            output += block * CHANNELS;
+            frames -= block;
+        }
+    }
+
+    void Mixer::applyCommands() {
+        while (auto command = commands_.tryPop()) {
+            Voice& voice = voices_[command->voice.index];
+
+            switch (command->type) {
+                case CommandType::PLAY:
+                    voice.buffer = command->buffer;
+                    voice.position = 0.0;
+                    voice.pitch = std::max(command->pitch, 0.0f);
+                    voice.generation = command->voice.generation;
+                    voice.loop = command->loop;
+                    voice.active = true;
+                    panGains(command->gain, command->pan, voice.gain_left, voice.gain_right);
+                    break;
+
+                case CommandType::STOP:
+                    if (voice.generation == command->voice.generation) {
+                        voice.active = false;
+                    }
+                    break;
+
+                case CommandType::SET_PARAMETERS:
+                    if (voice.generation == command->voice.generation) {
+                        voice.pitch = std::max(command->pitch, 0.0f);
+                        panGains(command->gain, command->pan, voice.gain_left, voice.gain_right);
+                    }
+                    break;
+            }
+        }
+    }
+
+    void Mixer::mixBlock(float* output, std::size_t frames) {
+        std::fill_n(accumulator_.data(), frames * CHANNELS, 0.0f);
+
+        std::uint32_t active = 0;
+        for (auto& voice : voices_) {
+            if (!voice.active) {
+                continue;
+            }
+
+            voice.active = mixVoice(voice, frames);
+            ++active;
+        }
+
+        kernels_.clamp_output(output, accumulator_.data(), frames);
+
+        frames_mixed_.fetch_add(frames, std::memory_order_relaxed);
+        voice_frames_mixed_.fetch_add(static_cast<std::uint64_t>(frames) * active, std::memory_order_relaxed);
+        active_voices_.store(active, std::memory_order_relaxed);
+    }
+
+    bool Mixer::mixVoice(Voice& voice, std::size_t frames) {
+        const SoundBuffer& buffer = *voice.buffer;
+        float* accumulator = accumulator_.data();
+
+        // Unpitched voices mix straight from the buffer
+        if (voice.pitch == 1.0f) {
+            std::size_t done = 0;
+            while (done < frames) {
+                auto position = static_cast<std::size_t>(voice.position);
+                std::size_t count = std::min(buffer.frames - position, frames - done);
+                kernels_.mix_stereo(
+                    accumulator + done * CHANNELS,
+                    buffer.samples.data() + position * CHANNELS,
+                    count,
+                    voice.gain_left,
+                    voice.gain_right
+                );
+
+                done += count;
+                voice.position += static_cast<double>(count);
+                if (static_cast<std::size_t>(voice.position) >= buffer.frames) {
+                    if (!voice.loop) {
+                        return false;
+                    }
+                    voice.position = 0.0;
+                }
+            }
+            return true;
+        }
+
+        // Pitched voices are resampled (linear interpolation) into scratch, then mixed
+        const float* samples = buffer.samples.data();
+        float* resampled = resample_.data();
+        auto length = static_cast<double>(buffer.frames);
+        std::size_t count = 0;
+
+        for (; count < frames; ++count) {
+            if (voice.position >= length) {
+                if (!voice.loop) {
+                    break;
+                }
+                voice.position = std::fmod(voice.position, length);
+            }
+
+            auto index = static_cast<std::size_t>(voice.position);
+            std::size_t next = index + 1 < buffer.frames ? index + 1 : (voice.loop ? 0 : index);
+            auto t = static_cast<float>(voice.position - static_cast<double>(index));
+
+            resampled[count * 2] = samples[index * 2] + (samples[next * 2] - samples[index * 2]) * t;
+            resampled[count * 2 + 1] = samples[index * 2 + 1] + (samples[next * 2 + 1] - samples[index * 2 + 1]) * t;
+            voice.position += voice.pitch;
+        }
+
+        kernels_.mix_stereo(accumulator, resampled, count, voice.gain_left, voice.gain_right);
+        return count == frames;
+    }
+
+} // namespace engine::audio
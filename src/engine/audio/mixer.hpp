@@ -0,0 +1,149 @@
+#ifndef MIXER_HPP_
+#define MIXER_HPP_
+
+#include "mix_kernels.hpp"
+#include "../utils/spsc_queue.hpp"
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+struct Mix_Chunk;
+struct SDL_AudioStream;
+
+namespace engine::audio {
+
+    /// @brief Decoded sound owned by the Mixer: interleaved stereo float32 at the mixer's rate.
+    struct SoundBuffer {
+        std::vector<float> samples;
+        std::size_t frames = 0;
+    };
+
+    /// @brief Handle to a playing voice. Stale handles are ignored.
+    struct VoiceHandle {
+        std::uint32_t index = 0;
+        std::uint32_t generation = 0;
+    };
+
+    /// @brief Engine-side software mixer feeding one SDL audio stream.
+    ///
+    /// Handles far more simultaneous voices than SDL_mixer's channels: every voice has its
+    /// own gain, constant-power pan and pitch, and is summed into a float accumulator by
+    /// the SIMD kernels from selectMixKernels() before being clamped to the output.
+    ///
+    /// Buffers are created and voices controlled from the game thread; the changes reach
+    /// the audio callback through a lock-free queue. Without open() the mixer runs
+    /// headless, and mix() can be driven directly.
+    class Mixer final {
+    public:
+        static constexpr int CHANNELS = 2;
+
+        struct Stats {
+            std::uint64_t frames_mixed = 0;
+            std::uint64_t voice_frames_mixed = 0;
+            std::uint32_t active_voices = 0;
+            std::uint64_t dropped_commands = 0;
+        };
+
+        explicit Mixer(int sample_rate = 48000, std::uint32_t voice_capacity = 256, MixKernelSet kernels = MixKernelSet::AUTO);
+        ~Mixer();
+
+        Mixer(const Mixer&) = delete;
+        Mixer& operator=(const Mixer&) = delete;
+        Mixer(Mixer&&) = delete;
+        Mixer& operator=(Mixer&&) = delete;
+
+        /// @brief Start feeding the default playback device. Returns false on failure.
+        bool open();
+        void close();
+
+        /// @brief Convert a chunk loaded through SDL_mixer (in the mixer device format).
+        /// The buffer lives as long as the Mixer.
+        const SoundBuffer* createBuffer(const Mix_Chunk& chunk);
+        /// @brief Take ownership of float32 stereo samples already at the mixer's rate.
+        const SoundBuffer* createBuffer(std::vector<float> samples);
+
+        /// @param pan -1 (left) to 1 (right).
+        /// @param pitch Playback rate; 1 is the original pitch.
+        VoiceHandle play(const SoundBuffer* buffer, float gain = 1.0f, float pan = 0.0f, float pitch = 1.0f, bool loop = false);
+        /// @brief Play on a given voice slot, replacing whatever it plays. For callers that
+        /// allocate voices themselves; mixing both forms of play() is not supported.
+        VoiceHandle playOn(std::uint32_t index, const SoundBuffer* buffer, float gain = 1.0f, float pan = 0.0f, float pitch = 1.0f, bool loop = false);
+        std::uint32_t getVoiceCapacity() const { return static_cast<std::uint32_t>(issued_generations_.size()); }
+        void stop(VoiceHandle voice);
+        void setVoiceParameters(VoiceHandle voice, float gain, float pan, float pitch);
+
+        /// @brief Apply pending commands and mix `frames` frames into `output`. Called by the
+        /// audio stream callback; call directly only while the mixer is not open.
+        void mix(float* output, std::size_t frames);
+
+        int getSampleRate() const { return sample_rate_; }
+        const char* getKernelName() const { return kernels_.name; }
+        Stats getStats() const;
+
+    private:
+        enum class CommandType : std::uint8_t {
+            PLAY,
+            STOP,
+            SET_PARAMETERS,
+        };
+
+        struct Command {
+            CommandType type = CommandType::PLAY;
+            VoiceHandle voice;
+            const SoundBuffer* buffer = nullptr;
+            float gain = 1.0f;
+            float pan = 0.0f;
+            float pitch = 1.0f;
+            bool loop = false;
+        };
+
+        struct Voice {
+            const SoundBuffer* buffer = nullptr;
+            double position = 0.0;
+            float gain_left = 0.0f;
+            float gain_right = 0.0f;
+            float pitch = 1.0f;
+            std::uint32_t generation = 0;
+            bool loop = false;
+            bool active = false;
+        };
+
+        static constexpr std::size_t QUEUE_CAPACITY = 1024;
+        static constexpr std::size_t BLOCK_FRAMES = 512;
+
+        int sample_rate_;
+        MixKernels kernels_;
+        SDL_AudioStream* stream_ = nullptr;
+
+        // --- Game thread ---
+        std::deque<SoundBuffer> buffers_;
+        /// @brief Generation last handed out per voice slot; slots are reused round-robin.
+        std::vector<std::uint32_t> issued_generations_;
+        std::uint32_t next_voice_ = 0;
+
+        // --- Shared ---
+        engine::utils::SpscQueue<Command, QUEUE_CAPACITY> commands_;
+        std::atomic<std::uint64_t> frames_mixed_{0};
+        std::atomic<std::uint64_t> voice_frames_mixed_{0};
+        std::atomic<std::uint32_t> active_voices_{0};
+        std::atomic<std::uint64_t> dropped_commands_{0};
+
+        // --- Audio thread ---
+        std::vector<Voice> voices_;
+        std::vector<float> accumulator_;
+        std::vector<float> resample_;
+        std::vector<float> output_;
+
+        void post(const Command& command);
+        void applyCommands();
+        void mixBlock(float* output, std::size_t frames);
+        /// @brief Mix up to `frames` frames of one voice; returns false once it has finished.
+        bool mixVoice(Voice& voice, std::size_t frames);
+
+        static void streamCallback(void* userdata, SDL_AudioStream* stream, int additional_amount, int total_amount);
+    };
+
+} // namespace engine::audio
+
+#endif // MIXER_HPP_
@@ -0,0 +1,63 @@
+#include "sound_event_bus.hpp"
+#include "audio_player.hpp"
+#include <algorithm>
+
+namespace engine::audio {
+
+    SoundEventBus::SoundEventBus(AudioPlayer& audio_player) : audio_player_(audio_player) {}
+
+    SoundEventBus::SoundState& SoundEventBus::getState(std::string_view file_path) {
+        auto it = sounds_.find(file_path);
+        if (it == sounds_.end()) {
+            it = sounds_.emplace(std::string(file_path), SoundState{}).first;
+            it->second.path = it->first;
+            it->second.settings = default_settings_;
+        }
+        return it->second;
+    }
+
+    void SoundEventBus::setSoundSettings(std::string_view file_path, const SoundSettings& settings) {
+        getState(file_path).settings = settings;
+    }
+
+    void SoundEventBus::post(std::string_view file_path, float volume) {
+        ++stats_.requests;
+        SoundState& sound = getState(file_path);
+
+        if (sound.pending >= 0) {
+            auto& pending = pending_[static_cast<std::size_t>(sound.pending)];
+            pending.volume = std::max(pending.volume, volume);
+            ++stats_.coalesced;
+            return;
+        }
+
+        sound.pending = static_cast<int>(pending_.size());
+        pending_.push_back({&sound, volume});
+    }
+
+    void SoundEventBus::flush(float delta_time) {
+        time_ += delta_time;
+
+        for (const auto& pending : pending_) {
+            SoundState& sound = *pending.sound;
+            sound.pending = -1;
+
+            if (sound.last_played >= 0.0 && time_ - sound.last_played < sound.settings.min_interval) {
+                ++stats_.coalesced;
+                continue;
+            }
+
+            audio_player_.playSound(
+                sound.path,
+                sound.settings.priority,
+                pending.volume,
+                sound.settings.max_instances
+            );
+            sound.last_played = time_;
+            ++stats_.played;
+        }
+
+        pending_.clear();
+    }
+
+} // namespace engine::audio
@@ -0,0 +1,88 @@
+#ifndef SOUND_EVENT_BUS_HPP_
+#define SOUND_EVENT_BUS_HPP_
+
+#include "../utils/hash.hpp"
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace engine::audio {
+    class AudioPlayer;
+
+    /// @brief How the SoundEventBus treats one sound.
+    struct SoundSettings {
+        /// @brief Voice priority; higher priorities may steal voices from lower ones.
+        int priority = 0;
+        /// @brief Instances allowed to play at once; 0 is unlimited.
+        int max_instances = 4;
+        /// @brief Requests arriving sooner than this after the last playback are merged
+        /// into it, in seconds.
+        float min_interval = 0.05f;
+    };
+
+    /// @brief Collects sound requests during a frame and forwards them in one batch.
+    ///
+    /// Requests for the same sound within a frame, or within its min_interval of the
+    /// last time it actually played, are coalesced into one playback at the loudest
+    /// requested volume. What reaches the AudioPlayer is therefore bounded by the
+    /// number of distinct sounds rather than the number of callers.
+    class SoundEventBus final {
+    public:
+        struct Stats {
+            std::uint64_t requests = 0;
+            std::uint64_t coalesced = 0;
+            std::uint64_t played = 0;
+        };
+
+        explicit SoundEventBus(AudioPlayer& audio_player);
+
+        SoundEventBus(const SoundEventBus&) = delete;
+        SoundEventBus& operator=(const SoundEventBus&) = delete;
+        SoundEventBus(SoundEventBus&&) = delete;
+        SoundEventBus& operator=(SoundEventBus&&) = delete;
+
+        /// @brief Request a sound; it plays when the frame's batch is flushed.
+        void post(std::string_view file_path, float volume = 1.0f);
+
+        /// @brief Override the settings of one sound (defaults otherwise).
+        void setSoundSettings(std::string_view file_path, const SoundSettings& settings);
+        void setDefaultSettings(const SoundSettings& settings) { default_settings_ = settings; }
+
+        /// @brief Forward this frame's requests to the AudioPlayer. Call once per frame.
+        void flush(float delta_time);
+
+        const Stats& getStats() const { return stats_; }
+
+    private:
+        struct SoundState {
+            std::string path;
+            SoundSettings settings;
+            /// @brief Time of the last playback; negative if never played.
+            double last_played = -1.0;
+            /// @brief Index into pending_ of this frame's request, or -1.
+            int pending = -1;
+        };
+
+        struct PendingSound {
+            SoundState* sound = nullptr;
+            float volume = 0.0f;
+        };
+
+        AudioPlayer& audio_player_;
+        SoundSettings default_settings_;
+
+        /// @brief Node-based, so the SoundState pointers in pending_ stay valid.
+        std::unordered_map<std::string, SoundState, engine::utils::StringHash, std::equal_to<>> sounds_;
+        std::vector<PendingSound> pending_;
+        double time_ = 0.0;
+        Stats stats_;
+
+        SoundState& getState(std::string_view file_path);
+    };
+
+} // namespace engine::audio
+
+#endif // SOUND_EVENT_BUS_HPP_
@@ -100,12 +100,25 @@ namespace engine::core {
                 spdlog::warn("Target FPS cannot be native. Set to 0 (unrestricted).");
                 target_fps_ = 0;
             }
+
+            texture_budget_mb_ = perf_config.value("texture_budget_mb", texture_budget_mb_);
+            if (texture_budget_mb_ < 0) {
+                spdlog::warn("Texture budget cannot be negative. Set to 0 (unlimited).");
+                texture_budget_mb_ = 0;
+            }
+
+            physics_threads_ = perf_config.value("physics_threads", physics_threads_);
+            if (physics_threads_ < 0) {
+                spdlog::warn("Physics thread count cannot be negative. Set to 0 (automatic).");
+                physics_threads_ = 0;
+            }
         }
 
         if (j.contains("audio")) {
             const auto& audio_config = j["audio"];
             music_volume_ = audio_config.value("music_volume", music_volume_);
             sound_volume_ = audio_config.value("sound_volume", sound_volume_);
+            software_mixer_ = audio_config.value("software_mixer", software_mixer_);
         }
 
         if (j.contains("input_mappings") && j["input_mappings"].is_object()) {
@@ -144,11 +157,14 @@ namespace engine::core {
                 {"vsync", vsync_enabled_}
             }},
             {"performance", {
-                {"target_fps", target_fps_}
+                {"target_fps", target_fps_},
+                {"texture_budget_mb", texture_budget_mb_},
+                {"physics_threads", physics_threads_}
             }},
             {"audio", {
                 {"music_volume", music_volume_},
-                {"sound_volume", sound_volume_}
+                {"sound_volume", sound_volume_},
+                {"software_mixer", software_mixer_}
             }},
             {"input_mappings", input_mappings_}
         };
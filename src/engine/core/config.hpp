@@ -30,10 +30,17 @@ namespace engine::core {
 
         // Performance settings
         int target_fps_ = 144;
+        /// @brief Memory budget for resident textures in MiB; 0 means unlimited.
+        int texture_budget_mb_ = 256;
+        /// @brief Threads stepping the physics, the main thread included; 0 picks one per
+        /// spare core, up to 4.
+        int physics_threads_ = 0;
 
         // Audio settings
         float music_volume_ = 0.5f;
         float sound_volume_ = 0.5f;
+        /// @brief Play sound effects through the engine Mixer instead of SDL_mixer channels.
+        bool software_mixer_ = false;
 
         // Store the mapping of action names to the SDL scancode name list
         std::unordered_map<std::string, std::vector<std::string>> input_mappings_ = {
@@ -1,8 +1,12 @@
 #include "context.hpp"
 #include "../input/input_manager.hpp"
 #include "../render/renderer.hpp"
+#include "../render/camera.hpp"
 #include "../render/text_renderer.hpp"
 #include "../resource/resource_manager.hpp"
+#include "../physics/physics_engine.hpp"
+#include "../audio/audio_player.hpp"
+#include "../audio/sound_event_bus.hpp"
 #include <spdlog/spdlog.h>
 
 namespace engine::core {
@@ -10,21 +14,39 @@ namespace engine::core {
     Context::Context(
         engine::input::InputManager& input_manager,
         engine::render::Renderer& renderer,
+        engine::render::Camera& camera,
         engine::render::TextRenderer& text_renderer,
         engine::resource::ResourceManager& resource_manager,
-        engine::core::GameState& game_state
+        engine::physics::PhysicsEngine& physics_engine,
+        engine::audio::AudioPlayer& audio_player,
+        engine::audio::SoundEventBus& sound_event_bus,
+        engine::core::GameState& game_state,
+        engine::utils::FrameArena& frame_arena,
+        engine::utils::Random& random
     )
         : input_manager_(input_manager)
         , renderer_(renderer)
+        , camera_(camera)
         , text_renderer_(text_renderer)
         , resource_manager_(resource_manager)
+        , physics_engine_(physics_engine)
+        , audio_player_(audio_player)
+        , sound_event_bus_(sound_event_bus)
         , game_state_(game_state)
+        , frame_arena_(frame_arena)
+        , random_(random)
     {
         spdlog::trace("  Bound InputManager to Context.");
         spdlog::trace("  Bound Renderer to Context.");
+        spdlog::trace("  Bound Camera to Context.");
         spdlog::trace("  Bound TextRenderer to Context.");
         spdlog::trace("  Bound ResourceManager to Context");
+        spdlog::trace("  Bound PhysicsEngine to Context");
+        spdlog::trace("  Bound AudioPlayer to Context");
+        spdlog::trace("  Bound SoundEventBus to Context");
         spdlog::trace("  Bound GameState to Context");
+        spdlog::trace("  Bound FrameArena to Context");
+        spdlog::trace("  Bound Random to Context");
     }
 
 } // namespace engine::core
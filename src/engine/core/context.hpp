@@ -21,6 +21,12 @@ namespace engine::physics {
 
 namespace engine::audio {
     class AudioPlayer;
+    class SoundEventBus;
+}
+
+namespace engine::utils {
+    class FrameArena;
+    class Random;
 }
 
 namespace engine::core {
@@ -31,9 +37,15 @@ namespace engine::core {
         Context(
             engine::input::InputManager& input_manager,
             engine::render::Renderer& renderer,
+            engine::render::Camera& camera,
             engine::render::TextRenderer& text_renderer,
             engine::resource::ResourceManager& resource_manager,
-            engine::core::GameState& game_state
+            engine::physics::PhysicsEngine& physics_engine,
+            engine::audio::AudioPlayer& audio_player,
+            engine::audio::SoundEventBus& sound_event_bus,
+            engine::core::GameState& game_state,
+            engine::utils::FrameArena& frame_arena,
+            engine::utils::Random& random
         );
 
         Context(const Context&) = delete;
@@ -43,16 +55,30 @@ namespace engine::core {
 
         engine::input::InputManager& getInputManager() const { return input_manager_; }
         engine::render::Renderer& getRenderer() const { return renderer_; }
+        engine::render::Camera& getCamera() const { return camera_; }
         engine::render::TextRenderer& getTextRenderer() const { return text_renderer_; }
         engine::resource::ResourceManager& getResourceManager() const { return resource_manager_; }
+        engine::physics::PhysicsEngine& getPhysicsEngine() const { return physics_engine_; }
+        engine::audio::AudioPlayer& getAudioPlayer() const { return audio_player_; }
+        engine::audio::SoundEventBus& getSoundEventBus() const { return sound_event_bus_; }
         engine::core::GameState& getGameState() const { return game_state_; }
+        /// @brief Allocator for data that only lives until the end of the current frame.
+        engine::utils::FrameArena& getFrameArena() const { return frame_arena_; }
+        /// @brief Seeded generator for gameplay randomness; reproducible in deterministic runs.
+        engine::utils::Random& getRandom() const { return random_; }
 
     private:
         engine::input::InputManager& input_manager_;
         engine::render::Renderer& renderer_;
+        engine::render::Camera& camera_;
         engine::render::TextRenderer& text_renderer_;
         engine::resource::ResourceManager& resource_manager_;
+        engine::physics::PhysicsEngine& physics_engine_;
+        engine::audio::AudioPlayer& audio_player_;
+        engine::audio::SoundEventBus& sound_event_bus_;
         engine::core::GameState& game_state_;
+        engine::utils::FrameArena& frame_arena_;
+        engine::utils::Random& random_;
     };
 
 } // namespace engine::core
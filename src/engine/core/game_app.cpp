@@ -4,17 +4,36 @@
 #include "config.hpp"
 #include "game_state.hpp"
 #include "../resource/resource_manager.hpp"
+#include "../audio/audio_player.hpp"
+#include "../audio/sound_event_bus.hpp"
 #include "../render/renderer.hpp"
 #include "../render/text_renderer.hpp"
 #include "../render/gpu_renderer.hpp"
 #include "../render/camera.hpp"
 #include "../input/input_manager.hpp"
+#include "../input/input_recording.hpp"
+#include "../physics/physics_engine.hpp"
 #include "../scene/scene_manager.hpp"
+#include "../utils/cpu_features.hpp"
+#include "../utils/frame_arena.hpp"
+#include "../utils/random.hpp"
 #include <SDL3/SDL.h>
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
 #include <spdlog/spdlog.h>
+#include <thread>
 
 namespace engine::core {
 
+    namespace {
+
+        /// @brief Ticks per second of deterministic runs, whatever the display's frame rate.
+        constexpr float DETERMINISTIC_TICK_RATE = 60.0f;
+
+    } // namespace
+
     GameApp::GameApp() = default;
 
     GameApp::~GameApp() {
@@ -41,13 +60,49 @@ namespace engine::core {
     void GameApp::oneIter() {
         if (!is_running_) return;
 
+        // Everything allocated from the arena last frame is released here
+        frame_arena_->reset();
+
         time_->update();
+
+        // Replays run on the recorded clock so every frame sees the same delta
+        if (input_replay_) {
+            if (!input_replay_->nextFrame()) {
+                finishReplay();
+                return;
+            }
+            // Lockstep runs keep their fixed tick
+            if (!time_->isFixedStep()) {
+                time_->setDeltaTime(input_replay_->getFrameDelta());
+            }
+        }
+
         float delta_time = time_->getDeltaTime();
+
+        if (input_recorder_) {
+            input_recorder_->beginFrame(time_->getUnscaledDeltaTime());
+        }
+
         input_manager_->update();
 
+        if (input_recorder_) {
+            input_recorder_->endFrame(input_manager_->getStateHash());
+        } else if (input_replay_) {
+            input_replay_->endFrame(input_manager_->getStateHash());
+        }
+
         handleEvents();
         update(delta_time);
+
+        if (state_hash_log_) {
+            writeStateHash();
+        }
+        ++tick_;
+
         render();
+
+        // Frame boundary: destroy resources released by scenes cleaned this frame
+        resource_manager_->endFrame();
     }
 
     void GameApp::registerSceneSetup(std::function<void(engine::scene::SceneManager&)> func) {
@@ -61,6 +116,12 @@ namespace engine::core {
             return false;
         }
 
+        // Builds for a newer architecture refuse to run rather than crash on older CPUs
+        if (auto missing = engine::utils::getMissingCpuFeatures(); !missing.empty()) {
+            spdlog::error("This build requires CPU features this machine lacks: {}.", missing);
+            return false;
+        }
+
         spdlog::trace("Initializing engine modules...");
 
         if (!initConfig()) return false;
@@ -80,6 +141,7 @@ namespace engine::core {
 
         if (!initContext()) return false;
         if (!initSceneManager()) return false;
+        if (!initStateHashLog()) return false;
 
         scene_setup_func_(*scene_manager_);
 
@@ -100,6 +162,9 @@ namespace engine::core {
 
     void GameApp::update(float delta_time) {
         scene_manager_->update(delta_time);
+
+        // Sounds requested while handling input and updating go out as one batch
+        sound_event_bus_->flush(delta_time);
     }
 
     void GameApp::render() {
@@ -116,7 +181,56 @@ namespace engine::core {
         // renderer_->present();
     }
 
+    void GameApp::finishReplay() {
+        double elapsed_ms = static_cast<double>(SDL_GetTicksNS() - replay_start_ns_) / 1000000.0;
+        std::uint32_t frames = input_replay_->getFrameCount();
+
+        spdlog::info(
+            "Replayed {} frames in {:.2f} ms ({:.3f} ms/frame).",
+            frames,
+            elapsed_ms,
+            frames > 0 ? elapsed_ms / frames : 0.0
+        );
+
+        if (input_replay_->matchesRecording()) {
+            spdlog::info("Replay reproduced the recorded action states on every frame.");
+        } else {
+            spdlog::error("Replay diverged from the recording at frame {}.", input_replay_->getFirstDivergentFrame());
+        }
+
+        is_running_ = false;
+    }
+
+    void GameApp::writeStateHash() {
+        *state_hash_log_
+            << tick_ << ' '
+            << std::hex << std::setw(16) << std::setfill('0') << scene_manager_->computeStateHash()
+            << std::dec << '\n';
+    }
+
     void GameApp::close() {
+        // GPU and renderer resources must be released before their devices
+        if (gpu_renderer_) {
+            gpu_renderer_->clean();
+        }
+
+        // Writes the final frame count into the recording's header
+        input_recorder_.reset();
+
+        if (deterministic_ && scene_manager_) {
+            spdlog::info("State hash after {} ticks: {:016x}.", tick_, scene_manager_->computeStateHash());
+        }
+        state_hash_log_.reset();
+
+        // The audio thread owns mixer state and must stop before the mixer closes
+        if (audio_player_) {
+            audio_player_->close();
+        }
+
+        if (resource_manager_) {
+            resource_manager_->clear();
+        }
+
         if (sdl_renderer_ != nullptr) {
             SDL_DestroyRenderer(sdl_renderer_);
             sdl_renderer_ = nullptr;
@@ -183,9 +297,6 @@ namespace engine::core {
         spdlog::debug("    Claiming window for GPU device");
         SDL_ClaimWindowForGPUDevice(gpu_device_, window_);
 
-        spdlog::debug("    Starting GPU Renderer...");
-        gpu_renderer_->init();
-
         spdlog::trace("  SDL initialization successful.");
         return true;
     }
@@ -194,8 +305,12 @@ namespace engine::core {
         try {
             gpu_renderer_ = std::make_unique<engine::render::GPURenderer>(
                 gpu_device_,
-                window_
+                window_,
+                resource_manager_.get()
             );
+
+            spdlog::debug("    Starting GPU Renderer...");
+            gpu_renderer_->init();
         }
 
         catch (const std::exception& exc) {
@@ -218,13 +333,26 @@ namespace engine::core {
         }
 
         time_->setTargetFps(config_->target_fps_);
+
+        if (deterministic_) {
+            time_->setFixedDeltaTime(1.0f / DETERMINISTIC_TICK_RATE);
+            spdlog::info("Deterministic mode: fixed {} Hz tick, random seed {}.", DETERMINISTIC_TICK_RATE, random_seed_);
+        }
+
         spdlog::trace("  Time initialization successful.");
         return true;
     }
 
     bool GameApp::initResourceManager() {
         try {
-            resource_manager_ = std::make_unique<engine::resource::ResourceManager>(sdl_renderer_);
+            resource_manager_ = std::make_unique<engine::resource::ResourceManager>(sdl_renderer_, gpu_device_);
+
+            // Packed builds ship their assets in one archive; loose files remain the fallback
+            if (std::filesystem::exists("assets.pak")) {
+                resource_manager_->mountPack("assets.pak");
+            }
+
+            resource_manager_->setTextureBudget(static_cast<std::size_t>(config_->texture_budget_mb_) * 1024 * 1024);
         }
 
         catch (const std::exception& exc) {
@@ -237,8 +365,23 @@ namespace engine::core {
     }
 
     bool GameApp::initAudioPlayer() {
-        // spdlog::trace("  AudioPlayer initialization successful.");
-        spdlog::warn("AudioPlayer not yet implemented!");
+        try {
+            audio_player_ = std::make_unique<engine::audio::AudioPlayer>(
+                resource_manager_->getAssetLocator(),
+                config_->music_volume_,
+                config_->sound_volume_,
+                engine::audio::AudioPlayer::DEFAULT_VOICE_COUNT,
+                config_->software_mixer_
+            );
+            sound_event_bus_ = std::make_unique<engine::audio::SoundEventBus>(*audio_player_);
+        }
+
+        catch (const std::exception& exc) {
+            spdlog::error("AudioPlayer initialization failed: {}", exc.what());
+            return false;
+        }
+
+        spdlog::trace("  AudioPlayer initialization successful.");
         return true;
     }
 
@@ -292,6 +435,18 @@ namespace engine::core {
                 sdl_renderer_,
                 config_.get()
             );
+
+            if (!input_replay_path_.empty()) {
+                input_replay_ = std::make_unique<engine::input::InputReplay>(input_replay_path_);
+                input_manager_->setReplay(input_replay_.get());
+
+                // Frames are paced by the recording, not the wall clock
+                time_->setTargetFps(0);
+                replay_start_ns_ = SDL_GetTicksNS();
+            } else if (!input_record_path_.empty()) {
+                input_recorder_ = std::make_unique<engine::input::InputRecorder>(input_record_path_);
+                input_manager_->setRecorder(input_recorder_.get());
+            }
         }
 
         catch (const std::exception& exc) {
@@ -302,8 +457,23 @@ namespace engine::core {
     }
 
     bool GameApp::initPhysicsEngine() {
-        // spdlog::trace("  PhysicsEngine initialization successful.");
-        spdlog::warn("PhysicsEngine not yet implemented!");
+        try {
+            // Leave a core to the audio thread, and stop where small scenes stop scaling
+            std::size_t thread_count = static_cast<std::size_t>(config_->physics_threads_);
+            if (thread_count == 0) {
+                unsigned int cores = std::thread::hardware_concurrency();
+                thread_count = std::clamp<std::size_t>(cores > 2 ? cores - 2 : 1, 1, 4);
+            }
+
+            physics_engine_ = std::make_unique<engine::physics::PhysicsEngine>(64.0f, thread_count);
+        }
+
+        catch (const std::exception& exc) {
+            spdlog::error("PhysicsEngine initialization failed: {}", exc.what());
+            return false;
+        }
+
+        spdlog::trace("  PhysicsEngine initialization successful.");
         return true;
     }
 
@@ -325,12 +495,26 @@ namespace engine::core {
         spdlog::trace("Initializing Context...");
 
         try {
+            frame_arena_ = std::make_unique<engine::utils::FrameArena>();
+
+            // Outside deterministic runs every session draws different numbers
+            if (!deterministic_) {
+                random_seed_ = SDL_GetPerformanceCounter();
+            }
+            random_ = std::make_unique<engine::utils::Random>(random_seed_);
+
             context_ = std::make_unique<engine::core::Context>(
                 *input_manager_,
                 *renderer_,
+                *camera_,
                 *text_renderer_,
                 *resource_manager_,
-                *game_state_
+                *physics_engine_,
+                *audio_player_,
+                *sound_event_bus_,
+                *game_state_,
+                *frame_arena_,
+                *random_
             );
         }
 
@@ -359,4 +543,24 @@ namespace engine::core {
         return true;
     }
 
+    bool GameApp::initStateHashLog() {
+        if (state_hash_path_.empty()) {
+            return true;
+        }
+
+        state_hash_log_ = std::make_unique<std::ofstream>(state_hash_path_);
+        if (!*state_hash_log_) {
+            spdlog::error("Unable to open state hash log '{}'.", state_hash_path_);
+            state_hash_log_.reset();
+            return false;
+        }
+
+        if (!deterministic_) {
+            spdlog::warn("State hashes are logged outside deterministic mode; runs will not match.");
+        }
+
+        spdlog::trace("State hash log '{}' opened.", state_hash_path_);
+        return true;
+    }
+
 } // namespace engine::core
@@ -1,8 +1,12 @@
 #ifndef GAME_APP_HPP_
 #define GAME_APP_HPP_
 
+#include <cstdint>
 #include <memory>
 #include <functional>
+#include <iosfwd>
+#include <string>
+#include <string_view>
 
 // Forward declaration to reduce header file dependencies and increase compilation speed
 struct SDL_Window;
@@ -22,6 +26,8 @@ namespace engine::render {
 
 namespace engine::input {
     class InputManager;
+    class InputRecorder;
+    class InputReplay;
 }
 
 namespace engine::physics {
@@ -34,6 +40,12 @@ namespace engine::scene {
 
 namespace engine::audio {
     class AudioPlayer;
+    class SoundEventBus;
+}
+
+namespace engine::utils {
+    class FrameArena;
+    class Random;
 }
 
 namespace engine::core {
@@ -53,6 +65,18 @@ namespace engine::core {
         void oneIter();
         void registerSceneSetup(std::function<void(engine::scene::SceneManager&)> func);
 
+        /// @brief Record the session's input to `file_path`. Call before run().
+        void setInputRecording(std::string_view file_path) { input_record_path_ = file_path; }
+        /// @brief Replay recorded input on the recorded clock instead of taking live input,
+        /// as fast as possible, then quit. Call before run().
+        void setInputReplay(std::string_view file_path) { input_replay_path_ = file_path; }
+        /// @brief Run in lockstep: every frame is one fixed tick and the engine's random
+        /// generator starts from `seed`, so the same input gives the same run. Call before run().
+        void setDeterministic(std::uint64_t seed) { deterministic_ = true; random_seed_ = seed; }
+        /// @brief Write the scenes' state hash after every tick to `file_path`, one line per
+        /// tick, so that two runs can be diffed. Call before run().
+        void setStateHashLog(std::string_view file_path) { state_hash_path_ = file_path; }
+
         GameApp(const GameApp&) = delete;
         GameApp& operator=(const GameApp&) = delete;
         GameApp(GameApp&&) = delete;
@@ -69,6 +93,8 @@ namespace engine::core {
 
         std::unique_ptr<engine::core::Time> time_;
         std::unique_ptr<engine::resource::ResourceManager> resource_manager_;
+        std::unique_ptr<engine::audio::AudioPlayer> audio_player_;
+        std::unique_ptr<engine::audio::SoundEventBus> sound_event_bus_;
         std::unique_ptr<engine::render::Renderer> renderer_;
         std::unique_ptr<engine::render::Camera> camera_;
         std::unique_ptr<engine::render::TextRenderer> text_renderer_;
@@ -76,16 +102,30 @@ namespace engine::core {
 
         std::unique_ptr<engine::core::Config> config_;
         std::unique_ptr<engine::input::InputManager> input_manager_;
+        std::unique_ptr<engine::input::InputRecorder> input_recorder_;
+        std::unique_ptr<engine::input::InputReplay> input_replay_;
+        std::string input_record_path_;
+        std::string input_replay_path_;
+        std::uint64_t replay_start_ns_ = 0;
+        std::unique_ptr<engine::utils::FrameArena> frame_arena_;
+        std::unique_ptr<engine::utils::Random> random_;
+        bool deterministic_ = false;
+        std::uint64_t random_seed_ = 0;
+        std::uint64_t tick_ = 0;
+        std::string state_hash_path_;
+        std::unique_ptr<std::ofstream> state_hash_log_;
+        // Outlives the scene manager: bodies unregister when their objects are destroyed
+        std::unique_ptr<engine::physics::PhysicsEngine> physics_engine_;
         std::unique_ptr<engine::core::Context> context_;
         std::unique_ptr<engine::scene::SceneManager> scene_manager_;
-        // std::unique_ptr<engine::physics::PhysicsEngine> physics_;
-        // std::unique_ptr<engine::audio::AudioPlayer> audio_player_;
         std::unique_ptr<engine::core::GameState> game_state_;
 
         void handleEvents();
         void update(float delta_time);
         void render();
         void close();
+        void finishReplay();
+        void writeStateHash();
 
         // The initialization/creation function of each module is called in init()
         [[nodiscard]] bool init();
@@ -103,6 +143,7 @@ namespace engine::core {
         [[nodiscard]] bool initGameState();
         [[nodiscard]] bool initContext();
         [[nodiscard]] bool initSceneManager();
+        [[nodiscard]] bool initStateHashLog();
     };
 
 } // namespace engine::core
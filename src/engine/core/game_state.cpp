@@ -13,9 +13,9 @@ namespace engine::core {
         , renderer_(renderer)
         , current_state_(initial_state)
     {
-        if (window_ == nullptr || renderer_ == nullptr) {
-            spdlog::error("Window or renderer is empty.");
-            throw std::runtime_error("Window and renderer cannot be empty.");
+        if (renderer_ == nullptr) {
+            spdlog::error("Renderer is empty.");
+            throw std::runtime_error("Renderer cannot be empty.");
         }
     }
 
@@ -31,12 +31,23 @@ namespace engine::core {
     }
 
     glm::vec2 GameState::getWindowSize() const {
-        int width, height;
+        int width = 0, height = 0;
+        if (window_ == nullptr) {
+            // Offscreen renderers draw to a surface; its size stands in for the window
+            SDL_GetCurrentRenderOutputSize(renderer_, &width, &height);
+            return glm::vec2(width, height);
+        }
+
         SDL_GetWindowSize(window_, &width, &height);
         return glm::vec2(width, height);
     }
 
     void GameState::setWindowSize(const glm::vec2& window_size) {
+        if (window_ == nullptr) {
+            spdlog::warn("Tried resizing the window of an offscreen renderer. Skipping.");
+            return;
+        }
+
         SDL_SetWindowSize(
             window_,
             static_cast<int>(window_size.x),
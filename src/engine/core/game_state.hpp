@@ -22,7 +22,7 @@ namespace engine::core {
     class GameState final {
     public:
         /// @brief Constructor; initializes the game.
-        /// @param window SDL window
+        /// @param window SDL window; may be null for an offscreen renderer
         /// @param renderer SDL renderer
         /// @param initial_state Initial state of the game. Default is Title.
         explicit GameState(SDL_Window* window, SDL_Renderer* renderer, State initial_state = State::Title);
@@ -55,7 +55,7 @@ namespace engine::core {
         }
 
     private:
-        /// @brief SDL window, used to get the window size
+        /// @brief SDL window, used to get the window size; null when rendering offscreen
         SDL_Window* window_ = nullptr;
 
         /// @brief SDL renderer for getting logical resolution
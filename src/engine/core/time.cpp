@@ -19,6 +19,10 @@ namespace engine::core {
             delta_time_ = current_delta_time;
         }
 
+        if (fixed_delta_time_ > 0.0) {
+            delta_time_ = fixed_delta_time_;
+        }
+
         last_time_ = SDL_GetTicksNS();
     }
 
@@ -43,6 +47,23 @@ namespace engine::core {
         return delta_time_;
     }
 
+    void Time::setDeltaTime(float delta_time) {
+        delta_time_ = std::max(delta_time, 0.0f);
+    }
+
+    void Time::setFixedDeltaTime(float delta_time) {
+        if (delta_time < 0.0f) {
+            spdlog::warn("Fixed delta time can't be negative. Setting to 0 (measured time).");
+            delta_time = 0.0f;
+        }
+
+        fixed_delta_time_ = delta_time;
+    }
+
+    float Time::getFixedDeltaTime() const {
+        return fixed_delta_time_;
+    }
+
     void Time::setTimeScale(float scale) {
         if (scale < 0.0) {
             spdlog::warn("Time scale can't be negative.; Clamping to 0.");
@@ -26,6 +26,23 @@ namespace engine::core {
         /// @return Unscaled delta time.
         float getUnscaledDeltaTime() const;
 
+        /// @brief Replace the measured delta time of the current frame, e.g. with a
+        /// recorded one when replaying input on a fixed clock.
+        /// @param delta_time Unscaled delta time (seconds).
+        void setDeltaTime(float delta_time);
+
+        /// @brief Advance every frame by exactly `delta_time` seconds, whatever the wall clock
+        /// measured, so a run steps the same way on any machine. Frames are still paced by the
+        /// target FPS.
+        /// @param delta_time Fixed unscaled delta time (seconds); 0 returns to measured time.
+        void setFixedDeltaTime(float delta_time);
+
+        /// @brief Get the fixed delta time. 0 means frames use the measured time.
+        float getFixedDeltaTime() const;
+
+        /// @brief Whether frames advance by the fixed delta time.
+        bool isFixedStep() const { return fixed_delta_time_ > 0.0; }
+
         /// @brief Set the time scaling factor
         /// @param scale Time scaling value (1.0 normal, <1.0 slow motion, >1.0 fast
         /// motion). Does not permit negative values.
@@ -53,6 +70,9 @@ namespace engine::core {
         /// @brief Unscaled interframe time difference (seconds).
         double delta_time_ = 0.0;
 
+        /// @brief Fixed unscaled time difference (seconds); 0 when frames use measured time.
+        double fixed_delta_time_ = 0.0;
+
         /// @brief Time scaling factor.
         double time_scale_ = 1.0;
 
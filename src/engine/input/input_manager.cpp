@@ -1,6 +1,9 @@
 #include "input_manager.hpp"
+#include "input_recording.hpp"
 #include "../core/config.hpp"
+#include <algorithm>
 #include <stdexcept>
+#include <utility>
 #include <SDL3/SDL.h>
 #include <SDL3/SDL_render.h>
 #include <spdlog/spdlog.h>
@@ -25,7 +28,7 @@ namespace engine::input {
     }
 
     void InputManager::update() {
-        for (auto& [action_name, state] : action_states_) {
+        for (auto& state : action_states_) {
             if (state == ActionState::PRESSED_THIS_FRAME) {
                 state = ActionState::HELD_DOWN;
             } else if (state == ActionState::RELEASED_THIS_FRAME) {
@@ -35,8 +38,39 @@ namespace engine::input {
 
         SDL_Event event;
         while (SDL_PollEvent(&event)) {
+            if (replay_) {
+                if (event.type == SDL_EVENT_QUIT) {
+                    should_quit_ = true;
+                }
+                continue;
+            }
+
+            if (recorder_) {
+                recorder_->recordEvent(event);
+            }
             processEvent(event);
         }
+
+        if (replay_) {
+            for (const auto& record : replay_->getFrameEvents()) {
+                processEvent(InputReplay::toEvent(record));
+            }
+        }
+    }
+
+    void InputManager::setRecorder(InputRecorder* recorder) {
+        recorder_ = recorder;
+        mouse_position_ = {0.0f, 0.0f};
+    }
+
+    void InputManager::setReplay(InputReplay* replay) {
+        replay_ = replay;
+        mouse_position_ = {0.0f, 0.0f};
+    }
+
+    std::uint64_t InputManager::getStateHash() const {
+        std::uint64_t hash = engine::utils::fnv1a64(action_states_.data(), action_states_.size() * sizeof(ActionState));
+        return engine::utils::fnv1a64(&mouse_position_, sizeof(mouse_position_), hash);
     }
 
     void InputManager::processEvent(const SDL_Event& event) {
@@ -47,12 +81,8 @@ namespace engine::input {
                 bool is_down = event.key.down;
                 bool is_repeat = event.key.repeat;
 
-                auto it = input_to_actions_map_.find(scancode);
-                if (it != input_to_actions_map_.end()) {
-                    const std::vector<std::string>& associated_actions = it->second;
-                    for (const auto& action_name : associated_actions) {
-                        updateActionState(action_name, is_down, is_repeat);
-                    }
+                if (static_cast<std::size_t>(scancode) < SCANCODE_TABLE_SIZE) {
+                    updateBoundActions(key_bindings_[scancode], is_down, is_repeat);
                 }
 
                 break;
@@ -63,12 +93,8 @@ namespace engine::input {
                 Uint32 button = event.button.button;
                 bool is_down = event.button.down;
 
-                auto it = input_to_actions_map_.find(button);
-                if (it != input_to_actions_map_.end()) {
-                    const std::vector<std::string>& associated_actions = it->second;
-                    for (const auto& action_name : associated_actions) {
-                        updateActionState(action_name, is_down, false);
-                    }
+                if (button < MOUSE_BUTTON_TABLE_SIZE) {
+                    updateBoundActions(mouse_bindings_[button], is_down, false);
                 }
 
                 mouse_position_ = {event.button.x, event.button.y};
@@ -89,25 +115,42 @@ namespace engine::input {
         }
     }
 
-    bool InputManager::isActionDown(std::string_view action_name) const {
-        if (auto it = action_states_.find(std::string(action_name)); it != action_states_.end()) {
-            return it->second == ActionState::PRESSED_THIS_FRAME || it->second == ActionState::HELD_DOWN;
+    ActionId InputManager::getActionId(std::string_view action_name) const {
+        if (auto it = action_ids_.find(action_name); it != action_ids_.end()) {
+            return it->second;
         }
-        return false;
+        return INVALID_ACTION;
     }
 
-    bool InputManager::isActionPressed(std::string_view action_name) const {
-        if (auto it = action_states_.find(std::string(action_name)); it != action_states_.end()) {
-            return it->second == ActionState::PRESSED_THIS_FRAME;
+    std::string_view InputManager::getActionName(ActionId action) const {
+        return action < action_names_.size() ? std::string_view(action_names_[action]) : std::string_view();
+    }
+
+    bool InputManager::isActionDown(ActionId action) const {
+        if (action >= action_states_.size()) {
+            return false;
         }
-        return false;
+        return action_states_[action] == ActionState::PRESSED_THIS_FRAME || action_states_[action] == ActionState::HELD_DOWN;
+    }
+
+    bool InputManager::isActionPressed(ActionId action) const {
+        return action < action_states_.size() && action_states_[action] == ActionState::PRESSED_THIS_FRAME;
+    }
+
+    bool InputManager::isActionReleased(ActionId action) const {
+        return action < action_states_.size() && action_states_[action] == ActionState::RELEASED_THIS_FRAME;
+    }
+
+    bool InputManager::isActionDown(std::string_view action_name) const {
+        return isActionDown(getActionId(action_name));
+    }
+
+    bool InputManager::isActionPressed(std::string_view action_name) const {
+        return isActionPressed(getActionId(action_name));
     }
 
     bool InputManager::isActionReleased(std::string_view action_name) const {
-        if (auto it = action_states_.find(std::string(action_name)); it != action_states_.end()) {
-            return it->second == ActionState::RELEASED_THIS_FRAME;
-        }
-        return false;
+        return isActionReleased(getActionId(action_name));
     }
 
     bool InputManager::shouldQuit() const {
@@ -136,8 +179,12 @@ namespace engine::input {
 
     void InputManager::initializeMappings(const engine::core::Config* config) {
         actions_to_keyname_map_ = config ->input_mappings_;
-        input_to_actions_map_.clear();
+        action_names_.clear();
         action_states_.clear();
+        action_ids_.clear();
+        key_bindings_.fill({});
+        mouse_bindings_.fill({});
+        bound_actions_.clear();
 
         if (actions_to_keyname_map_.find("MouseLeftClick") == actions_to_keyname_map_.end()) {
             spdlog::debug("The 'MouseLeftClick' action is not defined in config. Adding a default mapping to 'MouseLeft'");
@@ -149,25 +196,63 @@ namespace engine::input {
             actions_to_keyname_map_["MouseRightClick"] = {"MouseRight"};
         }
 
+        // The built-in actions take the fixed ids; the rest follow in name order so ids
+        // are the same from one run to the next
+        action_names_ = {"MouseLeftClick", "MouseRightClick"};
+        std::vector<std::string> other_actions;
         for (const auto& [action_name, key_names] : actions_to_keyname_map_) {
-            action_states_[action_name] = ActionState::INACTIVE;
-            spdlog::trace("Mapping actions: {}", action_name);
+            if (action_name != action_names_[MOUSE_LEFT_CLICK] && action_name != action_names_[MOUSE_RIGHT_CLICK]) {
+                other_actions.push_back(action_name);
+            }
+        }
+        std::sort(other_actions.begin(), other_actions.end());
+        action_names_.insert(action_names_.end(), other_actions.begin(), other_actions.end());
+
+        if (action_names_.size() >= INVALID_ACTION) {
+            throw std::runtime_error("InputManager: too many input actions.");
+        }
+        action_states_.assign(action_names_.size(), ActionState::INACTIVE);
+
+        // (input slot, action) pairs, grouped per slot below
+        std::vector<std::pair<std::size_t, ActionId>> key_pairs;
+        std::vector<std::pair<std::size_t, ActionId>> mouse_pairs;
+
+        for (std::size_t i = 0; i < action_names_.size(); ++i) {
+            const auto& action_name = action_names_[i];
+            auto action = static_cast<ActionId>(i);
+            action_ids_.emplace(action_name, action);
+            spdlog::trace("Mapping actions: {} (id: {})", action_name, action);
 
-            for (const auto& key_name : key_names) {
+            for (const auto& key_name : actions_to_keyname_map_[action_name]) {
                 SDL_Scancode scancode = scancodeFromString(key_name);
                 Uint32 mouse_button = mouseButtonFromString(key_name);
 
-                if (scancode != SDL_SCANCODE_UNKNOWN) {
-                    input_to_actions_map_[scancode].push_back(action_name);
+                if (scancode != SDL_SCANCODE_UNKNOWN && static_cast<std::size_t>(scancode) < SCANCODE_TABLE_SIZE) {
+                    key_pairs.emplace_back(static_cast<std::size_t>(scancode), action);
                     spdlog::trace("Mapping keys: {} (scancode: {} to action: {})", key_name, static_cast<int>(scancode), action_name);
-                } else if (mouse_button != 0) {
-                    input_to_actions_map_[mouse_button].push_back(action_name);
+                } else if (mouse_button != 0 && mouse_button < MOUSE_BUTTON_TABLE_SIZE) {
+                    mouse_pairs.emplace_back(static_cast<std::size_t>(mouse_button), action);
                     spdlog::trace("Mapping mouse buttons: {} (button ID: {} to action: {})", key_name, static_cast<int>(mouse_button), action_name);
                 } else {
                     spdlog::warn("Input mapping warning: Unknown key or button name '{}' for action '{}'", key_name, action_name);
                 }
             }
         }
+
+        auto build_table = [this](auto& pairs, auto& table) {
+            std::sort(pairs.begin(), pairs.end());
+            for (const auto& [slot, action] : pairs) {
+                BindingRange& range = table[slot];
+                if (range.count == 0) {
+                    range.first = static_cast<std::uint16_t>(bound_actions_.size());
+                }
+                bound_actions_.push_back(action);
+                ++range.count;
+            }
+        };
+
+        build_table(key_pairs, key_bindings_);
+        build_table(mouse_pairs, mouse_bindings_);
     }
 
     SDL_Scancode InputManager::scancodeFromString(std::string_view key_name) {
@@ -183,20 +268,23 @@ namespace engine::input {
         return 0;
     }
 
-    void InputManager::updateActionState(std::string_view action_name, bool is_input_active, bool is_repeat_event) {
-        auto it = action_states_.find(std::string(action_name));
-        if (it == action_states_.end()) {
-            return;
+    void InputManager::updateBoundActions(BindingRange range, bool is_input_active, bool is_repeat_event) {
+        for (std::uint16_t i = 0; i < range.count; ++i) {
+            updateActionState(bound_actions_[range.first + i], is_input_active, is_repeat_event);
         }
+    }
+
+    void InputManager::updateActionState(ActionId action, bool is_input_active, bool is_repeat_event) {
+        ActionState& state = action_states_[action];
 
         if (is_input_active) {
             if (is_repeat_event) {
-                it->second = ActionState::HELD_DOWN;
+                state = ActionState::HELD_DOWN;
             } else {
-                it->second = ActionState::PRESSED_THIS_FRAME;
+                state = ActionState::PRESSED_THIS_FRAME;
             }
         } else {
-            it->second = ActionState::RELEASED_THIS_FRAME;
+            state = ActionState::RELEASED_THIS_FRAME;
         }
     }
 
@@ -1,11 +1,14 @@
 #ifndef INPUT_MANAGER_HPP_
 #define INPUT_MANAGER_HPP_
 
+#include "../utils/hash.hpp"
+#include <array>
+#include <cstdint>
+#include <functional>
 #include <string>
 #include <string_view>
 #include <unordered_map>
 #include <vector>
-#include <variant>
 #include <SDL3/SDL_render.h>
 #include <glm/vec2.hpp>
 
@@ -14,6 +17,8 @@ namespace engine::core {
 }
 
 namespace engine::input {
+    class InputRecorder;
+    class InputReplay;
 
     enum class ActionState {
         INACTIVE,
@@ -22,6 +27,15 @@ namespace engine::input {
         RELEASED_THIS_FRAME,
     };
 
+    /// @brief Dense index of an action, resolved once with InputManager::getActionId() so
+    /// per-frame queries are a single array read.
+    using ActionId = std::uint16_t;
+    inline constexpr ActionId INVALID_ACTION = 0xFFFF;
+
+    /// @brief Actions that always exist, with fixed ids.
+    inline constexpr ActionId MOUSE_LEFT_CLICK = 0;
+    inline constexpr ActionId MOUSE_RIGHT_CLICK = 1;
+
     class InputManager {
     public:
         InputManager(
@@ -32,12 +46,33 @@ namespace engine::input {
         void update();
         bool shouldQuit() const;
 
+        /// @brief Resolve an action name; INVALID_ACTION if it is not mapped. Callers
+        /// querying every frame should resolve once and keep the id.
+        ActionId getActionId(std::string_view action_name) const;
+        std::string_view getActionName(ActionId action) const;
+        std::size_t getActionCount() const { return action_states_.size(); }
+
+        bool isActionDown(ActionId action) const;
+        bool isActionPressed(ActionId action) const;
+        bool isActionReleased(ActionId action) const;
+
         bool isActionDown(std::string_view action_name) const;
         bool isActionPressed(std::string_view action_name) const;
         bool isActionReleased(std::string_view action_name) const;
 
         void setShouldQuit(bool should_quit);
 
+        /// @brief Record every input event polled from now on (nullptr to stop). Set
+        /// before the first update(), since recording and replay both start from a
+        /// neutral mouse position.
+        void setRecorder(InputRecorder* recorder);
+        /// @brief Take input from a replay instead of the live events; only quit requests
+        /// are still taken from SDL.
+        void setReplay(InputReplay* replay);
+
+        /// @brief Hash of the action states and mouse position, for comparing runs.
+        std::uint64_t getStateHash() const;
+
         glm::vec2 getMousePosition() const;
         glm::vec2 getLogicalMousePosition() const;
 
@@ -45,15 +80,36 @@ namespace engine::input {
         SDL_Renderer* sdl_renderer_;
         bool should_quit_ = false;
         glm::vec2 mouse_position_;
+        InputRecorder* recorder_ = nullptr;
+        InputReplay* replay_ = nullptr;
+
+        /// @brief Slice of bound_actions_ triggered by one key or mouse button.
+        struct BindingRange {
+            std::uint16_t first = 0;
+            std::uint16_t count = 0;
+        };
+
+        static constexpr std::size_t SCANCODE_TABLE_SIZE = 512;
+        static constexpr std::size_t MOUSE_BUTTON_TABLE_SIZE = 8;
 
         std::unordered_map<std::string, std::vector<std::string>> actions_to_keyname_map_;
-        std::unordered_map<std::variant<SDL_Scancode, Uint32>, std::vector<std::string>> input_to_actions_map_;
-        std::unordered_map<std::string, ActionState> action_states_;
+
+        /// @brief Indexed by ActionId.
+        std::vector<std::string> action_names_;
+        std::vector<ActionState> action_states_;
+        std::unordered_map<std::string, ActionId, engine::utils::StringHash, std::equal_to<>> action_ids_;
+
+        /// @brief Inputs map straight to their actions: key and button tables index into
+        /// one flat list of action ids.
+        std::array<BindingRange, SCANCODE_TABLE_SIZE> key_bindings_{};
+        std::array<BindingRange, MOUSE_BUTTON_TABLE_SIZE> mouse_bindings_{};
+        std::vector<ActionId> bound_actions_;
 
         void processEvent(const SDL_Event& event);
         void initializeMappings(const engine::core::Config* config);
 
-        void updateActionState(std::string_view action_name, bool is_input_active, bool is_repeat_event);
+        void updateActionState(ActionId action, bool is_input_active, bool is_repeat_event);
+        void updateBoundActions(BindingRange range, bool is_input_active, bool is_repeat_event);
         SDL_Scancode scancodeFromString(std::string_view key_name);
         Uint32 mouseButtonFromString(std::string_view button_name);
     };
@@ -0,0 +1,249 @@
+#include "input_recording.hpp"
+#include "../utils/hash.hpp"
+#include <SDL3/SDL.h>
+#include <cstring>
+#include <spdlog/spdlog.h>
+#include <stdexcept>
+
+namespace engine::input {
+
+    using Format = InputRecordingFormat;
+
+    // --- InputRecorder ---
+
+    InputRecorder::InputRecorder(std::string_view file_path)
+        : out_(std::string(file_path), std::ios::binary | std::ios::trunc)
+        , file_path_(file_path)
+    {
+        if (!out_.is_open()) {
+            throw std::runtime_error("InputRecorder: unable to open '" + file_path_ + "' for writing.");
+        }
+
+        std::memcpy(header_.magic, Format::MAGIC, sizeof(Format::MAGIC));
+        header_.version = Format::VERSION;
+        header_.trace_hash = engine::utils::FNV1A_OFFSET_BASIS;
+
+        // Placeholder header, rewritten with the final counts by finish()
+        out_.write(reinterpret_cast<const char*>(&header_), sizeof(header_));
+        spdlog::info("Recording input to '{}'.", file_path_);
+    }
+
+    InputRecorder::~InputRecorder() {
+        finish();
+    }
+
+    void InputRecorder::beginFrame(float delta_time) {
+        frame_ = {};
+        frame_.delta_time = delta_time;
+        frame_events_.clear();
+    }
+
+    void InputRecorder::recordEvent(const SDL_Event& event) {
+        Format::EventRecord record{};
+        record.timestamp_ns = event.common.timestamp;
+
+        switch (event.type) {
+            case SDL_EVENT_KEY_DOWN:
+            case SDL_EVENT_KEY_UP:
+                record.type = Format::EventType::KEY;
+                record.down = event.key.down;
+                record.repeat = event.key.repeat;
+                record.scancode = static_cast<std::uint16_t>(event.key.scancode);
+                break;
+
+            case SDL_EVENT_MOUSE_BUTTON_DOWN:
+            case SDL_EVENT_MOUSE_BUTTON_UP:
+                record.type = Format::EventType::MOUSE_BUTTON;
+                record.down = event.button.down;
+                record.button = event.button.button;
+                record.x = event.button.x;
+                record.y = event.button.y;
+                break;
+
+            case SDL_EVENT_MOUSE_MOTION:
+                record.type = Format::EventType::MOUSE_MOTION;
+                record.x = event.motion.x;
+                record.y = event.motion.y;
+                break;
+
+            case SDL_EVENT_QUIT:
+                record.type = Format::EventType::QUIT;
+                break;
+
+            default:
+                return;
+        }
+
+        frame_events_.push_back(record);
+    }
+
+    void InputRecorder::endFrame(std::uint64_t state_hash) {
+        if (!out_.is_open()) {
+            return;
+        }
+
+        frame_.event_count = static_cast<std::uint32_t>(frame_events_.size());
+        frame_.state_hash = state_hash;
+        out_.write(reinterpret_cast<const char*>(&frame_), sizeof(frame_));
+        out_.write(
+            reinterpret_cast<const char*>(frame_events_.data()),
+            static_cast<std::streamsize>(frame_events_.size() * sizeof(Format::EventRecord))
+        );
+
+        ++header_.frame_count;
+        header_.event_count += frame_.event_count;
+        header_.trace_hash = engine::utils::fnv1a64(&state_hash, sizeof(state_hash), header_.trace_hash);
+    }
+
+    void InputRecorder::finish() {
+        if (!out_.is_open()) {
+            return;
+        }
+
+        out_.seekp(0);
+        out_.write(reinterpret_cast<const char*>(&header_), sizeof(header_));
+        out_.close();
+
+        if (!out_) {
+            spdlog::error("Error writing input recording '{}'.", file_path_);
+            return;
+        }
+        spdlog::info(
+            "Recorded {} frames and {} input events to '{}'.",
+            header_.frame_count,
+            header_.event_count,
+            file_path_
+        );
+    }
+
+    // --- InputReplay ---
+
+    InputReplay::InputReplay(std::string_view file_path) {
+        std::ifstream in(std::string(file_path), std::ios::binary | std::ios::ate);
+        if (!in.is_open()) {
+            throw std::runtime_error("InputReplay: unable to open '" + std::string(file_path) + "'.");
+        }
+        auto file_size = static_cast<std::uint64_t>(in.tellg());
+        in.seekg(0);
+
+        Format::Header header{};
+        in.read(reinterpret_cast<char*>(&header), sizeof(header));
+        if (!in || std::memcmp(header.magic, Format::MAGIC, sizeof(Format::MAGIC)) != 0 ||
+            header.version != Format::VERSION) {
+            throw std::runtime_error("InputReplay: '" + std::string(file_path) + "' is not an input recording.");
+        }
+
+        // The counts size the buffers below: they must describe exactly the bytes present
+        std::uint64_t expected_size = sizeof(header) +
+            std::uint64_t{header.frame_count} * sizeof(Format::FrameRecord) +
+            std::uint64_t{header.event_count} * sizeof(Format::EventRecord);
+        if (expected_size != file_size) {
+            throw std::runtime_error(
+                "InputReplay: '" + std::string(file_path) + "' is corrupt: its frame and event counts need " +
+                std::to_string(expected_size) + " bytes, the file has " + std::to_string(file_size) + "."
+            );
+        }
+
+        frames_.reserve(header.frame_count);
+        events_.reserve(header.event_count);
+
+        for (std::uint32_t i = 0; i < header.frame_count; ++i) {
+            Frame frame{};
+            in.read(reinterpret_cast<char*>(&frame.record), sizeof(frame.record));
+            frame.first_event = events_.size();
+
+            if (!in || frame.record.event_count > header.event_count - events_.size()) {
+                throw std::runtime_error("InputReplay: '" + std::string(file_path) + "' is corrupt: frame " +
+                                         std::to_string(i) + " has more events than the recording.");
+            }
+
+            events_.resize(events_.size() + frame.record.event_count);
+            in.read(
+                reinterpret_cast<char*>(events_.data() + frame.first_event),
+                static_cast<std::streamsize>(frame.record.event_count * sizeof(Format::EventRecord))
+            );
+
+            if (!in) {
+                throw std::runtime_error("InputReplay: '" + std::string(file_path) + "' is truncated.");
+            }
+            frames_.push_back(frame);
+        }
+
+        if (events_.size() != header.event_count) {
+            throw std::runtime_error("InputReplay: '" + std::string(file_path) + "' is corrupt: its frames hold " +
+                                     std::to_string(events_.size()) + " of " + std::to_string(header.event_count) + " events.");
+        }
+
+        current_ = frames_.size();
+        spdlog::info("Replaying {} frames and {} input events from '{}'.", frames_.size(), events_.size(), file_path);
+    }
+
+    bool InputReplay::nextFrame() {
+        if (!started_) {
+            started_ = true;
+            current_ = 0;
+        } else if (current_ < frames_.size()) {
+            ++current_;
+        }
+        return current_ < frames_.size();
+    }
+
+    float InputReplay::getFrameDelta() const {
+        return current_ < frames_.size() ? frames_[current_].record.delta_time : 0.0f;
+    }
+
+    std::span<const Format::EventRecord> InputReplay::getFrameEvents() const {
+        if (current_ >= frames_.size()) {
+            return {};
+        }
+
+        const Frame& frame = frames_[current_];
+        return {events_.data() + frame.first_event, frame.record.event_count};
+    }
+
+    void InputReplay::endFrame(std::uint64_t state_hash) {
+        if (current_ >= frames_.size() || first_divergent_frame_ >= 0) {
+            return;
+        }
+
+        if (frames_[current_].record.state_hash != state_hash) {
+            first_divergent_frame_ = static_cast<std::int64_t>(current_);
+            spdlog::warn("Replay diverged from the recording at frame {}.", current_);
+        }
+    }
+
+    SDL_Event InputReplay::toEvent(const Format::EventRecord& record) {
+        SDL_Event event{};
+
+        switch (record.type) {
+            case Format::EventType::KEY:
+                event.type = record.down ? SDL_EVENT_KEY_DOWN : SDL_EVENT_KEY_UP;
+                event.key.down = record.down != 0;
+                event.key.repeat = record.repeat != 0;
+                event.key.scancode = static_cast<SDL_Scancode>(record.scancode);
+                break;
+
+            case Format::EventType::MOUSE_BUTTON:
+                event.type = record.down ? SDL_EVENT_MOUSE_BUTTON_DOWN : SDL_EVENT_MOUSE_BUTTON_UP;
+                event.button.down = record.down != 0;
+                event.button.button = record.button;
+                event.button.x = record.x;
+                event.button.y = record.y;
+                break;
+
+            case Format::EventType::MOUSE_MOTION:
+                event.type = SDL_EVENT_MOUSE_MOTION;
+                event.motion.x = record.x;
+                event.motion.y = record.y;
+                break;
+
+            case Format::EventType::QUIT:
+                event.type = SDL_EVENT_QUIT;
+                break;
+        }
+
+        event.common.timestamp = record.timestamp_ns;
+        return event;
+    }
+
+} // namespace engine::input
@@ -0,0 +1,138 @@
+#ifndef INPUT_RECORDING_HPP_
+#define INPUT_RECORDING_HPP_
+
+#include <cstdint>
+#include <fstream>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+union SDL_Event;
+
+namespace engine::input {
+
+    /// @brief Binary layout of an input recording (".sinp").
+    ///
+    /// A 32-byte header is followed by one FrameRecord per frame, each immediately
+    /// followed by that frame's EventRecords. Every frame stores the hash of the action
+    /// states it produced, so a replay can report the first frame where it diverges.
+    struct InputRecordingFormat {
+        static constexpr char MAGIC[4] = {'S', 'I', 'N', 'P'};
+        static constexpr std::uint32_t VERSION = 1;
+
+        struct Header {
+            char magic[4];
+            std::uint32_t version;
+            std::uint32_t frame_count;
+            std::uint32_t event_count;
+            std::uint64_t trace_hash;
+            std::uint8_t reserved[8];
+        };
+
+        struct FrameRecord {
+            float delta_time;
+            std::uint32_t event_count;
+            std::uint64_t state_hash;
+        };
+
+        enum class EventType : std::uint8_t {
+            KEY = 1,
+            MOUSE_BUTTON = 2,
+            MOUSE_MOTION = 3,
+            QUIT = 4,
+        };
+
+        struct EventRecord {
+            std::uint64_t timestamp_ns;
+            EventType type;
+            std::uint8_t down;
+            std::uint8_t repeat;
+            std::uint8_t button;
+            std::uint16_t scancode;
+            std::uint16_t reserved;
+            float x;
+            float y;
+        };
+
+        static_assert(sizeof(Header) == 32, "Input recording header must be tightly packed.");
+        static_assert(sizeof(FrameRecord) == 16, "Input frame record must be tightly packed.");
+        static_assert(sizeof(EventRecord) == 24, "Input event record must be tightly packed.");
+    };
+
+    /// @brief Writes the input events and frame deltas of a session to a recording.
+    /// Construction failure will throw an exception.
+    class InputRecorder final {
+    public:
+        explicit InputRecorder(std::string_view file_path);
+        ~InputRecorder();
+
+        InputRecorder(const InputRecorder&) = delete;
+        InputRecorder& operator=(const InputRecorder&) = delete;
+        InputRecorder(InputRecorder&&) = delete;
+        InputRecorder& operator=(InputRecorder&&) = delete;
+
+        void beginFrame(float delta_time);
+        /// @brief Record an event of the current frame; events that do not affect input
+        /// are ignored.
+        void recordEvent(const SDL_Event& event);
+        /// @param state_hash Hash of the action states after this frame's events.
+        void endFrame(std::uint64_t state_hash);
+
+        /// @brief Write the header and close the file. Called by the destructor.
+        void finish();
+
+        std::uint32_t getFrameCount() const { return header_.frame_count; }
+
+    private:
+        std::ofstream out_;
+        std::string file_path_;
+        InputRecordingFormat::Header header_{};
+        InputRecordingFormat::FrameRecord frame_{};
+        std::vector<InputRecordingFormat::EventRecord> frame_events_;
+    };
+
+    /// @brief Plays a recording back one frame at a time. The whole file is read up
+    /// front. Construction failure will throw an exception.
+    class InputReplay final {
+    public:
+        explicit InputReplay(std::string_view file_path);
+
+        InputReplay(const InputReplay&) = delete;
+        InputReplay& operator=(const InputReplay&) = delete;
+        InputReplay(InputReplay&&) = delete;
+        InputReplay& operator=(InputReplay&&) = delete;
+
+        /// @brief Advance to the next frame; false once the recording is exhausted.
+        bool nextFrame();
+        float getFrameDelta() const;
+        std::span<const InputRecordingFormat::EventRecord> getFrameEvents() const;
+
+        /// @brief Compare the action states after the current frame with the recording.
+        void endFrame(std::uint64_t state_hash);
+
+        /// @brief Whether every replayed frame reproduced the recorded action states.
+        bool matchesRecording() const { return first_divergent_frame_ < 0; }
+        /// @brief First frame whose action states differed, or -1.
+        std::int64_t getFirstDivergentFrame() const { return first_divergent_frame_; }
+        std::uint32_t getFrameCount() const { return static_cast<std::uint32_t>(frames_.size()); }
+
+        static SDL_Event toEvent(const InputRecordingFormat::EventRecord& record);
+
+    private:
+        struct Frame {
+            InputRecordingFormat::FrameRecord record;
+            std::size_t first_event;
+        };
+
+        std::vector<Frame> frames_;
+        std::vector<InputRecordingFormat::EventRecord> events_;
+        /// @brief Index of the current frame; frames_.size() before the first nextFrame().
+        std::size_t current_ = 0;
+        bool started_ = false;
+        std::int64_t first_divergent_frame_ = -1;
+    };
+
+} // namespace engine::input
+
+#endif // INPUT_RECORDING_HPP_
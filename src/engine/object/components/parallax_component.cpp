@@ -0,0 +1,51 @@
+#include "parallax_component.hpp"
+#include "transform_component.hpp"
+#include "../game_object.hpp"
+#include "../../core/context.hpp"
+#include "../../render/renderer.hpp"
+#include <spdlog/spdlog.h>
+
+namespace engine::object::components {
+
+    ParallaxComponent::ParallaxComponent(
+        std::string_view texture_id,
+        const glm::vec2& scroll_factor,
+        const glm::bvec2& repeat
+    )
+        : sprite_(texture_id)
+        , scroll_factor_(scroll_factor)
+        , repeat_(repeat)
+    {}
+
+    void ParallaxComponent::init() {
+        if (!owner_) {
+            spdlog::error("ParallaxComponent initialized without an owner GameObject.");
+            return;
+        }
+
+        transform_ = owner_->getComponent<TransformComponent>();
+        if (!transform_) {
+            spdlog::warn(
+                "GameObject '{}' has a ParallaxComponent but no TransformComponent; adding a default one.",
+                owner_->getName()
+            );
+            transform_ = owner_->addComponent<TransformComponent>();
+        }
+    }
+
+    void ParallaxComponent::render(engine::core::Context& context) {
+        if (is_hidden_ || !transform_) {
+            return;
+        }
+
+        context.getRenderer().drawParallax(
+            context.getCamera(),
+            sprite_,
+            transform_->getPosition(),
+            scroll_factor_,
+            repeat_,
+            transform_->getScale()
+        );
+    }
+
+} // namespace engine::object::components
@@ -0,0 +1,56 @@
+#ifndef PARALLAX_COMPONENT_HPP_
+#define PARALLAX_COMPONENT_HPP_
+
+#include "../component.hpp"
+#include "../../render/sprite.hpp"
+#include "../../utils/math.hpp"
+#include <string_view>
+
+namespace engine::object::components {
+    class TransformComponent;
+
+    /// @brief One background layer that scrolls relative to the camera.
+    ///
+    /// The owner's TransformComponent gives the layer's anchor position and scale. A
+    /// scroll factor of (0, 0) pins the layer to the screen and (1, 1) moves it with the
+    /// world; multiple layers are stacked in the order their GameObjects are added.
+    class ParallaxComponent final : public Component {
+        friend class engine::object::GameObject;
+
+    public:
+        ParallaxComponent(
+            std::string_view texture_id,
+            const glm::vec2& scroll_factor,
+            const glm::bvec2& repeat = {true, true}
+        );
+
+        ParallaxComponent(const ParallaxComponent&) = delete;
+        ParallaxComponent& operator=(const ParallaxComponent&) = delete;
+        ParallaxComponent(ParallaxComponent&&) = delete;
+        ParallaxComponent& operator=(ParallaxComponent&&) = delete;
+
+        const engine::render::Sprite& getSprite() const { return sprite_; }
+        const glm::vec2& getScrollFactor() const { return scroll_factor_; }
+        const glm::bvec2& getRepeat() const { return repeat_; }
+        bool isHidden() const { return is_hidden_; }
+
+        void setSprite(const engine::render::Sprite& sprite) { sprite_ = sprite; }
+        void setScrollFactor(const glm::vec2& scroll_factor) { scroll_factor_ = scroll_factor; }
+        void setRepeat(const glm::bvec2& repeat) { repeat_ = repeat; }
+        void setHidden(bool hidden) { is_hidden_ = hidden; }
+
+    private:
+        engine::render::Sprite sprite_;
+        glm::vec2 scroll_factor_;
+        glm::bvec2 repeat_;
+        TransformComponent* transform_ = nullptr;
+        bool is_hidden_ = false;
+
+        void init() override;
+        void update(float, engine::core::Context&) override {}
+        void render(engine::core::Context& context) override;
+    };
+
+} // namespace engine::object::components
+
+#endif // PARALLAX_COMPONENT_HPP_
@@ -0,0 +1,111 @@
+#include "physics_component.hpp"
+#include "transform_component.hpp"
+#include "../game_object.hpp"
+#include "../../physics/physics_engine.hpp"
+#include <spdlog/spdlog.h>
+
+namespace engine::object::components {
+
+    PhysicsComponent::PhysicsComponent(engine::physics::PhysicsEngine& physics_engine, bool use_gravity, float mass)
+        : physics_engine_(physics_engine)
+        , use_gravity_(use_gravity)
+    {
+        setMass(mass);
+    }
+
+    PhysicsComponent::~PhysicsComponent() {
+        physics_engine_.unregisterComponent(this);
+    }
+
+    glm::vec2 PhysicsComponent::getVelocity() const {
+        if (body_index_ == UNREGISTERED) {
+            return {0.0f, 0.0f};
+        }
+        return physics_engine_.getBodyVelocity(body_index_);
+    }
+
+    void PhysicsComponent::setVelocity(const glm::vec2& velocity) {
+        if (body_index_ != UNREGISTERED) {
+            physics_engine_.setBodyVelocity(body_index_, velocity);
+        }
+    }
+
+    void PhysicsComponent::addForce(const glm::vec2& force) {
+        if (body_index_ != UNREGISTERED) {
+            physics_engine_.addBodyForce(body_index_, force);
+        }
+    }
+
+    void PhysicsComponent::setMass(float mass) {
+        if (!(mass > 0.0f)) {
+            spdlog::warn("PhysicsComponent: mass must be positive, got {}; using 1.", mass);
+            mass = 1.0f;
+        }
+        mass_ = mass;
+        physics_engine_.refreshBody(this);
+    }
+
+    void PhysicsComponent::setUseGravity(bool use_gravity) {
+        use_gravity_ = use_gravity;
+        physics_engine_.refreshBody(this);
+    }
+
+    void PhysicsComponent::setEnabled(bool enabled) {
+        enabled_ = enabled;
+        physics_engine_.refreshBody(this);
+    }
+
+    void PhysicsComponent::setStatic(bool is_static) {
+        is_static_ = is_static;
+        if (is_static) {
+            setVelocity({0.0f, 0.0f});
+        }
+        physics_engine_.refreshBody(this);
+    }
+
+    void PhysicsComponent::setCollider(const glm::vec2& size, const glm::vec2& offset) {
+        collider_size_ = size;
+        collider_offset_ = offset;
+        physics_engine_.refreshBody(this);
+    }
+
+    void PhysicsComponent::removeCollider() {
+        collider_size_ = {0.0f, 0.0f};
+        physics_engine_.refreshBody(this);
+    }
+
+    engine::utils::Rect PhysicsComponent::getColliderBounds() const {
+        if (!transform_) {
+            return engine::utils::Rect{collider_offset_, collider_size_};
+        }
+
+        const glm::vec2& scale = transform_->getScale();
+        return engine::utils::Rect{
+            transform_->getPosition() + collider_offset_ * scale,
+            collider_size_ * glm::abs(scale)
+        };
+    }
+
+    void PhysicsComponent::init() {
+        if (!owner_) {
+            spdlog::error("PhysicsComponent initialized without an owner GameObject.");
+            return;
+        }
+
+        transform_ = owner_->getComponent<TransformComponent>();
+        if (!transform_) {
+            spdlog::warn(
+                "GameObject '{}' has a PhysicsComponent but no TransformComponent; adding a default one.",
+                owner_->getName()
+            );
+            transform_ = owner_->addComponent<TransformComponent>();
+        }
+
+        physics_engine_.registerComponent(this);
+    }
+
+    void PhysicsComponent::clean() {
+        physics_engine_.unregisterComponent(this);
+    }
+
+} // namespace engine::object::components
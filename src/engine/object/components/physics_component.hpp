@@ -0,0 +1,94 @@
+#ifndef PHYSICS_COMPONENT_HPP_
+#define PHYSICS_COMPONENT_HPP_
+
+#include "../component.hpp"
+#include "../../utils/math.hpp"
+#include <cstdint>
+#include <limits>
+#include <glm/vec2.hpp>
+
+namespace engine::physics {
+    class PhysicsEngine;
+}
+
+namespace engine::object::components {
+    class TransformComponent;
+
+    /// @brief Makes the owner a body of the PhysicsEngine: it moves the owner's
+    /// TransformComponent by its velocity and, when a collider is set, collides with other
+    /// bodies.
+    ///
+    /// The body's motion state (velocity, forces) lives in the engine's arrays; the
+    /// component is its handle and holds the settings. The engine reads the transform at the
+    /// start of each step and writes it back at the end, so moving the transform between
+    /// steps teleports the body. The collider is an axis-aligned box at the transform's
+    /// position plus `offset`, both scaled with the transform. A body without a collider
+    /// moves but never collides; a static body collides but never moves.
+    class PhysicsComponent final : public Component {
+        friend class engine::object::GameObject;
+        friend class engine::physics::PhysicsEngine;
+
+    public:
+        /// @param physics_engine Engine the body registers with when added to an object
+        /// @param use_gravity Whether gravity accelerates the body
+        /// @param mass Mass of the body; must be positive
+        PhysicsComponent(engine::physics::PhysicsEngine& physics_engine, bool use_gravity = true, float mass = 1.0f);
+        ~PhysicsComponent() override;
+
+        PhysicsComponent(const PhysicsComponent&) = delete;
+        PhysicsComponent& operator=(const PhysicsComponent&) = delete;
+        PhysicsComponent(PhysicsComponent&&) = delete;
+        PhysicsComponent& operator=(PhysicsComponent&&) = delete;
+
+        /// @brief Velocity in pixels per second; zero while the body is not registered.
+        glm::vec2 getVelocity() const;
+        float getMass() const { return mass_; }
+        bool isUsingGravity() const { return use_gravity_; }
+        bool isEnabled() const { return enabled_; }
+        bool isStatic() const { return is_static_; }
+        TransformComponent* getTransform() const { return transform_; }
+
+        void setVelocity(const glm::vec2& velocity);
+        /// @brief Push the body during the next step only.
+        void addForce(const glm::vec2& force);
+        void setMass(float mass);
+        void setUseGravity(bool use_gravity);
+        void setEnabled(bool enabled);
+        /// @brief Static bodies have infinite mass: they stop, and contacts never move them.
+        void setStatic(bool is_static);
+
+        /// @brief Give the body a box collider of `size`, offset from its position.
+        void setCollider(const glm::vec2& size, const glm::vec2& offset = {0.0f, 0.0f});
+        void removeCollider();
+        bool hasCollider() const { return collider_size_.x > 0.0f && collider_size_.y > 0.0f; }
+        const glm::vec2& getColliderSize() const { return collider_size_; }
+        const glm::vec2& getColliderOffset() const { return collider_offset_; }
+
+        /// @brief World-space bounds of the collider.
+        engine::utils::Rect getColliderBounds() const;
+
+    private:
+        static constexpr std::uint32_t UNREGISTERED = std::numeric_limits<std::uint32_t>::max();
+
+        engine::physics::PhysicsEngine& physics_engine_;
+        TransformComponent* transform_ = nullptr;
+
+        float mass_ = 1.0f;
+        bool use_gravity_ = true;
+        bool enabled_ = true;
+        bool is_static_ = false;
+
+        glm::vec2 collider_size_ = {0.0f, 0.0f};
+        glm::vec2 collider_offset_ = {0.0f, 0.0f};
+
+        /// @brief Index of the body in the engine's arrays.
+        std::uint32_t body_index_ = UNREGISTERED;
+
+        void init() override;
+        void update(float, engine::core::Context&) override {}
+        void clean() override;
+    };
+
+} // namespace engine::object::components
+
+#endif // PHYSICS_COMPONENT_HPP_
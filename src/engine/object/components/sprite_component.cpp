@@ -0,0 +1,112 @@
+#include "sprite_component.hpp"
+#include "transform_component.hpp"
+#include "../game_object.hpp"
+#include "../../core/context.hpp"
+#include "../../render/renderer.hpp"
+#include "../../render/sprite_index.hpp"
+#include "../../resource/resource_manager.hpp"
+#include <spdlog/spdlog.h>
+
+namespace engine::object::components {
+
+    SpriteComponent::SpriteComponent(
+        std::string_view texture_id,
+        engine::resource::ResourceManager& resource_manager,
+        const std::optional<SDL_FRect>& source_rect,
+        bool is_flipped
+    )
+        : sprite_(texture_id, source_rect, is_flipped)
+        , resource_manager_(resource_manager)
+    {
+        updateSpriteSize();
+    }
+
+    SpriteComponent::~SpriteComponent() {
+        if (index_) {
+            index_->remove(this);
+        }
+    }
+
+    void SpriteComponent::setTextureId(std::string_view texture_id) {
+        sprite_.setTextureId(texture_id);
+        updateSpriteSize();
+    }
+
+    void SpriteComponent::setSourceRect(const std::optional<SDL_FRect>& source_rect) {
+        sprite_.setSourceRect(source_rect);
+        updateSpriteSize();
+    }
+
+    engine::utils::Rect SpriteComponent::getWorldBounds() const {
+        if (!transform_) {
+            return engine::utils::Rect{{0.0f, 0.0f}, sprite_size_};
+        }
+
+        glm::vec2 scale = glm::abs(transform_->getScale());
+        return engine::utils::Rect{transform_->getPosition(), sprite_size_ * scale};
+    }
+
+    void SpriteComponent::draw(engine::core::Context& context) const {
+        if (is_hidden_ || !transform_) {
+            return;
+        }
+
+        context.getRenderer().drawSprite(
+            context.getCamera(),
+            sprite_,
+            transform_->getPosition(),
+            transform_->getScale(),
+            transform_->getRotation()
+        );
+    }
+
+    void SpriteComponent::updateSpriteSize() {
+        const auto& source_rect = sprite_.getSourceRect();
+        if (source_rect.has_value()) {
+            sprite_size_ = {source_rect->w, source_rect->h};
+        } else {
+            sprite_size_ = resource_manager_.getTextureSize(sprite_.getTextureId());
+        }
+    }
+
+    void SpriteComponent::init() {
+        if (!owner_) {
+            spdlog::error("SpriteComponent initialized without an owner GameObject.");
+            return;
+        }
+
+        transform_ = owner_->getComponent<TransformComponent>();
+        if (!transform_) {
+            spdlog::warn(
+                "GameObject '{}' has a SpriteComponent but no TransformComponent; adding a default one.",
+                owner_->getName()
+            );
+            transform_ = owner_->addComponent<TransformComponent>();
+        }
+    }
+
+    void SpriteComponent::update(float, engine::core::Context&) {
+        if (!index_) {
+            return;
+        }
+
+        engine::utils::Rect bounds = getWorldBounds();
+        if (bounds.position != indexed_bounds_.position || bounds.size != indexed_bounds_.size) {
+            index_->update(this);
+        }
+    }
+
+    void SpriteComponent::render(engine::core::Context& context) {
+        // Indexed sprites are drawn by the scene after culling
+        if (!index_) {
+            draw(context);
+        }
+    }
+
+    void SpriteComponent::clean() {
+        if (index_) {
+            index_->remove(this);
+        }
+    }
+
+} // namespace engine::object::components
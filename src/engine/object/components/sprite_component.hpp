@@ -0,0 +1,87 @@
+#ifndef SPRITE_COMPONENT_HPP_
+#define SPRITE_COMPONENT_HPP_
+
+#include "../component.hpp"
+#include "../../render/sprite.hpp"
+#include "../../utils/math.hpp"
+#include "../../utils/spatial_grid.hpp"
+#include <optional>
+#include <string_view>
+
+namespace engine::resource {
+    class ResourceManager;
+}
+
+namespace engine::render {
+    class SpriteIndex;
+}
+
+namespace engine::object::components {
+    class TransformComponent;
+
+    /// @brief Draws a sprite at the owner's TransformComponent in world space.
+    ///
+    /// When the owning GameObject belongs to a scene, the component is registered with
+    /// the scene's SpriteIndex and only drawn when the index reports it as visible.
+    /// Otherwise it draws itself from render() and relies on per-sprite viewport culling.
+    class SpriteComponent final : public Component {
+        friend class engine::object::GameObject;
+        friend class engine::render::SpriteIndex;
+
+    public:
+        SpriteComponent(
+            std::string_view texture_id,
+            engine::resource::ResourceManager& resource_manager,
+            const std::optional<SDL_FRect>& source_rect = std::nullopt,
+            bool is_flipped = false
+        );
+
+        ~SpriteComponent() override;
+
+        SpriteComponent(const SpriteComponent&) = delete;
+        SpriteComponent& operator=(const SpriteComponent&) = delete;
+        SpriteComponent(SpriteComponent&&) = delete;
+        SpriteComponent& operator=(SpriteComponent&&) = delete;
+
+        const engine::render::Sprite& getSprite() const { return sprite_; }
+        const glm::vec2& getSpriteSize() const { return sprite_size_; }
+        TransformComponent* getTransform() const { return transform_; }
+        bool isHidden() const { return is_hidden_; }
+
+        void setHidden(bool hidden) { is_hidden_ = hidden; }
+        void setFlipped(bool flipped) { sprite_.setFlipped(flipped); }
+        void setTextureId(std::string_view texture_id);
+        void setSourceRect(const std::optional<SDL_FRect>& source_rect);
+
+        /// @brief World-space bounds of the sprite (position and scaled size).
+        engine::utils::Rect getWorldBounds() const;
+
+        /// @brief Submit the sprite to the renderer. Called by the scene for sprites the
+        /// index reports as visible.
+        void draw(engine::core::Context& context) const;
+
+    private:
+        engine::render::Sprite sprite_;
+        engine::resource::ResourceManager& resource_manager_;
+        TransformComponent* transform_ = nullptr;
+        glm::vec2 sprite_size_ = {0.0f, 0.0f};
+        bool is_hidden_ = false;
+
+        /// @brief Non-owned index this sprite is registered with, if any.
+        engine::render::SpriteIndex* index_ = nullptr;
+        engine::utils::SpatialGrid::Handle index_handle_ = engine::utils::SpatialGrid::INVALID_HANDLE;
+
+        /// @brief Bounds last reported to the index; used to skip unchanged sprites.
+        engine::utils::Rect indexed_bounds_ = {};
+
+        void updateSpriteSize();
+
+        void init() override;
+        void update(float, engine::core::Context&) override;
+        void render(engine::core::Context& context) override;
+        void clean() override;
+    };
+
+} // namespace engine::object::components
+
+#endif // SPRITE_COMPONENT_HPP_
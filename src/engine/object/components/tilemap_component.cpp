@@ -0,0 +1,26 @@
+#include "tilemap_component.hpp"
+#include "../../core/context.hpp"
+#include "../../render/tilemap.hpp"
+#include <stdexcept>
+
+namespace engine::object::components {
+
+    TilemapComponent::TilemapComponent(std::unique_ptr<engine::render::Tilemap> tilemap)
+        : tilemap_(std::move(tilemap))
+    {
+        if (!tilemap_) {
+            throw std::invalid_argument("TilemapComponent requires a tilemap.");
+        }
+    }
+
+    TilemapComponent::~TilemapComponent() = default;
+
+    void TilemapComponent::render(engine::core::Context& context) {
+        if (is_hidden_) {
+            return;
+        }
+
+        tilemap_->render(context.getRenderer(), context.getCamera());
+    }
+
+} // namespace engine::object::components
@@ -0,0 +1,44 @@
+#ifndef TILEMAP_COMPONENT_HPP_
+#define TILEMAP_COMPONENT_HPP_
+
+#include "../component.hpp"
+#include <memory>
+
+namespace engine::render {
+    class Tilemap;
+}
+
+namespace engine::object::components {
+
+    /// @brief Owns a Tilemap and draws it as part of the owning GameObject.
+    ///
+    /// The scene renders objects before world sprites, so a tilemap object acts as the
+    /// ground layer beneath sprites.
+    class TilemapComponent final : public Component {
+        friend class engine::object::GameObject;
+
+    public:
+        explicit TilemapComponent(std::unique_ptr<engine::render::Tilemap> tilemap);
+        ~TilemapComponent() override;
+
+        TilemapComponent(const TilemapComponent&) = delete;
+        TilemapComponent& operator=(const TilemapComponent&) = delete;
+        TilemapComponent(TilemapComponent&&) = delete;
+        TilemapComponent& operator=(TilemapComponent&&) = delete;
+
+        engine::render::Tilemap* getTilemap() const { return tilemap_.get(); }
+        bool isHidden() const { return is_hidden_; }
+
+        void setHidden(bool hidden) { is_hidden_ = hidden; }
+
+    private:
+        std::unique_ptr<engine::render::Tilemap> tilemap_;
+        bool is_hidden_ = false;
+
+        void update(float, engine::core::Context&) override {}
+        void render(engine::core::Context& context) override;
+    };
+
+} // namespace engine::object::components
+
+#endif // TILEMAP_COMPONENT_HPP_
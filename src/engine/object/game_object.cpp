@@ -2,6 +2,7 @@
 #include "../render/renderer.hpp"
 #include "../input/input_manager.hpp"
 #include "../render/camera.hpp"
+#include "../scene/game_object_index.hpp"
 #include <spdlog/spdlog.h>
 
 namespace engine::object {
@@ -10,34 +11,74 @@ namespace engine::object {
         std::string_view name,
         std::string_view tag
     )
-        : name_(name)
-        , tag_(tag)
+        : name_id_(engine::utils::StringInterner::shared().intern(name))
+        , tag_id_(engine::utils::StringInterner::shared().intern(tag))
     {
-        spdlog::trace("GameObject created: {} {}", name_, tag_);
+        spdlog::trace("GameObject created: {} {}", name, tag);
+    }
+
+    GameObject::~GameObject() {
+        if (index_) {
+            index_->remove(*this);
+        }
+    }
+
+    void GameObject::setName(std::string_view name) {
+        auto name_id = engine::utils::StringInterner::shared().intern(name);
+        if (index_) {
+            index_->rename(*this, name_id);
+        } else {
+            name_id_ = name_id;
+        }
+    }
+
+    void GameObject::setTag(std::string_view tag) {
+        auto tag_id = engine::utils::StringInterner::shared().intern(tag);
+        if (index_) {
+            index_->retag(*this, tag_id);
+        } else {
+            tag_id_ = tag_id;
+        }
+    }
+
+    void* GameObject::operator new(std::size_t /*size*/) {
+        return Pool::shared().allocate();
+    }
+
+    void GameObject::operator delete(void* pointer) {
+        Pool::shared().deallocate(pointer);
+    }
+
+    GameObject::Handle GameObject::getHandle() const {
+        return Pool::shared().getHandle(this);
+    }
+
+    GameObject* GameObject::fromHandle(Handle handle) {
+        return Pool::shared().get(handle);
     }
 
     void GameObject::update(float delta_time, engine::core::Context& context) {
-        for (auto& pair : components_) {
-            pair.second->update(delta_time, context);
+        for (auto& entry : components_) {
+            entry.component->update(delta_time, context);
         }
     }
 
     void GameObject::render(engine::core::Context& context) {
-        for (auto& pair : components_) {
-            pair.second->render(context);
+        for (auto& entry : components_) {
+            entry.component->render(context);
         }
     }
 
     void GameObject::clean() {
-        for (auto& pair : components_) {
-            pair.second->clean();
+        for (auto& entry : components_) {
+            entry.component->clean();
         }
         components_.clear();
     }
 
     void GameObject::handleInput(engine::core::Context& context) {
-        for (auto& pair : components_) {
-            pair.second->handleInput(context);
+        for (auto& entry : components_) {
+            entry.component->handleInput(context);
         }
     }
 
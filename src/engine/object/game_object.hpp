@@ -2,48 +2,79 @@
 #define GAME_OBJECT_HPP_
 
 #include "component.hpp"
+#include "../utils/object_pool.hpp"
+#include "../utils/string_interner.hpp"
+#include <cstddef>
+#include <cstdint>
 #include <string_view>
 #include <memory>
-#include <unordered_map>
 #include <typeindex>
 #include <utility>
+#include <vector>
 #include <spdlog/spdlog.h>
 
 namespace engine::core {
     class Context;
 }
 
+namespace engine::scene {
+    class GameObjectIndex;
+}
+
 namespace engine::object {
 
+    /**
+     * @brief An entity: a name, a tag and a set of components, at most one of each type.
+     *
+     * GameObjects and their components live in ObjectPools rather than in individual heap
+     * blocks: `std::make_unique<GameObject>` takes a slot from the GameObject pool through
+     * the class-specific operator new, and addComponent() constructs each component in the
+     * pool of its type. Spawning and despawning then costs a free-list push/pop, and objects
+     * of one type sit next to each other in memory.
+     *
+     * Names and tags are interned: objects store their ids and compare as integers.
+     */
     class GameObject final {
     public:
+        using Pool = engine::utils::ObjectPool<GameObject>;
+        using Handle = Pool::Handle;
+
         GameObject(std::string_view name = "", std::string_view tag = "");
+        ~GameObject();
+
+        static void* operator new(std::size_t size);
+        static void operator delete(void* pointer);
+
+        /// @brief Stable reference to this object; resolve it with fromHandle().
+        Handle getHandle() const;
+        /// @brief The object a handle refers to, or null if it has been destroyed since.
+        static GameObject* fromHandle(Handle handle);
 
         GameObject(const GameObject&) = delete;
         GameObject& operator=(const GameObject&) = delete;
         GameObject(GameObject&&) = delete;
         GameObject& operator=(GameObject&&) = delete;
 
-        void setName(std::string_view name) {
-            name_ = name;
-        }
-
-        void setTag(std::string_view tag) {
-            tag_ = tag;
-        }
+        /// @brief Rename the object; the scene's name index follows.
+        void setName(std::string_view name);
+        /// @brief Retag the object; the scene's tag index follows.
+        void setTag(std::string_view tag);
 
         void setNeedRemove(bool need_remove) {
             need_remove_ = need_remove;
         }
 
         std::string_view getName() const {
-            return name_;
+            return engine::utils::StringInterner::shared().lookup(name_id_);
         }
 
         std::string_view getTag() const {
-            return tag_;
+            return engine::utils::StringInterner::shared().lookup(tag_id_);
         }
 
+        engine::utils::StringId getNameId() const { return name_id_; }
+        engine::utils::StringId getTagId() const { return tag_id_; }
+
         bool isNeedRemove() const {
             return need_remove_;
         }
@@ -56,16 +87,15 @@ namespace engine::object {
         template <typename T>
         bool hasComponent() const {
             static_assert(std::is_base_of<engine::object::Component, T>::value, "T must inherit Component");
-            return components_.contains(std::type_index(typeid(T)));
+            return findComponent(std::type_index(typeid(T))) != components_.end();
         }
 
         template <typename T>
         T* getComponent() const {
             static_assert(std::is_base_of<engine::object::Component, T>::value, "T must inherit Component");
-            auto type_index = std::type_index(typeid(T));
-            auto it = components_.find(type_index);
+            auto it = findComponent(std::type_index(typeid(T)));
             if (it != components_.end()) {
-                return static_cast<T*>(it->second.get());
+                return static_cast<T*>(it->component.get());
             }
             return nullptr;
         }
@@ -73,36 +103,81 @@ namespace engine::object {
         template <typename T, typename... Args>
         T* addComponent(Args&&... args) {
             static_assert(std::is_base_of<engine::object::Component, T>::value, "T must inherit Component");
-            auto type_index = std::type_index(typeid(T));
-            if (hasComponent<T>()) {
-                return getComponent<T>();
+            if (T* existing = getComponent<T>()) {
+                return existing;
             }
 
-            auto new_component = std::make_unique<T>(std::forward<Args>(args)...);
-            T* ptr = new_component.get();
+            // Components go back to the pool of their own type when removed
+            ComponentPtr new_component(
+                engine::utils::ObjectPool<T>::shared().create(std::forward<Args>(args)...),
+                ComponentDeleter{[](Component* component) {
+                    engine::utils::ObjectPool<T>::shared().destroy(static_cast<T*>(component));
+                }}
+            );
+            T* ptr = static_cast<T*>(new_component.get());
             new_component->setOwner(this);
-            components_[type_index] = std::move(new_component);
+            components_.push_back({std::type_index(typeid(T)), std::move(new_component)});
             ptr->init();
             return ptr;
         }
 
+        /// @brief Call `func(type, component)` on every component, in update order.
+        template <typename Func>
+        void forEachComponent(Func&& func) const {
+            for (const auto& entry : components_) {
+                func(entry.type, static_cast<const engine::object::Component&>(*entry.component));
+            }
+        }
+
         template <typename T>
         void removeComponent() {
             static_assert(std::is_base_of<engine::object::Component, T>::value, "T must inherit Component");
-            auto type_index = std::type_index(typeid(T));
-            auto it = components_.find(type_index);
+            auto it = findComponent(std::type_index(typeid(T)));
             if (it != components_.end()) {
-                it->second->clean();
+                it->component->clean();
                 components_.erase(it);
             }
         }
 
     private:
-        std::string name_;
-        std::string tag_;
-        std::unordered_map<std::type_index, std::unique_ptr<engine::object::Component>> components_;
+        friend class engine::scene::GameObjectIndex;
+
+        struct ComponentDeleter {
+            void (*destroy)(engine::object::Component*) = nullptr;
+
+            void operator()(engine::object::Component* component) const { destroy(component); }
+        };
+
+        using ComponentPtr = std::unique_ptr<engine::object::Component, ComponentDeleter>;
+
+        struct ComponentEntry {
+            std::type_index type;
+            ComponentPtr component;
+        };
+
+        engine::utils::StringId name_id_ = engine::utils::EMPTY_STRING_ID;
+        engine::utils::StringId tag_id_ = engine::utils::EMPTY_STRING_ID;
+
+        /// @brief Index of the scene this object is in, and its positions in that index's
+        /// name and tag lists; maintained by GameObjectIndex.
+        engine::scene::GameObjectIndex* index_ = nullptr;
+        std::uint32_t name_slot_ = 0;
+        std::uint32_t tag_slot_ = 0;
+
+        /// @brief Components in the order they were added, which is also their update order.
+        /// Objects have a handful of components, so a linear search beats a hash lookup.
+        std::vector<ComponentEntry> components_;
         bool need_remove_ = false;
 
+        std::vector<ComponentEntry>::const_iterator findComponent(std::type_index type) const {
+            for (auto it = components_.begin(); it != components_.end(); ++it) {
+                if (it->type == type) {
+                    return it;
+                }
+            }
+            return components_.end();
+        }
+
     };
 
 } // namespace engine::object
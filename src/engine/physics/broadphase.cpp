@@ -0,0 +1,127 @@
+#include "broadphase.hpp"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <spdlog/spdlog.h>
+
+namespace engine::physics {
+
+    namespace {
+
+        /// @brief Smallest hash table; keeps tiny worlds from rehashing every step.
+        constexpr std::size_t MIN_BUCKET_COUNT = 64;
+
+    } // namespace
+
+    SpatialHashBroadphase::SpatialHashBroadphase(float cell_size)
+        : cell_size_(1.0f)
+        , inverse_cell_size_(1.0f)
+    {
+        setCellSize(cell_size);
+    }
+
+    void SpatialHashBroadphase::setCellSize(float cell_size) {
+        if (!(cell_size > 0.0f)) {
+            spdlog::warn("SpatialHashBroadphase: invalid cell size {}; keeping {}.", cell_size, cell_size_);
+            return;
+        }
+
+        cell_size_ = cell_size;
+        inverse_cell_size_ = 1.0f / cell_size;
+    }
+
+    void SpatialHashBroadphase::findPairs(const AabbArrays& aabbs, std::vector<BodyPair>& pairs) {
+        pairs.clear();
+        test_count_ = 0;
+
+        const auto count = static_cast<std::uint32_t>(aabbs.size());
+        cell_x0_.resize(count);
+        cell_y0_.resize(count);
+        cell_x1_.resize(count);
+        cell_y1_.resize(count);
+
+        // 1. Cells covered by each box
+        std::size_t entry_count = 0;
+        for (std::uint32_t i = 0; i < count; ++i) {
+            cell_x0_[i] = static_cast<std::int32_t>(std::floor(aabbs.min_x[i] * inverse_cell_size_));
+            cell_y0_[i] = static_cast<std::int32_t>(std::floor(aabbs.min_y[i] * inverse_cell_size_));
+            cell_x1_[i] = static_cast<std::int32_t>(std::floor(aabbs.max_x[i] * inverse_cell_size_));
+            cell_y1_[i] = static_cast<std::int32_t>(std::floor(aabbs.max_y[i] * inverse_cell_size_));
+            entry_count += static_cast<std::size_t>(cell_x1_[i] - cell_x0_[i] + 1) * static_cast<std::size_t>(cell_y1_[i] - cell_y0_[i] + 1);
+        }
+
+        // 2. Counting sort of the cell entries into the buckets; twice as many buckets as
+        //    entries keeps most buckets down to a single cell
+        std::size_t bucket_count = std::bit_ceil(std::max(entry_count * 2, MIN_BUCKET_COUNT));
+        bucket_mask_ = static_cast<std::uint32_t>(bucket_count - 1);
+        bucket_starts_.assign(bucket_count + 1, 0);
+
+        for (std::uint32_t i = 0; i < count; ++i) {
+            for (std::int32_t y = cell_y0_[i]; y <= cell_y1_[i]; ++y) {
+                for (std::int32_t x = cell_x0_[i]; x <= cell_x1_[i]; ++x) {
+                    ++bucket_starts_[bucketOf(x, y) + 1];
+                }
+            }
+        }
+
+        for (std::size_t bucket = 1; bucket <= bucket_count; ++bucket) {
+            bucket_starts_[bucket] += bucket_starts_[bucket - 1];
+        }
+
+        bucket_cursors_.assign(bucket_starts_.begin(), bucket_starts_.end() - 1);
+        bucket_bodies_.resize(entry_count);
+        for (std::uint32_t i = 0; i < count; ++i) {
+            for (std::int32_t y = cell_y0_[i]; y <= cell_y1_[i]; ++y) {
+                for (std::int32_t x = cell_x0_[i]; x <= cell_x1_[i]; ++x) {
+                    bucket_bodies_[bucket_cursors_[bucketOf(x, y)]++] = i;
+                }
+            }
+        }
+
+        // 3. Pairs within each bucket. Boxes were entered in index order, so a bucket
+        //    lists its boxes in ascending order and a box entered twice (two of its cells
+        //    hashing together) sits next to itself
+        for (std::size_t bucket = 0; bucket < bucket_count; ++bucket) {
+            const std::uint32_t begin = bucket_starts_[bucket];
+            const std::uint32_t end = bucket_starts_[bucket + 1];
+            if (end - begin < 2) {
+                continue;
+            }
+
+            for (std::uint32_t i = begin; i < end; ++i) {
+                const std::uint32_t a = bucket_bodies_[i];
+                if (i > begin && bucket_bodies_[i - 1] == a) {
+                    continue;
+                }
+
+                for (std::uint32_t j = i + 1; j < end; ++j) {
+                    const std::uint32_t b = bucket_bodies_[j];
+                    if (bucket_bodies_[j - 1] == b) {
+                        continue;
+                    }
+
+                    ++test_count_;
+                    if (aabbs.min_x[a] >= aabbs.max_x[b] || aabbs.min_x[b] >= aabbs.max_x[a] ||
+                        aabbs.min_y[a] >= aabbs.max_y[b] || aabbs.min_y[b] >= aabbs.max_y[a]) {
+                        continue;
+                    }
+
+                    // Boxes sharing several cells meet in several buckets; only the cell
+                    // where their overlap begins reports them
+                    std::int32_t owner_x = std::max(cell_x0_[a], cell_x0_[b]);
+                    std::int32_t owner_y = std::max(cell_y0_[a], cell_y0_[b]);
+                    if (bucketOf(owner_x, owner_y) == bucket) {
+                        pairs.push_back({a, b});
+                    }
+                }
+            }
+        }
+    }
+
+    std::uint32_t SpatialHashBroadphase::bucketOf(std::int32_t cell_x, std::int32_t cell_y) const {
+        // Large primes from Teschner et al., "Optimized Spatial Hashing for Collision Detection"
+        std::uint32_t hash = (static_cast<std::uint32_t>(cell_x) * 73856093u) ^ (static_cast<std::uint32_t>(cell_y) * 19349663u);
+        return hash & bucket_mask_;
+    }
+
+} // namespace engine::physics
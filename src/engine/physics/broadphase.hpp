@@ -0,0 +1,109 @@
+#ifndef BROADPHASE_HPP_
+#define BROADPHASE_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace engine::physics {
+
+    /// @brief Axis-aligned boxes stored as one array per coordinate (structure of arrays),
+    /// so the overlap tests of the broadphase stream through contiguous floats.
+    struct AabbArrays {
+        std::vector<float> min_x;
+        std::vector<float> min_y;
+        std::vector<float> max_x;
+        std::vector<float> max_y;
+
+        std::size_t size() const { return min_x.size(); }
+
+        void clear() {
+            min_x.clear();
+            min_y.clear();
+            max_x.clear();
+            max_y.clear();
+        }
+
+        void reserve(std::size_t count) {
+            min_x.reserve(count);
+            min_y.reserve(count);
+            max_x.reserve(count);
+            max_y.reserve(count);
+        }
+
+        void push(float left, float top, float right, float bottom) {
+            min_x.push_back(left);
+            min_y.push_back(top);
+            max_x.push_back(right);
+            max_y.push_back(bottom);
+        }
+    };
+
+    /// @brief Two overlapping boxes, by their index in the AabbArrays; always `a < b`.
+    struct BodyPair {
+        std::uint32_t a;
+        std::uint32_t b;
+
+        bool operator==(const BodyPair&) const = default;
+    };
+
+    /**
+     * @brief Finds the overlapping pairs among a set of boxes with a spatial hash that is
+     * rebuilt from scratch on every query.
+     *
+     * Each box is entered in every grid cell it touches, and the cells are hashed into a
+     * power-of-two table that is filled by counting sort: the bodies of one bucket end up
+     * next to each other in a single flat array, in ascending order. Pairs are then only
+     * tested within a bucket, and a pair is reported by the one bucket holding the cell
+     * where the two boxes' overlap begins, so it comes out exactly once without a set of
+     * seen pairs. Rebuilding costs O(boxes) with no per-cell containers, which suits
+     * bodies that all move every step.
+     *
+     * The cell size should be about the size of a typical box: much smaller puts large
+     * boxes in many cells, much larger tests many distant pairs. Buffers are kept between
+     * queries, so steady-state queries do not allocate.
+     */
+    class SpatialHashBroadphase final {
+    public:
+        explicit SpatialHashBroadphase(float cell_size = 64.0f);
+
+        SpatialHashBroadphase(const SpatialHashBroadphase&) = delete;
+        SpatialHashBroadphase& operator=(const SpatialHashBroadphase&) = delete;
+        SpatialHashBroadphase(SpatialHashBroadphase&&) = delete;
+        SpatialHashBroadphase& operator=(SpatialHashBroadphase&&) = delete;
+
+        /// @brief Replace `pairs` with every pair of overlapping boxes (touching edges do
+        /// not count), grouped by hash bucket.
+        void findPairs(const AabbArrays& aabbs, std::vector<BodyPair>& pairs);
+
+        float getCellSize() const { return cell_size_; }
+        void setCellSize(float cell_size);
+
+        /// @brief Cells entered by the boxes of the last query.
+        std::size_t getCellEntryCount() const { return bucket_bodies_.size(); }
+        /// @brief Box-box overlap tests done by the last query.
+        std::size_t getTestCount() const { return test_count_; }
+
+    private:
+        float cell_size_;
+        float inverse_cell_size_;
+        std::uint32_t bucket_mask_ = 0;
+
+        /// @brief First cell of each box, used to pick the bucket that reports a pair.
+        std::vector<std::int32_t> cell_x0_;
+        std::vector<std::int32_t> cell_y0_;
+        std::vector<std::int32_t> cell_x1_;
+        std::vector<std::int32_t> cell_y1_;
+
+        std::vector<std::uint32_t> bucket_starts_;      ///< @brief Offset of each bucket in bucket_bodies_, plus the end
+        std::vector<std::uint32_t> bucket_cursors_;     ///< @brief Fill position of each bucket while building
+        std::vector<std::uint32_t> bucket_bodies_;      ///< @brief Box indices, grouped by bucket
+
+        std::size_t test_count_ = 0;
+
+        std::uint32_t bucketOf(std::int32_t cell_x, std::int32_t cell_y) const;
+    };
+
+} // namespace engine::physics
+
+#endif // BROADPHASE_HPP_
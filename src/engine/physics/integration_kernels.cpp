@@ -0,0 +1,125 @@
+#include "integration_kernels.hpp"
+#include <SDL3/SDL_cpuinfo.h>
+#include <algorithm>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    #define ENGINE_PHYSICS_X86 1
+    #include <immintrin.h>
+#endif
+
+// GCC and Clang only emit AVX for functions that ask for it; MSVC accepts the intrinsics anywhere
+#if defined(__GNUC__) || defined(__clang__)
+    #define ENGINE_TARGET_AVX __attribute__((target("avx")))
+#else
+    #define ENGINE_TARGET_AVX
+#endif
+
+namespace engine::physics {
+
+    namespace {
+
+        // --- Scalar ---
+
+        void integrateRangeScalar(const AxisIntegration& axis, std::size_t begin) {
+            for (std::size_t i = begin; i < axis.count; ++i) {
+                float acceleration = axis.force[i] * axis.inverse_mass[i] + axis.gravity * axis.gravity_scale[i];
+                float velocity = axis.velocity[i] + acceleration * axis.delta_time * axis.motion[i];
+                velocity = std::min(std::max(velocity, -axis.max_speed), axis.max_speed);
+                axis.velocity[i] = velocity;
+                axis.position[i] += velocity * axis.delta_time * axis.motion[i];
+            }
+        }
+
+        void integrateAxisScalar(const AxisIntegration& axis) {
+            integrateRangeScalar(axis, 0);
+        }
+
+#ifdef ENGINE_PHYSICS_X86
+
+        // --- SSE2: four bodies per iteration ---
+
+        void integrateAxisSse2(const AxisIntegration& axis) {
+            const __m128 gravity = _mm_set1_ps(axis.gravity);
+            const __m128 delta_time = _mm_set1_ps(axis.delta_time);
+            const __m128 low = _mm_set1_ps(-axis.max_speed);
+            const __m128 high = _mm_set1_ps(axis.max_speed);
+
+            std::size_t i = 0;
+            for (; i + 4 <= axis.count; i += 4) {
+                __m128 motion = _mm_loadu_ps(axis.motion + i);
+                __m128 acceleration = _mm_add_ps(
+                    _mm_mul_ps(_mm_loadu_ps(axis.force + i), _mm_loadu_ps(axis.inverse_mass + i)),
+                    _mm_mul_ps(gravity, _mm_loadu_ps(axis.gravity_scale + i))
+                );
+                __m128 velocity = _mm_add_ps(
+                    _mm_loadu_ps(axis.velocity + i),
+                    _mm_mul_ps(_mm_mul_ps(acceleration, delta_time), motion)
+                );
+                velocity = _mm_min_ps(_mm_max_ps(velocity, low), high);
+                _mm_storeu_ps(axis.velocity + i, velocity);
+
+                __m128 position = _mm_add_ps(
+                    _mm_loadu_ps(axis.position + i),
+                    _mm_mul_ps(_mm_mul_ps(velocity, delta_time), motion)
+                );
+                _mm_storeu_ps(axis.position + i, position);
+            }
+            integrateRangeScalar(axis, i);
+        }
+
+        // --- AVX: eight bodies per iteration ---
+
+        ENGINE_TARGET_AVX
+        void integrateAxisAvx(const AxisIntegration& axis) {
+            const __m256 gravity = _mm256_set1_ps(axis.gravity);
+            const __m256 delta_time = _mm256_set1_ps(axis.delta_time);
+            const __m256 low = _mm256_set1_ps(-axis.max_speed);
+            const __m256 high = _mm256_set1_ps(axis.max_speed);
+
+            std::size_t i = 0;
+            for (; i + 8 <= axis.count; i += 8) {
+                __m256 motion = _mm256_loadu_ps(axis.motion + i);
+                __m256 acceleration = _mm256_add_ps(
+                    _mm256_mul_ps(_mm256_loadu_ps(axis.force + i), _mm256_loadu_ps(axis.inverse_mass + i)),
+                    _mm256_mul_ps(gravity, _mm256_loadu_ps(axis.gravity_scale + i))
+                );
+                __m256 velocity = _mm256_add_ps(
+                    _mm256_loadu_ps(axis.velocity + i),
+                    _mm256_mul_ps(_mm256_mul_ps(acceleration, delta_time), motion)
+                );
+                velocity = _mm256_min_ps(_mm256_max_ps(velocity, low), high);
+                _mm256_storeu_ps(axis.velocity + i, velocity);
+
+                __m256 position = _mm256_add_ps(
+                    _mm256_loadu_ps(axis.position + i),
+                    _mm256_mul_ps(_mm256_mul_ps(velocity, delta_time), motion)
+                );
+                _mm256_storeu_ps(axis.position + i, position);
+            }
+            integrateRangeScalar(axis, i);
+        }
+
+#endif // ENGINE_PHYSICS_X86
+
+    } // namespace
+
+    IntegrationKernels selectIntegrationKernels(IntegrationKernelSet requested) {
+#ifdef ENGINE_PHYSICS_X86
+        bool want_avx = requested == IntegrationKernelSet::AUTO || requested == IntegrationKernelSet::AVX;
+        bool want_sse2 = want_avx || requested == IntegrationKernelSet::SSE2;
+
+        if (want_avx && SDL_HasAVX()) {
+            return {integrateAxisAvx, "avx"};
+        }
+
+        if (want_sse2 && SDL_HasSSE2()) {
+            return {integrateAxisSse2, "sse2"};
+        }
+#else
+        (void)requested;
+#endif
+
+        return {integrateAxisScalar, "scalar"};
+    }
+
+} // namespace engine::physics
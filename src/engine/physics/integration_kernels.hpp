@@ -0,0 +1,47 @@
+#ifndef INTEGRATION_KERNELS_HPP_
+#define INTEGRATION_KERNELS_HPP_
+
+#include <cstddef>
+
+namespace engine::physics {
+
+    /// @brief Input of one integration pass over one axis of `count` bodies. Every array
+    /// holds one float per body.
+    struct AxisIntegration {
+        float* position;
+        float* velocity;
+        const float* force;
+        const float* inverse_mass;
+        const float* gravity_scale;     ///< @brief 1 for bodies using gravity, else 0
+        const float* motion;            ///< @brief 1 for bodies that move, 0 for static or disabled ones
+        std::size_t count;
+        float gravity;                  ///< @brief Gravity along this axis
+        float delta_time;
+        float max_speed;
+    };
+
+    /// @brief Semi-implicit Euler integration of the physics bodies, in one implementation
+    /// per instruction set.
+    ///
+    /// Per body: `velocity = clamp(velocity + (force * inverse_mass + gravity * gravity_scale)
+    /// * delta_time * motion, -max_speed, max_speed)`, then `position += velocity * delta_time
+    /// * motion`. The axes are independent, so each is a separate pass over flat arrays.
+    /// selectIntegrationKernels() picks the widest implementation the CPU supports at runtime.
+    struct IntegrationKernels {
+        void (*integrate_axis)(const AxisIntegration& axis);
+        const char* name;
+    };
+
+    enum class IntegrationKernelSet {
+        AUTO,
+        SCALAR,
+        SSE2,
+        AVX,
+    };
+
+    /// @brief Kernels for `requested`, falling back to narrower sets the CPU or build lacks.
+    IntegrationKernels selectIntegrationKernels(IntegrationKernelSet requested = IntegrationKernelSet::AUTO);
+
+} // namespace engine::physics
+
+#endif // INTEGRATION_KERNELS_HPP_
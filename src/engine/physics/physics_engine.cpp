@@ -0,0 +1,365 @@
+#include "physics_engine.hpp"
+#include "../object/components/physics_component.hpp"
+#include "../object/components/transform_component.hpp"
+#include "../utils/thread_pool.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <spdlog/spdlog.h>
+
+namespace engine::physics {
+
+    using engine::object::components::PhysicsComponent;
+
+    namespace {
+
+        constexpr std::uint32_t NO_ISLAND = std::numeric_limits<std::uint32_t>::max();
+
+        // Work is split into fixed ranges whatever the thread count, so that the SIMD
+        // kernels see the same ranges (and round the same way) with any number of threads
+        constexpr std::size_t SYNC_GRAIN = 2048;
+        constexpr std::size_t INTEGRATION_GRAIN = 4096;
+        constexpr std::size_t ISLAND_GRAIN = 64;
+
+        constexpr int VELOCITY_ITERATIONS = 8;
+        constexpr float PENETRATION_SLOP = 0.5f;            ///< @brief Pixels of overlap left alone, to keep resting contacts stable
+        constexpr float POSITION_CORRECTION = 0.8f;         ///< @brief Fraction of the remaining overlap removed per step
+
+    } // namespace
+
+    PhysicsEngine::PhysicsEngine(float cell_size, std::size_t thread_count)
+        : kernels_(selectIntegrationKernels())
+        , thread_pool_(std::make_unique<engine::utils::ThreadPool>(std::max<std::size_t>(thread_count, 1) - 1))
+        , broadphase_(cell_size)
+    {
+        spdlog::trace("PhysicsEngine: {} integration kernels, {} thread(s).", kernels_.name, thread_pool_->getThreadCount());
+    }
+
+    PhysicsEngine::~PhysicsEngine() = default;
+
+    std::size_t PhysicsEngine::getThreadCount() const {
+        return thread_pool_->getThreadCount();
+    }
+
+    void PhysicsEngine::registerComponent(PhysicsComponent* component) {
+        if (!component || component->body_index_ != PhysicsComponent::UNREGISTERED || !component->transform_) {
+            return;
+        }
+
+        component->body_index_ = static_cast<std::uint32_t>(bodies_.components.size());
+
+        const auto* transform = component->transform_;
+        bodies_.position_x.push_back(transform->getPosition().x);
+        bodies_.position_y.push_back(transform->getPosition().y);
+        bodies_.scale_x.push_back(transform->getScale().x);
+        bodies_.scale_y.push_back(transform->getScale().y);
+        bodies_.velocity_x.push_back(0.0f);
+        bodies_.velocity_y.push_back(0.0f);
+        bodies_.force_x.push_back(0.0f);
+        bodies_.force_y.push_back(0.0f);
+        bodies_.inverse_mass.push_back(0.0f);
+        bodies_.gravity_scale.push_back(0.0f);
+        bodies_.motion.push_back(0.0f);
+        bodies_.collider_offset_x.push_back(0.0f);
+        bodies_.collider_offset_y.push_back(0.0f);
+        bodies_.collider_size_x.push_back(0.0f);
+        bodies_.collider_size_y.push_back(0.0f);
+        bodies_.components.push_back(component);
+        bodies_.transforms.push_back(component->transform_);
+
+        refreshBody(component);
+    }
+
+    void PhysicsEngine::unregisterComponent(PhysicsComponent* component) {
+        if (!component || component->body_index_ == PhysicsComponent::UNREGISTERED) {
+            return;
+        }
+
+        // Swap and pop; the last body takes over the removed body's index
+        std::uint32_t index = component->body_index_;
+        bodies_.forEachArray([index](auto& array) {
+            array[index] = array.back();
+            array.pop_back();
+        });
+
+        if (index < bodies_.components.size()) {
+            bodies_.components[index]->body_index_ = index;
+        }
+        component->body_index_ = PhysicsComponent::UNREGISTERED;
+    }
+
+    void PhysicsEngine::update(float delta_time) {
+        if (bodies_.components.empty()) {
+            contacts_.clear();
+            return;
+        }
+
+        syncFromTransforms();
+        integrate(delta_time);
+        detectCollisions();
+        buildIslands();
+        solveIslands();
+        syncToTransforms();
+    }
+
+    void PhysicsEngine::syncFromTransforms() {
+        thread_pool_->parallelFor(bodies_.components.size(), SYNC_GRAIN, [this](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) {
+                const auto* transform = bodies_.transforms[i];
+                bodies_.position_x[i] = transform->position_.x;
+                bodies_.position_y[i] = transform->position_.y;
+                bodies_.scale_x[i] = transform->scale_.x;
+                bodies_.scale_y[i] = transform->scale_.y;
+            }
+        });
+    }
+
+    void PhysicsEngine::integrate(float delta_time) {
+        thread_pool_->parallelFor(bodies_.components.size(), INTEGRATION_GRAIN, [this, delta_time](std::size_t begin, std::size_t end) {
+            AxisIntegration axis{
+                bodies_.position_x.data() + begin,
+                bodies_.velocity_x.data() + begin,
+                bodies_.force_x.data() + begin,
+                bodies_.inverse_mass.data() + begin,
+                bodies_.gravity_scale.data() + begin,
+                bodies_.motion.data() + begin,
+                end - begin,
+                gravity_.x,
+                delta_time,
+                max_speed_
+            };
+            kernels_.integrate_axis(axis);
+
+            axis.position = bodies_.position_y.data() + begin;
+            axis.velocity = bodies_.velocity_y.data() + begin;
+            axis.force = bodies_.force_y.data() + begin;
+            axis.gravity = gravity_.y;
+            kernels_.integrate_axis(axis);
+
+            // Forces only last one step
+            std::fill(bodies_.force_x.begin() + begin, bodies_.force_x.begin() + end, 0.0f);
+            std::fill(bodies_.force_y.begin() + begin, bodies_.force_y.begin() + end, 0.0f);
+        });
+    }
+
+    void PhysicsEngine::detectCollisions() {
+        contacts_.clear();
+        contact_bodies_.clear();
+        aabbs_.clear();
+        aabb_bodies_.clear();
+
+        const auto count = static_cast<std::uint32_t>(bodies_.components.size());
+        for (std::uint32_t i = 0; i < count; ++i) {
+            if (bodies_.collider_size_x[i] <= 0.0f || bodies_.collider_size_y[i] <= 0.0f) {
+                continue;
+            }
+
+            float left = bodies_.position_x[i] + bodies_.collider_offset_x[i] * bodies_.scale_x[i];
+            float top = bodies_.position_y[i] + bodies_.collider_offset_y[i] * bodies_.scale_y[i];
+            float right = left + bodies_.collider_size_x[i] * std::abs(bodies_.scale_x[i]);
+            float bottom = top + bodies_.collider_size_y[i] * std::abs(bodies_.scale_y[i]);
+            aabbs_.push(left, top, right, bottom);
+            aabb_bodies_.push_back(i);
+        }
+
+        broadphase_.findPairs(aabbs_, pairs_);
+
+        // Narrowphase: the boxes overlap, separate them along the shallower axis
+        contacts_.reserve(pairs_.size());
+        contact_bodies_.reserve(pairs_.size());
+        for (const auto& pair : pairs_) {
+            float overlap_x = std::min(aabbs_.max_x[pair.a], aabbs_.max_x[pair.b]) - std::max(aabbs_.min_x[pair.a], aabbs_.min_x[pair.b]);
+            float overlap_y = std::min(aabbs_.max_y[pair.a], aabbs_.max_y[pair.b]) - std::max(aabbs_.min_y[pair.a], aabbs_.min_y[pair.b]);
+
+            // Twice the centre offset; only its sign matters
+            float offset_x = (aabbs_.min_x[pair.b] + aabbs_.max_x[pair.b]) - (aabbs_.min_x[pair.a] + aabbs_.max_x[pair.a]);
+            float offset_y = (aabbs_.min_y[pair.b] + aabbs_.max_y[pair.b]) - (aabbs_.min_y[pair.a] + aabbs_.max_y[pair.a]);
+
+            std::uint32_t a = aabb_bodies_[pair.a];
+            std::uint32_t b = aabb_bodies_[pair.b];
+            Contact contact{bodies_.components[a], bodies_.components[b], {0.0f, 0.0f}, 0.0f};
+            if (overlap_x < overlap_y) {
+                contact.normal = {offset_x < 0.0f ? -1.0f : 1.0f, 0.0f};
+                contact.penetration = overlap_x;
+            } else {
+                contact.normal = {0.0f, offset_y < 0.0f ? -1.0f : 1.0f};
+                contact.penetration = overlap_y;
+            }
+            contacts_.push_back(contact);
+            contact_bodies_.push_back({a, b});
+        }
+    }
+
+    void PhysicsEngine::buildIslands() {
+        const auto body_count = static_cast<std::uint32_t>(bodies_.components.size());
+        const auto contact_count = static_cast<std::uint32_t>(contacts_.size());
+
+        // 1. Union the dynamic bodies of every contact. Static bodies do not join islands:
+        //    nothing moves them, so islands may share them
+        island_parents_.resize(body_count);
+        for (std::uint32_t i = 0; i < body_count; ++i) {
+            island_parents_[i] = i;
+        }
+
+        for (const auto& bodies : contact_bodies_) {
+            if (bodies_.inverse_mass[bodies.a] > 0.0f && bodies_.inverse_mass[bodies.b] > 0.0f) {
+                std::uint32_t root_a = findRoot(bodies.a);
+                std::uint32_t root_b = findRoot(bodies.b);
+                if (root_a != root_b) {
+                    island_parents_[std::max(root_a, root_b)] = std::min(root_a, root_b);
+                }
+            }
+        }
+
+        // 2. Number the islands in order of their first contact
+        root_islands_.assign(body_count, NO_ISLAND);
+        contact_islands_.resize(contact_count);
+        std::uint32_t island_count = 0;
+        for (std::uint32_t c = 0; c < contact_count; ++c) {
+            const auto& bodies = contact_bodies_[c];
+            std::uint32_t dynamic_body = bodies_.inverse_mass[bodies.a] > 0.0f ? bodies.a : bodies.b;
+            if (bodies_.inverse_mass[dynamic_body] <= 0.0f) {
+                contact_islands_[c] = NO_ISLAND;
+                continue;
+            }
+
+            std::uint32_t& island = root_islands_[findRoot(dynamic_body)];
+            if (island == NO_ISLAND) {
+                island = island_count++;
+            }
+            contact_islands_[c] = island;
+        }
+
+        // 3. Group the contacts by island with a counting sort, keeping their order
+        island_starts_.assign(island_count + 1, 0);
+        for (std::uint32_t island : contact_islands_) {
+            if (island != NO_ISLAND) {
+                ++island_starts_[island + 1];
+            }
+        }
+
+        for (std::uint32_t island = 1; island <= island_count; ++island) {
+            island_starts_[island] += island_starts_[island - 1];
+        }
+
+        island_cursors_.assign(island_starts_.begin(), island_starts_.end() - 1);
+        island_contacts_.resize(island_starts_.back());
+        for (std::uint32_t c = 0; c < contact_count; ++c) {
+            if (contact_islands_[c] != NO_ISLAND) {
+                island_contacts_[island_cursors_[contact_islands_[c]]++] = c;
+            }
+        }
+    }
+
+    void PhysicsEngine::solveIslands() {
+        thread_pool_->parallelFor(getIslandCount(), ISLAND_GRAIN, [this](std::size_t begin, std::size_t end) {
+            for (std::size_t island = begin; island < end; ++island) {
+                solveIsland(static_cast<std::uint32_t>(island));
+            }
+        });
+    }
+
+    void PhysicsEngine::solveIsland(std::uint32_t island) {
+        const std::uint32_t begin = island_starts_[island];
+        const std::uint32_t end = island_starts_[island + 1];
+
+        // Static bodies (inverse mass 0) are shared between islands and never written
+        auto& velocity_x = bodies_.velocity_x;
+        auto& velocity_y = bodies_.velocity_y;
+        const auto& inverse_mass = bodies_.inverse_mass;
+
+        // Velocity impulses: cancel the approach speed along each contact normal
+        for (int iteration = 0; iteration < VELOCITY_ITERATIONS; ++iteration) {
+            for (std::uint32_t k = begin; k < end; ++k) {
+                std::uint32_t c = island_contacts_[k];
+                std::uint32_t a = contact_bodies_[c].a;
+                std::uint32_t b = contact_bodies_[c].b;
+                const glm::vec2& normal = contacts_[c].normal;
+
+                float approach = (velocity_x[b] - velocity_x[a]) * normal.x + (velocity_y[b] - velocity_y[a]) * normal.y;
+                if (approach >= 0.0f) {
+                    continue;
+                }
+
+                float impulse = -(1.0f + restitution_) * approach / (inverse_mass[a] + inverse_mass[b]);
+                if (inverse_mass[a] > 0.0f) {
+                    velocity_x[a] -= impulse * inverse_mass[a] * normal.x;
+                    velocity_y[a] -= impulse * inverse_mass[a] * normal.y;
+                }
+                if (inverse_mass[b] > 0.0f) {
+                    velocity_x[b] += impulse * inverse_mass[b] * normal.x;
+                    velocity_y[b] += impulse * inverse_mass[b] * normal.y;
+                }
+            }
+        }
+
+        // Positional correction: push the bodies apart in proportion to their inverse masses
+        for (std::uint32_t k = begin; k < end; ++k) {
+            std::uint32_t c = island_contacts_[k];
+            std::uint32_t a = contact_bodies_[c].a;
+            std::uint32_t b = contact_bodies_[c].b;
+            const Contact& contact = contacts_[c];
+
+            float correction = std::max(contact.penetration - PENETRATION_SLOP, 0.0f) * POSITION_CORRECTION / (inverse_mass[a] + inverse_mass[b]);
+            if (inverse_mass[a] > 0.0f) {
+                bodies_.position_x[a] -= correction * inverse_mass[a] * contact.normal.x;
+                bodies_.position_y[a] -= correction * inverse_mass[a] * contact.normal.y;
+            }
+            if (inverse_mass[b] > 0.0f) {
+                bodies_.position_x[b] += correction * inverse_mass[b] * contact.normal.x;
+                bodies_.position_y[b] += correction * inverse_mass[b] * contact.normal.y;
+            }
+        }
+    }
+
+    void PhysicsEngine::syncToTransforms() {
+        thread_pool_->parallelFor(bodies_.components.size(), SYNC_GRAIN, [this](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) {
+                if (bodies_.motion[i] > 0.0f) {
+                    bodies_.transforms[i]->position_ = {bodies_.position_x[i], bodies_.position_y[i]};
+                }
+            }
+        });
+    }
+
+    std::uint32_t PhysicsEngine::findRoot(std::uint32_t body) {
+        // Path halving: every visited body skips to its grandparent
+        while (island_parents_[body] != body) {
+            island_parents_[body] = island_parents_[island_parents_[body]];
+            body = island_parents_[body];
+        }
+        return body;
+    }
+
+    glm::vec2 PhysicsEngine::getBodyVelocity(std::uint32_t body) const {
+        return {bodies_.velocity_x[body], bodies_.velocity_y[body]};
+    }
+
+    void PhysicsEngine::setBodyVelocity(std::uint32_t body, const glm::vec2& velocity) {
+        bodies_.velocity_x[body] = velocity.x;
+        bodies_.velocity_y[body] = velocity.y;
+    }
+
+    void PhysicsEngine::addBodyForce(std::uint32_t body, const glm::vec2& force) {
+        bodies_.force_x[body] += force.x;
+        bodies_.force_y[body] += force.y;
+    }
+
+    void PhysicsEngine::refreshBody(const PhysicsComponent* component) {
+        if (component->body_index_ == PhysicsComponent::UNREGISTERED) {
+            return;
+        }
+
+        std::uint32_t i = component->body_index_;
+        bool collides = component->enabled_ && component->hasCollider();
+
+        bodies_.inverse_mass[i] = component->is_static_ ? 0.0f : 1.0f / component->mass_;
+        bodies_.gravity_scale[i] = component->use_gravity_ ? 1.0f : 0.0f;
+        bodies_.motion[i] = component->enabled_ && !component->is_static_ ? 1.0f : 0.0f;
+        bodies_.collider_offset_x[i] = component->collider_offset_.x;
+        bodies_.collider_offset_y[i] = component->collider_offset_.y;
+        bodies_.collider_size_x[i] = collides ? component->collider_size_.x : 0.0f;
+        bodies_.collider_size_y[i] = collides ? component->collider_size_.y : 0.0f;
+    }
+
+} // namespace engine::physics
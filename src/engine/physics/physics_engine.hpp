@@ -0,0 +1,179 @@
+#ifndef PHYSICS_ENGINE_HPP_
+#define PHYSICS_ENGINE_HPP_
+
+#include "broadphase.hpp"
+#include "integration_kernels.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <glm/vec2.hpp>
+
+namespace engine::object::components {
+    class PhysicsComponent;
+    class TransformComponent;
+}
+
+namespace engine::utils {
+    class ThreadPool;
+}
+
+namespace engine::physics {
+
+    /// @brief Two overlapping colliders and how to separate them.
+    struct Contact {
+        engine::object::components::PhysicsComponent* a;
+        engine::object::components::PhysicsComponent* b;
+        glm::vec2 normal;           ///< @brief Unit axis pointing from a towards b
+        float penetration;          ///< @brief Overlap depth along the normal, before solving
+    };
+
+    /**
+     * @brief 2D rigid-body physics of the PhysicsComponents.
+     *
+     * Bodies are stored as a structure of arrays (positions, velocities, inverse masses...)
+     * indexed by body, and a step runs in passes over those arrays:
+     *
+     *  1. Sync in: read every body's TransformComponent position and scale.
+     *  2. Integrate: semi-implicit Euler over flat float arrays with SIMD kernels.
+     *  3. Detect: the spatial-hash broadphase gives the overlapping boxes, the narrowphase
+     *     a Contact (axis of least penetration) for each.
+     *  4. Solve: contacts are grouped into islands, sets of dynamic bodies connected by
+     *     contacts. Islands share no dynamic body, so they are solved in parallel, each by a
+     *     single thread with velocity impulses and a positional correction.
+     *  5. Sync out: write the positions back to the TransformComponents.
+     *
+     * Every pass is independent of how work is split between threads, and each island is
+     * solved in a fixed order, so a step gives bit-identical results with any thread count.
+     * Contacts point at their bodies and are valid until the next update(), or until one of
+     * the two bodies is destroyed.
+     */
+    class PhysicsEngine final {
+        friend class engine::object::components::PhysicsComponent;
+
+    public:
+        /// @param cell_size Cell size of the broadphase grid, about the size of a typical body
+        /// @param thread_count Threads integrating and solving, the caller's included
+        explicit PhysicsEngine(float cell_size = 64.0f, std::size_t thread_count = 1);
+        ~PhysicsEngine();
+
+        PhysicsEngine(const PhysicsEngine&) = delete;
+        PhysicsEngine& operator=(const PhysicsEngine&) = delete;
+        PhysicsEngine(PhysicsEngine&&) = delete;
+        PhysicsEngine& operator=(PhysicsEngine&&) = delete;
+
+        void registerComponent(engine::object::components::PhysicsComponent* component);
+        void unregisterComponent(engine::object::components::PhysicsComponent* component);
+
+        /// @brief Advance every body by `delta_time` seconds: move, detect and resolve collisions.
+        void update(float delta_time);
+
+        /// @brief Collisions found by the last update(), grouped by broadphase bucket.
+        const std::vector<Contact>& getContacts() const { return contacts_; }
+
+        const glm::vec2& getGravity() const { return gravity_; }
+        void setGravity(const glm::vec2& gravity) { gravity_ = gravity; }
+        float getMaxSpeed() const { return max_speed_; }
+        void setMaxSpeed(float max_speed) { max_speed_ = max_speed; }
+        /// @brief Bounciness of contacts, from 0 (no bounce) to 1 (elastic).
+        float getRestitution() const { return restitution_; }
+        void setRestitution(float restitution) { restitution_ = restitution; }
+
+        std::size_t getBodyCount() const { return bodies_.components.size(); }
+        SpatialHashBroadphase& getBroadphase() { return broadphase_; }
+        /// @brief Candidate pairs reported by the broadphase in the last update().
+        std::size_t getPairCount() const { return pairs_.size(); }
+        /// @brief Islands solved in the last update().
+        std::size_t getIslandCount() const { return island_starts_.empty() ? 0 : island_starts_.size() - 1; }
+        std::size_t getThreadCount() const;
+        const char* getKernelName() const { return kernels_.name; }
+
+    private:
+        /// @brief Per-body state, one array per field; a body's index is the same in each.
+        struct Bodies {
+            std::vector<float> position_x;
+            std::vector<float> position_y;
+            std::vector<float> scale_x;
+            std::vector<float> scale_y;
+            std::vector<float> velocity_x;
+            std::vector<float> velocity_y;
+            std::vector<float> force_x;
+            std::vector<float> force_y;
+            std::vector<float> inverse_mass;        ///< @brief 0 for static bodies
+            std::vector<float> gravity_scale;       ///< @brief 1 if gravity applies, else 0
+            std::vector<float> motion;              ///< @brief 1 if the body moves, else 0
+            std::vector<float> collider_offset_x;
+            std::vector<float> collider_offset_y;
+            std::vector<float> collider_size_x;     ///< @brief 0 when the body has no collider or is disabled
+            std::vector<float> collider_size_y;
+            std::vector<engine::object::components::PhysicsComponent*> components;
+            std::vector<engine::object::components::TransformComponent*> transforms;
+
+            /// @brief Call `func(array)` on every per-body array.
+            template <typename Func>
+            void forEachArray(Func&& func) {
+                func(position_x);
+                func(position_y);
+                func(scale_x);
+                func(scale_y);
+                func(velocity_x);
+                func(velocity_y);
+                func(force_x);
+                func(force_y);
+                func(inverse_mass);
+                func(gravity_scale);
+                func(motion);
+                func(collider_offset_x);
+                func(collider_offset_y);
+                func(collider_size_x);
+                func(collider_size_y);
+                func(components);
+                func(transforms);
+            }
+        };
+
+        Bodies bodies_;
+
+        glm::vec2 gravity_ = {0.0f, 980.0f};        ///< @brief Pixels per second squared; +y points down
+        float max_speed_ = 500.0f;                  ///< @brief Per-axis speed limit in pixels per second
+        float restitution_ = 0.0f;
+
+        IntegrationKernels kernels_;
+        std::unique_ptr<engine::utils::ThreadPool> thread_pool_;
+
+        SpatialHashBroadphase broadphase_;
+        AabbArrays aabbs_;                          ///< @brief Collider bounds of the current step
+        std::vector<std::uint32_t> aabb_bodies_;    ///< @brief Body index of each box
+        std::vector<BodyPair> pairs_;
+        std::vector<Contact> contacts_;
+        std::vector<BodyPair> contact_bodies_;      ///< @brief Body indices of each contact
+
+        // --- Islands ---
+        std::vector<std::uint32_t> island_parents_;     ///< @brief Union-find forest over the bodies
+        std::vector<std::uint32_t> root_islands_;       ///< @brief Island of each root body
+        std::vector<std::uint32_t> contact_islands_;    ///< @brief Island of each contact; NO_ISLAND between static bodies
+        std::vector<std::uint32_t> island_starts_;      ///< @brief Offset of each island in island_contacts_, plus the end
+        std::vector<std::uint32_t> island_cursors_;     ///< @brief Fill position of each island while grouping
+        std::vector<std::uint32_t> island_contacts_;    ///< @brief Contact indices, grouped by island
+
+        void syncFromTransforms();
+        void integrate(float delta_time);
+        void detectCollisions();
+        void buildIslands();
+        void solveIslands();
+        void solveIsland(std::uint32_t island);
+        void syncToTransforms();
+
+        std::uint32_t findRoot(std::uint32_t body);
+
+        // --- For PhysicsComponent ---
+        glm::vec2 getBodyVelocity(std::uint32_t body) const;
+        void setBodyVelocity(std::uint32_t body, const glm::vec2& velocity);
+        void addBodyForce(std::uint32_t body, const glm::vec2& force);
+        /// @brief Copy a registered component's settings into the body arrays.
+        void refreshBody(const engine::object::components::PhysicsComponent* component);
+    };
+
+} // namespace engine::physics
+
+#endif // PHYSICS_ENGINE_HPP_
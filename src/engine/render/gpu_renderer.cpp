@@ -1,7 +1,10 @@
 #include "gpu_renderer.hpp"
+#include "upload_ring.hpp"
+#include "../resource/resource_manager.hpp"
 #include <SDL3/SDL.h>
 #include <SDL3/SDL_stdinc.h>
 #include <stdexcept>
+#include <vector>
 #include <spdlog/spdlog.h>
 
 namespace engine::render {
@@ -15,169 +18,79 @@ namespace engine::render {
 
     GPURenderer::GPURenderer(
         SDL_GPUDevice* device,
-        SDL_Window* window
+        SDL_Window* window,
+        engine::resource::ResourceManager* resource_manager
     )
         : device_(device)
         , window_(window)
-    {}
-
-    void GPURenderer::init() {
-        spdlog::debug("    Initializing vertex shader...");
-        SDL_GPUShader* vertexShader = initVertexShader();
-
-        spdlog::debug("    Initializing fragment shader...");
-        SDL_GPUShader* fragmentShader = initFragmentShader();
-
-        // Create the graphics pipeline
-        SDL_GPUGraphicsPipelineCreateInfo pipelineInfo{};
-        pipelineInfo.vertex_shader = vertexShader;
-        pipelineInfo.fragment_shader = fragmentShader;
-        pipelineInfo.primitive_type = SDL_GPU_PRIMITIVETYPE_TRIANGLELIST;
-
-        // Describe the vertex buffers
-        SDL_GPUVertexBufferDescription vertexBufferDescriptions[1];
-        vertexBufferDescriptions[0].slot = 0;
-        vertexBufferDescriptions[0].input_rate = SDL_GPU_VERTEXINPUTRATE_VERTEX;
-        vertexBufferDescriptions[0].instance_step_rate = 0;
-        vertexBufferDescriptions[0].pitch = sizeof(Vertex);
-
-        pipelineInfo.vertex_input_state.num_vertex_buffers = 1;
-        pipelineInfo.vertex_input_state.vertex_buffer_descriptions = vertexBufferDescriptions;
-
-        // Describe the vertex attribute
-        SDL_GPUVertexAttribute vertexAttributes[2];
-
-        // a_position
-        vertexAttributes[0].buffer_slot = 0;
-        vertexAttributes[0].location = 0;
-        vertexAttributes[0].format = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT3;
-        vertexAttributes[0].offset = 0;
-
-        // a_color
-        vertexAttributes[1].buffer_slot = 0;
-        vertexAttributes[1].location = 1;
-        vertexAttributes[1].format = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT4;
-        vertexAttributes[1].offset = sizeof(float) * 3;
-
-        pipelineInfo.vertex_input_state.num_vertex_attributes = 2;
-        pipelineInfo.vertex_input_state.vertex_attributes = vertexAttributes;
-
-        // Describe the color target
-        SDL_GPUColorTargetDescription colorTargetDescriptions[1];
-        colorTargetDescriptions[0] = {};
-        colorTargetDescriptions[0].blend_state.enable_blend = true;
-        colorTargetDescriptions[0].blend_state.color_blend_op = SDL_GPU_BLENDOP_ADD;
-        colorTargetDescriptions[0].blend_state.alpha_blend_op = SDL_GPU_BLENDOP_ADD;
-        colorTargetDescriptions[0].blend_state.src_color_blendfactor = SDL_GPU_BLENDFACTOR_SRC_ALPHA;
-        colorTargetDescriptions[0].blend_state.dst_color_blendfactor = SDL_GPU_BLENDFACTOR_ONE_MINUS_SRC_ALPHA;
-        colorTargetDescriptions[0].blend_state.src_alpha_blendfactor = SDL_GPU_BLENDFACTOR_SRC_ALPHA;
-        colorTargetDescriptions[0].blend_state.dst_alpha_blendfactor = SDL_GPU_BLENDFACTOR_ONE_MINUS_SRC_ALPHA;
-        colorTargetDescriptions[0].format = SDL_GetGPUSwapchainTextureFormat(device_, window_);
-
-        pipelineInfo.target_info.num_color_targets = 1;
-        pipelineInfo.target_info.color_target_descriptions = colorTargetDescriptions;
-
-        // Create the pipeline
-        graphics_pipeline_ = SDL_CreateGPUGraphicsPipeline(device_, &pipelineInfo);
-
-        // Free the shaders after setting up the pipeline
-        SDL_ReleaseGPUShader(device_, vertexShader);
-        SDL_ReleaseGPUShader(device_, fragmentShader);
-
-        // Create the vertex buffer
-        SDL_GPUBufferCreateInfo bufferInfo{};
-        bufferInfo.size = sizeof(vertices);
-        bufferInfo.usage = SDL_GPU_BUFFERUSAGE_VERTEX;
-        vertex_buffer_ = SDL_CreateGPUBuffer(device_, &bufferInfo);
-
-        // Create a transfer buffer to upload to the vertex buffer
-        SDL_GPUTransferBufferCreateInfo transferInfo{};
-        transferInfo.size = sizeof(vertices);
-        transferInfo.usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD;
-        transfer_buffer_ = SDL_CreateGPUTransferBuffer(device_, &transferInfo);
-
-        // Fill the transfer buffer
-        Vertex* data = (Vertex*)SDL_MapGPUTransferBuffer(device_, transfer_buffer_, false);
-
-        SDL_memcpy(data, (void*)vertices, sizeof(vertices));
-
-        SDL_UnmapGPUTransferBuffer(device_, transfer_buffer_);
-
-        // Start a copy pass
-        SDL_GPUCommandBuffer* commandBuffer = SDL_AcquireGPUCommandBuffer(device_);
-        SDL_GPUCopyPass* copyPass = SDL_BeginGPUCopyPass(commandBuffer);
-
-        // Where is the data
-        SDL_GPUTransferBufferLocation location{};
-        location.transfer_buffer = transfer_buffer_;
-        location.offset = 0;
-
-        // Where to upload the data
-        SDL_GPUBufferRegion region{};
-        region.buffer = vertex_buffer_;
-        region.size = sizeof(vertices);
-        region.offset = 0;
+        , resource_manager_(resource_manager)
+    {
+        if (!device_) {
+            throw std::runtime_error("GPURenderer failed to load: The provided SDL_GPUDevice pointer is empty.");
+        }
 
-        // Upload the data
-        SDL_UploadToGPUBuffer(copyPass, &location, &region, true);
+        if (!resource_manager_) {
+            throw std::runtime_error("GPURenderer failed to load: The provided ResourceManager pointer is empty.");
+        }
 
-        // End the copy pass
-        SDL_EndGPUCopyPass(copyPass);
-        SDL_SubmitGPUCommandBuffer(commandBuffer);
+        upload_ring_ = std::make_unique<UploadRing>(device_);
     }
 
-    SDL_GPUShader* GPURenderer::initVertexShader() {
-        size_t vertexCodeSize;
-
-        spdlog::debug("    Loading vertex.spv");
-        void* vertexCode = SDL_LoadFile("assets/shaders/vertex.spv", &vertexCodeSize);
+    GPURenderer::~GPURenderer() = default;
 
-        SDL_GPUShaderCreateInfo vertexInfo{};
-        vertexInfo.code = (Uint8*)vertexCode;
-        vertexInfo.code_size = vertexCodeSize;
-        spdlog::debug("    [vertexInfo.code_size: {}]", vertexInfo.code_size);
-
-        vertexInfo.entrypoint = "main";
-        vertexInfo.format = SDL_GPU_SHADERFORMAT_SPIRV;
-        vertexInfo.stage = SDL_GPU_SHADERSTAGE_VERTEX;
-        vertexInfo.num_samplers = 0;
-        vertexInfo.num_storage_buffers = 0;
-        vertexInfo.num_storage_textures = 0;
-        vertexInfo.num_uniform_buffers = 0;
+    void GPURenderer::init() {
+        using engine::resource::BlendMode;
+        using engine::resource::PipelineDescriptor;
+        using engine::resource::VertexLayout;
+
+        spdlog::debug("    Loading shaders...");
+        auto vertex_shader = resource_manager_->loadShader("assets/shaders/vertex.spv", SDL_GPU_SHADERSTAGE_VERTEX);
+        auto fragment_shader = resource_manager_->loadShader("assets/shaders/fragment.spv", SDL_GPU_SHADERSTAGE_FRAGMENT);
+
+        PipelineDescriptor base{};
+        base.vertex_shader = vertex_shader;
+        base.fragment_shader = fragment_shader;
+        base.color_format = SDL_GetGPUSwapchainTextureFormat(device_, window_);
+        base.vertex_layout = VertexLayout::POSITION_COLOR;
+        base.primitive_type = SDL_GPU_PRIMITIVETYPE_TRIANGLELIST;
+
+        // Every blend variant of the default shader pair is built up front so switching
+        // blend modes never creates a pipeline mid-frame
+        std::vector<PipelineDescriptor> variants;
+        for (auto blend_mode : {BlendMode::ALPHA, BlendMode::NONE, BlendMode::ADDITIVE, BlendMode::PREMULTIPLIED}) {
+            PipelineDescriptor variant = base;
+            variant.blend_mode = blend_mode;
+            variants.push_back(variant);
+        }
 
-        spdlog::debug("    Configuring vertex shader");
+        spdlog::debug("    Precompiling pipelines...");
+        resource_manager_->precompilePipelines(variants);
 
-        SDL_GPUShader* vertexShader = SDL_CreateGPUShader(device_, &vertexInfo);
-        spdlog::debug("    Vertex shader configuration successful");
+        graphics_pipeline_ = resource_manager_->getPipeline(variants.front());
+        if (!graphics_pipeline_) {
+            throw std::runtime_error("GPURenderer failed to create the default graphics pipeline.");
+        }
 
-        SDL_free(vertexCode);
-        return vertexShader;
-    }
+        // Create the vertex buffer
+        SDL_GPUBufferCreateInfo bufferInfo{};
+        bufferInfo.size = sizeof(vertices);
+        bufferInfo.usage = SDL_GPU_BUFFERUSAGE_VERTEX;
+        vertex_buffer_ = SDL_CreateGPUBuffer(device_, &bufferInfo);
 
-    SDL_GPUShader* GPURenderer::initFragmentShader() {
-        size_t fragmentCodeSize;
-        void* fragmentCode = SDL_LoadFile("assets/shaders/fragment.spv", &fragmentCodeSize);
-
-        SDL_GPUShaderCreateInfo fragmentInfo{};
-        fragmentInfo.code = (Uint8*)fragmentCode;
-        fragmentInfo.code_size = fragmentCodeSize;
-        fragmentInfo.entrypoint = "main";
-        fragmentInfo.format = SDL_GPU_SHADERFORMAT_SPIRV;
-        fragmentInfo.stage = SDL_GPU_SHADERSTAGE_FRAGMENT;
-        fragmentInfo.num_samplers = 0;
-        fragmentInfo.num_storage_buffers = 0;
-        fragmentInfo.num_storage_textures = 0;
-        fragmentInfo.num_uniform_buffers = 0;
-
-        SDL_GPUShader* fragmentShader = SDL_CreateGPUShader(device_, &fragmentInfo);
-        SDL_free(fragmentCode);
-
-        return fragmentShader;
+        // Uploaded with the first frame's copy pass
+        upload_ring_->uploadToBuffer(vertex_buffer_, 0, vertices, sizeof(vertices));
     }
 
     void GPURenderer::render() {
         // Acquire the command buffer
         SDL_GPUCommandBuffer* buffer = SDL_AcquireGPUCommandBuffer(device_);
+        if (!buffer) {
+            spdlog::error("Acquiring a GPU command buffer failed: {}", SDL_GetError());
+            return;
+        }
+
+        // All copies recorded since the last frame go out in one copy pass
+        upload_ring_->flush(buffer);
 
         // Get the swapchain texture
         SDL_GPUTexture* texture;
@@ -221,4 +134,15 @@ namespace engine::render {
         SDL_SubmitGPUCommandBuffer(buffer);
     }
 
+    void GPURenderer::clean() {
+        if (vertex_buffer_) {
+            SDL_ReleaseGPUBuffer(device_, vertex_buffer_);
+            vertex_buffer_ = nullptr;
+        }
+
+        if (upload_ring_) {
+            upload_ring_->release();
+        }
+    }
+
 } // namespace engine::render
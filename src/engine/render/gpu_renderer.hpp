@@ -1,13 +1,13 @@
 #ifndef GPU_RENDERER_HPP_
 #define GPU_RENDERER_HPP_
 
+#include <memory>
 #include <string>
 #include <optional>
 
 struct SDL_GPUDevice;
 struct SDL_GPUShader;
 struct SDL_GPUBuffer;
-struct SDL_GPUTransferBuffer;
 struct SDL_GPUGraphicsPipeline;
 struct SDL_GPUCommandBuffer;
 struct SDL_Window;
@@ -21,6 +21,7 @@ namespace engine::resource {
 }
 
 namespace engine::render {
+    class UploadRing;
 
     struct Vertex {
         float x, y, z;
@@ -29,7 +30,13 @@ namespace engine::render {
 
     class GPURenderer final {
     public:
-        GPURenderer(SDL_GPUDevice* device, SDL_Window* window);
+        GPURenderer(
+            SDL_GPUDevice* device,
+            SDL_Window* window,
+            engine::resource::ResourceManager* resource_manager
+        );
+
+        ~GPURenderer();
 
         GPURenderer(const GPURenderer&) = delete;
         GPURenderer& operator=(const GPURenderer&) = delete;
@@ -37,20 +44,31 @@ namespace engine::render {
         GPURenderer& operator=(GPURenderer&&) = delete;
 
         SDL_GPUDevice* getGPUDevice() const { return device_; }
+        UploadRing& getUploadRing() const { return *upload_ring_; }
 
+        /// @brief Load shaders, precompile the pipeline variants and upload the initial
+        /// geometry. Throws std::runtime_error if the default pipeline is unavailable.
         void init();
         void render();
 
+        /// @brief Release GPU buffers. Must be called before the device is destroyed.
+        void clean();
+
     private:
         SDL_GPUDevice* device_ = nullptr;
         SDL_Window* window_ = nullptr;
+
+        /// @brief Non-owned pointer to ResourceManager, which owns shaders and pipelines.
+        engine::resource::ResourceManager* resource_manager_ = nullptr;
+
         SDL_GPUBuffer* vertex_buffer_ = nullptr;
         SDL_GPUBuffer* fragment_buffer_ = nullptr;
-        SDL_GPUTransferBuffer* transfer_buffer_ = nullptr;
-        SDL_GPUGraphicsPipeline* graphics_pipeline_ = nullptr;
 
-        SDL_GPUShader* initVertexShader();
-        SDL_GPUShader* initFragmentShader();
+        /// @brief Upload memory shared by all per-frame buffer and texture copies.
+        std::unique_ptr<UploadRing> upload_ring_;
+
+        /// @brief Non-owned; cached by the ShaderManager.
+        SDL_GPUGraphicsPipeline* graphics_pipeline_ = nullptr;
 
     };
 
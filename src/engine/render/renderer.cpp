@@ -3,7 +3,9 @@
 #include "camera.hpp"
 #include "sprite.hpp"
 #include <SDL3/SDL.h>
+#include <cmath>
 #include <stdexcept>
+#include <utility>
 #include <spdlog/spdlog.h>
 
 namespace engine::render {
@@ -30,6 +32,8 @@ namespace engine::render {
         setDrawColor(255, 0, 0, 255);
     }
 
+    Renderer::~Renderer() = default;
+
     void Renderer::drawSprite(
         const Camera& camera,
         const Sprite& sprite,
@@ -47,7 +51,41 @@ namespace engine::render {
             return;
         }
 
-        // glm::vec2 position_screen = camera.worldToScreen(position);
+        glm::vec2 position_screen = camera.worldToScreen(position);
+
+        SDL_FRect dest_rect = {
+            position_screen.x,
+            position_screen.y,
+            src_rect.value().w * scale.x,
+            src_rect.value().h * scale.y
+        };
+
+        // Negative scale mirrors the sprite; keep the rectangle itself positive
+        SDL_FlipMode flip = sprite.isFlipped() ? SDL_FLIP_HORIZONTAL : SDL_FLIP_NONE;
+        if (dest_rect.w < 0.0f) {
+            dest_rect.w = -dest_rect.w;
+            flip = static_cast<SDL_FlipMode>(flip ^ SDL_FLIP_HORIZONTAL);
+        }
+        if (dest_rect.h < 0.0f) {
+            dest_rect.h = -dest_rect.h;
+            flip = static_cast<SDL_FlipMode>(flip ^ SDL_FLIP_VERTICAL);
+        }
+
+        if (!isRectInViewport(camera, dest_rect)) {
+            return;
+        }
+
+        if (!SDL_RenderTextureRotated(
+            renderer_,
+            texture,
+            &src_rect.value(),
+            &dest_rect,
+            angle,
+            nullptr,
+            flip
+        )) {
+            spdlog::error("Could not render sprite (ID: {}): {}", sprite.getTextureId(), SDL_GetError());
+        }
     }
 
     void Renderer::drawParallax(
@@ -58,7 +96,124 @@ namespace engine::render {
         glm::bvec2 repeat,
         const glm::vec2& scale
     ) {
-        spdlog::warn("drawParallax is not implemented!");
+        auto texture = resource_manager_->getTexture(sprite.getTextureId());
+        if (!texture) {
+            spdlog::error("Could not load parallax texture, ID: {}", sprite.getTextureId());
+            return;
+        }
+
+        auto src_rect = getSpriteSrcRect(sprite);
+        if (!src_rect.has_value()) {
+            spdlog::error("Unable to get source rectangle of parallax sprite, ID: {}", sprite.getTextureId());
+            return;
+        }
+
+        glm::vec2 texture_size = resource_manager_->getTextureSize(sprite.getTextureId());
+        if (texture_size.x <= 0.0f || texture_size.y <= 0.0f) {
+            return;
+        }
+
+        glm::vec2 tile_size = glm::abs(glm::vec2(src_rect->w, src_rect->h) * scale);
+        if (tile_size.x < 1.0f || tile_size.y < 1.0f) {
+            return;
+        }
+
+        glm::vec2 viewport_size = camera.getViewportSize();
+        glm::vec2 origin = camera.worldToScreenWithParallax(position, scroll_factor);
+
+        // The visible tile range is computed directly from the wrapped origin, so the
+        // number of quads only depends on viewport and tile size, never on how far the
+        // camera has scrolled.
+        glm::vec2 start = origin;
+        glm::vec2 end = origin + tile_size;
+        if (repeat.x) {
+            start.x = std::fmod(origin.x, tile_size.x);
+            if (start.x > 0.0f) {
+                start.x -= tile_size.x;
+            }
+            end.x = viewport_size.x;
+        }
+        if (repeat.y) {
+            start.y = std::fmod(origin.y, tile_size.y);
+            if (start.y > 0.0f) {
+                start.y -= tile_size.y;
+            }
+            end.y = viewport_size.y;
+        }
+
+        if (end.x < 0.0f || end.y < 0.0f || start.x > viewport_size.x || start.y > viewport_size.y) {
+            return;
+        }
+
+        float u0 = src_rect->x / texture_size.x;
+        float v0 = src_rect->y / texture_size.y;
+        float u1 = (src_rect->x + src_rect->w) / texture_size.x;
+        float v1 = (src_rect->y + src_rect->h) / texture_size.y;
+        if (sprite.isFlipped() != (scale.x < 0.0f)) {
+            std::swap(u0, u1);
+        }
+        if (scale.y < 0.0f) {
+            std::swap(v0, v1);
+        }
+
+        const SDL_FColor white = {1.0f, 1.0f, 1.0f, 1.0f};
+        parallax_vertices_.clear();
+        parallax_indices_.clear();
+
+        for (float y = start.y; y < end.y; y += tile_size.y) {
+            for (float x = start.x; x < end.x; x += tile_size.x) {
+                int base = static_cast<int>(parallax_vertices_.size());
+                parallax_vertices_.push_back({{x, y}, white, {u0, v0}});
+                parallax_vertices_.push_back({{x + tile_size.x, y}, white, {u1, v0}});
+                parallax_vertices_.push_back({{x + tile_size.x, y + tile_size.y}, white, {u1, v1}});
+                parallax_vertices_.push_back({{x, y + tile_size.y}, white, {u0, v1}});
+                parallax_indices_.insert(
+                    parallax_indices_.end(),
+                    {base + 0, base + 1, base + 2, base + 2, base + 3, base + 0}
+                );
+            }
+        }
+
+        if (!SDL_RenderGeometry(
+            renderer_,
+            texture,
+            parallax_vertices_.data(),
+            static_cast<int>(parallax_vertices_.size()),
+            parallax_indices_.data(),
+            static_cast<int>(parallax_indices_.size())
+        )) {
+            spdlog::error("Could not render parallax (ID: {}): {}", sprite.getTextureId(), SDL_GetError());
+            return;
+        }
+
+        ++stats_.geometry_draws;
+        stats_.geometry_vertices += parallax_vertices_.size();
+    }
+
+    void Renderer::drawGeometry(
+        std::string_view texture_id,
+        const SDL_Vertex* vertices,
+        int num_vertices,
+        const int* indices,
+        int num_indices
+    ) {
+        if (!vertices || num_vertices <= 0) {
+            return;
+        }
+
+        auto texture = resource_manager_->getTexture(texture_id);
+        if (!texture) {
+            spdlog::error("Could not load geometry texture, ID: {}", texture_id);
+            return;
+        }
+
+        if (!SDL_RenderGeometry(renderer_, texture, vertices, num_vertices, indices, num_indices)) {
+            spdlog::error("Could not render geometry (texture ID: {}): {}", texture_id, SDL_GetError());
+            return;
+        }
+
+        ++stats_.geometry_draws;
+        stats_.geometry_vertices += static_cast<std::uint64_t>(num_vertices);
     }
 
     void Renderer::drawUISprite(
@@ -163,7 +318,7 @@ namespace engine::render {
     bool Renderer::isRectInViewport(const Camera& camera, const SDL_FRect &rect) {
         glm::vec2 viewport_size = camera.getViewportSize();
         return rect.x + rect.w >= 0 && rect.x <= viewport_size.x &&
-               rect.x + rect.h >= 0 && rect.y <= viewport_size.y;
+               rect.y + rect.h >= 0 && rect.y <= viewport_size.y;
     }
 
 } // namespace engine::render
@@ -3,13 +3,17 @@
 
 #include "sprite.hpp"
 #include "../utils/math.hpp"
+#include <cstdint>
 #include <string>
+#include <string_view>
 #include <optional>
+#include <vector>
 #include <SDL3/SDL_stdinc.h>
 
 struct SDL_Renderer;
 struct SDL_FRect;
 struct SDL_FColor;
+struct SDL_Vertex;
 
 namespace engine::resource {
     class ResourceManager;
@@ -27,11 +31,20 @@ namespace engine::render {
     /// Construction failure will throw an exception.
     class Renderer final {
     public:
+        /// @brief Running totals since construction.
+        struct Stats {
+            /// @brief Batched geometry submissions (drawParallax, drawGeometry).
+            std::uint64_t geometry_draws = 0;
+            std::uint64_t geometry_vertices = 0;
+        };
+
         Renderer(
             SDL_Renderer* sdl_renderer,
             engine::resource::ResourceManager* resource_manager
         );
 
+        ~Renderer();
+
         Renderer(const Renderer&) = delete;
         Renderer& operator=(const Renderer&) = delete;
         Renderer(Renderer&&) = delete;
@@ -45,6 +58,9 @@ namespace engine::render {
             double angle
         );
 
+        /// @brief Draw a background layer that scrolls at `scroll_factor` times the camera
+        /// speed, optionally repeating along each axis. Only the tiles intersecting the
+        /// viewport are emitted, all in a single geometry draw.
         void drawParallax(
             const Camera& camera,
             const Sprite& sprite,
@@ -54,6 +70,16 @@ namespace engine::render {
             const glm::vec2& scale = {1.0f, 1.0f}
         );
 
+        /// @brief Draw pre-built triangle geometry textured with `texture_id`, in screen
+        /// coordinates. Used for batched draws such as tilemap chunks.
+        void drawGeometry(
+            std::string_view texture_id,
+            const SDL_Vertex* vertices,
+            int num_vertices,
+            const int* indices,
+            int num_indices
+        );
+
         void drawUISprite(
             const Sprite& sprite,
             const glm::vec2& position,
@@ -71,6 +97,7 @@ namespace engine::render {
         void setDrawColorFloat(float r, float g, float b, float a = 1.0f);
 
         SDL_Renderer* getSDLRenderer() const { return renderer_; }
+        const Stats& getStats() const { return stats_; }
 
     private:
         /// @brief Non-owned pointer to SDL_Renderer.
@@ -79,6 +106,12 @@ namespace engine::render {
         /// @brief Non-owned pointer to ResourceManager.
         engine::resource::ResourceManager* resource_manager_ = nullptr;
 
+        Stats stats_;
+
+        /// @brief Scratch geometry for drawParallax, reused between calls.
+        std::vector<SDL_Vertex> parallax_vertices_;
+        std::vector<int> parallax_indices_;
+
         /// @brief Get the source rectangle of the sprite for specific drawing. If an
         /// error occurs, return `std::nullopt` and skip drawing.
         std::optional<SDL_FRect> getSpriteSrcRect(const Sprite& sprite);
@@ -0,0 +1,93 @@
+#include "sprite_index.hpp"
+#include "camera.hpp"
+#include "../object/components/sprite_component.hpp"
+#include <algorithm>
+
+namespace engine::render {
+
+    using engine::object::components::SpriteComponent;
+
+    SpriteIndex::SpriteIndex(float cell_size) : grid_(cell_size) {}
+
+    SpriteIndex::~SpriteIndex() {
+        // Detach remaining sprites so they don't call back into a dead index
+        for (SpriteComponent* sprite : sprites_) {
+            if (sprite) {
+                sprite->index_ = nullptr;
+                sprite->index_handle_ = engine::utils::SpatialGrid::INVALID_HANDLE;
+            }
+        }
+    }
+
+    void SpriteIndex::add(SpriteComponent* sprite) {
+        if (!sprite || sprite->index_ == this) {
+            return;
+        }
+
+        if (sprite->index_) {
+            sprite->index_->remove(sprite);
+        }
+
+        auto bounds = sprite->getWorldBounds();
+        auto handle = grid_.insert(bounds);
+        if (handle >= sprites_.size()) {
+            sprites_.resize(handle + 1, nullptr);
+        }
+
+        sprites_[handle] = sprite;
+        sprite->index_ = this;
+        sprite->index_handle_ = handle;
+        sprite->indexed_bounds_ = bounds;
+    }
+
+    void SpriteIndex::remove(SpriteComponent* sprite) {
+        if (!sprite || sprite->index_ != this) {
+            return;
+        }
+
+        grid_.remove(sprite->index_handle_);
+        sprites_[sprite->index_handle_] = nullptr;
+        sprite->index_ = nullptr;
+        sprite->index_handle_ = engine::utils::SpatialGrid::INVALID_HANDLE;
+    }
+
+    void SpriteIndex::update(SpriteComponent* sprite) {
+        if (!sprite || sprite->index_ != this) {
+            return;
+        }
+
+        auto bounds = sprite->getWorldBounds();
+        grid_.update(sprite->index_handle_, bounds);
+        sprite->indexed_bounds_ = bounds;
+    }
+
+    void SpriteIndex::collectVisible(const Camera& camera, std::pmr::vector<SpriteComponent*>& out) {
+        out.clear();
+        query_result_.clear();
+
+        engine::utils::Rect view{camera.getPosition(), camera.getViewportSize()};
+        grid_.query(view, query_result_);
+
+        // Grid order depends on cell layout; sort by handle for a stable draw order
+        std::sort(query_result_.begin(), query_result_.end());
+
+        for (auto handle : query_result_) {
+            SpriteComponent* sprite = sprites_[handle];
+            if (!sprite || sprite->isHidden()) {
+                continue;
+            }
+
+            // Exact test; the grid only guarantees that the cells overlap
+            const auto& bounds = sprite->indexed_bounds_;
+            if (bounds.position.x + bounds.size.x < view.position.x ||
+                bounds.position.y + bounds.size.y < view.position.y ||
+                bounds.position.x > view.position.x + view.size.x ||
+                bounds.position.y > view.position.y + view.size.y) {
+                continue;
+            }
+
+            out.push_back(sprite);
+        }
+    }
+
+} // namespace engine::render
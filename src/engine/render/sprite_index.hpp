@@ -0,0 +1,58 @@
+#ifndef SPRITE_INDEX_HPP_
+#define SPRITE_INDEX_HPP_
+
+#include "../utils/spatial_grid.hpp"
+#include <memory_resource>
+#include <vector>
+
+namespace engine::object::components {
+    class SpriteComponent;
+}
+
+namespace engine::render {
+    class Camera;
+
+    /// @brief Spatial index of the world sprites in a scene, used for viewport culling.
+    ///
+    /// Sprites are kept in a uniform grid over their world bounds. SpriteComponents
+    /// report their own movement, so the per-frame cost of culling is proportional to
+    /// the number of visible sprites rather than the number of sprites in the world.
+    class SpriteIndex final {
+    public:
+        explicit SpriteIndex(float cell_size = 256.0f);
+        ~SpriteIndex();
+
+        SpriteIndex(const SpriteIndex&) = delete;
+        SpriteIndex& operator=(const SpriteIndex&) = delete;
+        SpriteIndex(SpriteIndex&&) = delete;
+        SpriteIndex& operator=(SpriteIndex&&) = delete;
+
+        void add(engine::object::components::SpriteComponent* sprite);
+        void remove(engine::object::components::SpriteComponent* sprite);
+
+        /// @brief Refresh the indexed bounds of a sprite after it moved or resized.
+        void update(engine::object::components::SpriteComponent* sprite);
+
+        /// @brief Collect the sprites overlapping the camera viewport into `out` (which is
+        /// cleared first). Sprites are returned in a stable order so that draw order does
+        /// not flicker as the camera moves.
+        void collectVisible(
+            const Camera& camera,
+            std::pmr::vector<engine::object::components::SpriteComponent*>& out
+        );
+
+        std::size_t size() const { return grid_.size(); }
+
+    private:
+        engine::utils::SpatialGrid grid_;
+
+        /// @brief Registered sprites, indexed by grid handle.
+        std::vector<engine::object::components::SpriteComponent*> sprites_;
+
+        /// @brief Scratch buffer for grid queries, reused between frames.
+        std::vector<engine::utils::SpatialGrid::Handle> query_result_;
+    };
+
+} // namespace engine::render
+
+#endif // SPRITE_INDEX_HPP_
@@ -36,6 +36,11 @@ namespace engine::render {
     }
 
     void TextRenderer::close() {
+        if (scratch_text_) {
+            TTF_DestroyText(scratch_text_);
+            scratch_text_ = nullptr;
+        }
+
         if (text_engine_) {
             TTF_DestroyRendererTextEngine(text_engine_);
             text_engine_ = nullptr;
@@ -56,7 +61,7 @@ namespace engine::render {
             return;
         }
 
-        TTF_Text* temp_text_object = TTF_CreateText(text_engine_, font, text.data(), 0);
+        TTF_Text* temp_text_object = prepareText(text, font);
         if (!temp_text_object) {
             return;
         }
@@ -70,8 +75,6 @@ namespace engine::render {
         if (!TTF_DrawRendererText(temp_text_object, position.x, position.y)) {
             spdlog::error("{}", SDL_GetError());
         }
-
-        TTF_DestroyText(temp_text_object);
     }
 
     void TextRenderer::drawText(
@@ -92,16 +95,36 @@ namespace engine::render {
             return glm::vec2(0.0f, 0.0f);
         }
 
-        TTF_Text* temp_text_object = TTF_CreateText(text_engine_, font, text.data(), 0);
+        TTF_Text* temp_text_object = prepareText(text, font);
         if (!temp_text_object) {
             return glm::vec2(0.0f, 0.0f);
         }
 
         int width, height;
         TTF_GetTextSize(temp_text_object, &width, &height);
-        TTF_DestroyText(temp_text_object);
 
         return glm::vec2(static_cast<float>(width), static_cast<float>(height));
     }
 
+    TTF_Text* TextRenderer::prepareText(std::string_view text, TTF_Font* font) {
+        // A length of 0 would mean "null-terminated", which a string_view is not
+        if (text.empty()) {
+            return nullptr;
+        }
+
+        if (!scratch_text_) {
+            scratch_text_ = TTF_CreateText(text_engine_, font, text.data(), text.size());
+            if (!scratch_text_) {
+                spdlog::error("Failed to create TTF_Text: {}", SDL_GetError());
+            }
+            return scratch_text_;
+        }
+
+        if (!TTF_SetTextFont(scratch_text_, font) || !TTF_SetTextString(scratch_text_, text.data(), text.size())) {
+            spdlog::error("Failed to update TTF_Text: {}", SDL_GetError());
+            return nullptr;
+        }
+        return scratch_text_;
+    }
+
 } // namespace engine::render
@@ -8,6 +8,8 @@
 #include "../utils/math.hpp"
 
 struct TTF_TextEngine;
+struct TTF_Text;
+struct TTF_Font;
 
 namespace engine::resource {
     class ResourceManager;
@@ -57,6 +59,11 @@ namespace engine::render {
         engine::resource::ResourceManager* resource_manager_ = nullptr;
         TTF_TextEngine* text_engine_ = nullptr;
 
+        /// @brief Text object reused by every draw and measurement instead of creating one per call.
+        TTF_Text* scratch_text_ = nullptr;
+
+        /// @brief Point the scratch text at `font` and `text`. Returns null on failure.
+        TTF_Text* prepareText(std::string_view text, TTF_Font* font);
     };
 
 } // namespace engine::render
@@ -0,0 +1,266 @@
+#include "tilemap.hpp"
+#include "renderer.hpp"
+#include "camera.hpp"
+#include "../resource/resource_manager.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <spdlog/spdlog.h>
+
+namespace engine::render {
+
+    Tilemap::Tilemap(
+        glm::ivec2 map_size,
+        Tileset tileset,
+        engine::resource::ResourceManager& resource_manager
+    )
+        : map_size_(map_size)
+        , chunk_count_(0, 0)
+        , tileset_(std::move(tileset))
+        , resource_manager_(resource_manager)
+    {
+        if (map_size_.x <= 0 || map_size_.y <= 0) {
+            throw std::invalid_argument("Tilemap size must be positive.");
+        }
+
+        if (tileset_.tile_size.x <= 0 || tileset_.tile_size.y <= 0) {
+            throw std::invalid_argument("Tileset tile size must be positive.");
+        }
+
+        texture_size_ = resource_manager_.getTextureSize(tileset_.texture_id);
+        if (tileset_.columns <= 0) {
+            tileset_.columns = std::max(1, static_cast<int>(texture_size_.x) / tileset_.tile_size.x);
+        }
+
+        chunk_count_ = {
+            (map_size_.x + CHUNK_SIZE - 1) / CHUNK_SIZE,
+            (map_size_.y + CHUNK_SIZE - 1) / CHUNK_SIZE
+        };
+
+        chunks_.resize(static_cast<std::size_t>(chunk_count_.x) * chunk_count_.y);
+        for (auto& chunk : chunks_) {
+            chunk.tiles.assign(CHUNK_SIZE * CHUNK_SIZE, EMPTY_TILE);
+        }
+
+        spdlog::debug(
+            "Created tilemap {}x{} ({}x{} chunks) with tileset '{}'.",
+            map_size_.x, map_size_.y, chunk_count_.x, chunk_count_.y, tileset_.texture_id
+        );
+    }
+
+    Tilemap::TileId Tilemap::getTile(int x, int y) const {
+        if (x < 0 || y < 0 || x >= map_size_.x || y >= map_size_.y) {
+            return EMPTY_TILE;
+        }
+
+        const Chunk& chunk = chunks_[(y / CHUNK_SIZE) * chunk_count_.x + (x / CHUNK_SIZE)];
+        return chunk.tiles[(y % CHUNK_SIZE) * CHUNK_SIZE + (x % CHUNK_SIZE)];
+    }
+
+    void Tilemap::setTile(int x, int y, TileId tile) {
+        if (x < 0 || y < 0 || x >= map_size_.x || y >= map_size_.y) {
+            spdlog::warn("Tilemap::setTile out of bounds: ({}, {}).", x, y);
+            return;
+        }
+
+        Chunk& chunk = chunks_[(y / CHUNK_SIZE) * chunk_count_.x + (x / CHUNK_SIZE)];
+        TileId& current = chunk.tiles[(y % CHUNK_SIZE) * CHUNK_SIZE + (x % CHUNK_SIZE)];
+        if (current != tile) {
+            current = tile;
+            chunk.dirty = true;
+        }
+    }
+
+    void Tilemap::setTiles(const std::vector<TileId>& tiles) {
+        if (tiles.size() != static_cast<std::size_t>(map_size_.x) * map_size_.y) {
+            spdlog::error(
+                "Tilemap::setTiles expected {} tiles but got {}.",
+                static_cast<std::size_t>(map_size_.x) * map_size_.y,
+                tiles.size()
+            );
+            return;
+        }
+
+        for (int y = 0; y < map_size_.y; ++y) {
+            for (int x = 0; x < map_size_.x; ++x) {
+                Chunk& chunk = chunks_[(y / CHUNK_SIZE) * chunk_count_.x + (x / CHUNK_SIZE)];
+                chunk.tiles[(y % CHUNK_SIZE) * CHUNK_SIZE + (x % CHUNK_SIZE)] =
+                    tiles[static_cast<std::size_t>(y) * map_size_.x + x];
+            }
+        }
+
+        for (auto& chunk : chunks_) {
+            chunk.dirty = true;
+        }
+    }
+
+    void Tilemap::setPosition(glm::vec2 position) {
+        position_ = std::move(position);
+    }
+
+    engine::utils::Rect Tilemap::getWorldBounds() const {
+        return engine::utils::Rect{
+            position_,
+            glm::vec2(map_size_.x * tileset_.tile_size.x, map_size_.y * tileset_.tile_size.y)
+        };
+    }
+
+    void Tilemap::render(Renderer& renderer, const Camera& camera) {
+        ++frame_;
+        stats_.visible_chunks = 0;
+        stats_.submitted_quads = 0;
+
+        glm::vec2 chunk_pixels(
+            static_cast<float>(CHUNK_SIZE * tileset_.tile_size.x),
+            static_cast<float>(CHUNK_SIZE * tileset_.tile_size.y)
+        );
+
+        // Viewport in map-local pixels, converted to an inclusive chunk range
+        glm::vec2 view_min = camera.getPosition() - position_;
+        glm::vec2 view_max = view_min + camera.getViewportSize();
+
+        int first_x = std::max(0, static_cast<int>(std::floor(view_min.x / chunk_pixels.x)));
+        int first_y = std::max(0, static_cast<int>(std::floor(view_min.y / chunk_pixels.y)));
+        int last_x = std::min(chunk_count_.x - 1, static_cast<int>(std::floor(view_max.x / chunk_pixels.x)));
+        int last_y = std::min(chunk_count_.y - 1, static_cast<int>(std::floor(view_max.y / chunk_pixels.y)));
+
+        frame_vertices_.clear();
+
+        for (int chunk_y = first_y; chunk_y <= last_y; ++chunk_y) {
+            for (int chunk_x = first_x; chunk_x <= last_x; ++chunk_x) {
+                Chunk& chunk = chunks_[static_cast<std::size_t>(chunk_y) * chunk_count_.x + chunk_x];
+                if (chunk.dirty) {
+                    rebuildChunk(chunk, chunk_x, chunk_y);
+                }
+
+                chunk.last_drawn_frame = frame_;
+                ++stats_.visible_chunks;
+
+                if (chunk.quad_count == 0) {
+                    continue;
+                }
+
+                glm::vec2 origin = camera.worldToScreen(
+                    position_ + glm::vec2(chunk_x * chunk_pixels.x, chunk_y * chunk_pixels.y)
+                );
+
+                // Cached geometry is chunk-relative; only the translation is per-frame
+                std::size_t offset = frame_vertices_.size();
+                frame_vertices_.insert(frame_vertices_.end(), chunk.vertices.begin(), chunk.vertices.end());
+                for (std::size_t i = offset; i < frame_vertices_.size(); ++i) {
+                    frame_vertices_[i].position.x += origin.x;
+                    frame_vertices_[i].position.y += origin.y;
+                }
+
+                stats_.submitted_quads += chunk.quad_count;
+            }
+        }
+
+        if (stats_.submitted_quads > 0) {
+            ensureIndexCapacity(stats_.submitted_quads);
+            renderer.drawGeometry(
+                tileset_.texture_id,
+                frame_vertices_.data(),
+                static_cast<int>(frame_vertices_.size()),
+                quad_indices_.data(),
+                static_cast<int>(stats_.submitted_quads * 6)
+            );
+        }
+
+        trimCache(max_cached_chunks_);
+        stats_.cached_chunks = cached_chunk_indices_.size();
+    }
+
+    void Tilemap::trimCache(std::size_t max_chunks) {
+        if (cached_chunk_indices_.size() <= max_chunks) {
+            return;
+        }
+
+        // Keep the most recently drawn chunks, drop the geometry of the rest
+        auto keep_end = cached_chunk_indices_.begin() + static_cast<std::ptrdiff_t>(max_chunks);
+        std::nth_element(
+            cached_chunk_indices_.begin(),
+            keep_end,
+            cached_chunk_indices_.end(),
+            [this](std::size_t a, std::size_t b) {
+                return chunks_[a].last_drawn_frame > chunks_[b].last_drawn_frame;
+            }
+        );
+
+        for (auto it = keep_end; it != cached_chunk_indices_.end(); ++it) {
+            Chunk& chunk = chunks_[*it];
+            chunk.vertices.clear();
+            chunk.vertices.shrink_to_fit();
+            chunk.quad_count = 0;
+            chunk.cached = false;
+            chunk.dirty = true;
+        }
+
+        cached_chunk_indices_.erase(keep_end, cached_chunk_indices_.end());
+    }
+
+    void Tilemap::rebuildChunk(Chunk& chunk, int chunk_x, int chunk_y) {
+        const float tile_w = static_cast<float>(tileset_.tile_size.x);
+        const float tile_h = static_cast<float>(tileset_.tile_size.y);
+        const float u_step = texture_size_.x > 0.0f ? tile_w / texture_size_.x : 0.0f;
+        const float v_step = texture_size_.y > 0.0f ? tile_h / texture_size_.y : 0.0f;
+        const SDL_FColor white = {1.0f, 1.0f, 1.0f, 1.0f};
+
+        chunk.vertices.clear();
+        chunk.quad_count = 0;
+
+        for (int local_y = 0; local_y < CHUNK_SIZE; ++local_y) {
+            for (int local_x = 0; local_x < CHUNK_SIZE; ++local_x) {
+                TileId tile = chunk.tiles[local_y * CHUNK_SIZE + local_x];
+                if (tile == EMPTY_TILE) {
+                    continue;
+                }
+
+                int index = tile - 1;
+                float u0 = static_cast<float>(index % tileset_.columns) * u_step;
+                float v0 = static_cast<float>(index / tileset_.columns) * v_step;
+                float u1 = u0 + u_step;
+                float v1 = v0 + v_step;
+
+                float x0 = local_x * tile_w;
+                float y0 = local_y * tile_h;
+                float x1 = x0 + tile_w;
+                float y1 = y0 + tile_h;
+
+                chunk.vertices.push_back({{x0, y0}, white, {u0, v0}});
+                chunk.vertices.push_back({{x1, y0}, white, {u1, v0}});
+                chunk.vertices.push_back({{x1, y1}, white, {u1, v1}});
+                chunk.vertices.push_back({{x0, y1}, white, {u0, v1}});
+                ++chunk.quad_count;
+            }
+        }
+
+        chunk.dirty = false;
+        ++stats_.chunk_rebuilds;
+
+        if (!chunk.cached) {
+            chunk.cached = true;
+            cached_chunk_indices_.push_back(static_cast<std::size_t>(chunk_y) * chunk_count_.x + chunk_x);
+        }
+    }
+
+    void Tilemap::ensureIndexCapacity(std::size_t quad_count) {
+        std::size_t built_quads = quad_indices_.size() / 6;
+        if (built_quads >= quad_count) {
+            return;
+        }
+
+        // The quad index pattern never changes, so it is only ever extended
+        quad_indices_.reserve(quad_count * 6);
+        for (std::size_t quad = built_quads; quad < quad_count; ++quad) {
+            int base = static_cast<int>(quad * 4);
+            quad_indices_.push_back(base + 0);
+            quad_indices_.push_back(base + 1);
+            quad_indices_.push_back(base + 2);
+            quad_indices_.push_back(base + 2);
+            quad_indices_.push_back(base + 3);
+            quad_indices_.push_back(base + 0);
+        }
+    }
+
+} // namespace engine::render
@@ -0,0 +1,122 @@
+#ifndef TILEMAP_HPP_
+#define TILEMAP_HPP_
+
+#include "../utils/math.hpp"
+#include <SDL3/SDL_render.h>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace engine::resource {
+    class ResourceManager;
+}
+
+namespace engine::render {
+    class Renderer;
+    class Camera;
+
+    /// @brief Tileset texture layout used by a Tilemap.
+    struct Tileset {
+        std::string texture_id;
+        glm::ivec2 tile_size = {16, 16};
+
+        /// @brief Number of tiles per row in the texture. 0 = derive from texture width.
+        int columns = 0;
+    };
+
+    /// @brief Chunked tile layer drawn from a single tileset texture.
+    ///
+    /// Tiles are grouped into CHUNK_SIZE x CHUNK_SIZE chunks. The geometry of a chunk is
+    /// built the first time it becomes visible and cached until one of its tiles is
+    /// edited, so a static level costs one vertex copy per visible tile and a single
+    /// draw call per frame regardless of map size.
+    class Tilemap final {
+    public:
+        /// @brief Tile index into the tileset, 1-based. 0 means "no tile".
+        using TileId = std::uint16_t;
+        static constexpr TileId EMPTY_TILE = 0;
+        static constexpr int CHUNK_SIZE = 32;
+
+        struct Stats {
+            std::size_t visible_chunks = 0;
+            std::size_t cached_chunks = 0;
+            std::size_t chunk_rebuilds = 0;
+            std::size_t submitted_quads = 0;
+        };
+
+        Tilemap(
+            glm::ivec2 map_size,
+            Tileset tileset,
+            engine::resource::ResourceManager& resource_manager
+        );
+
+        Tilemap(const Tilemap&) = delete;
+        Tilemap& operator=(const Tilemap&) = delete;
+        Tilemap(Tilemap&&) = delete;
+        Tilemap& operator=(Tilemap&&) = delete;
+
+        TileId getTile(int x, int y) const;
+
+        /// @brief Change a tile. Only the containing chunk is rebuilt, on its next draw.
+        void setTile(int x, int y, TileId tile);
+
+        /// @brief Replace all tiles from a row-major array of map_size.x * map_size.y ids.
+        void setTiles(const std::vector<TileId>& tiles);
+
+        /// @brief Draw the chunks overlapping the camera viewport.
+        void render(Renderer& renderer, const Camera& camera);
+
+        /// @brief Drop cached geometry of chunks not drawn for a while once more than
+        /// `max_chunks` are cached. Called from render() with the configured limit.
+        void trimCache(std::size_t max_chunks);
+
+        void setMaxCachedChunks(std::size_t max_chunks) { max_cached_chunks_ = max_chunks; }
+        void setPosition(glm::vec2 position);
+
+        const glm::ivec2& getMapSize() const { return map_size_; }
+        const Tileset& getTileset() const { return tileset_; }
+        const glm::vec2& getPosition() const { return position_; }
+        const Stats& getStats() const { return stats_; }
+
+        /// @brief World-space area covered by the map, e.g. for Camera::setLimitBounds.
+        engine::utils::Rect getWorldBounds() const;
+
+    private:
+        struct Chunk {
+            std::vector<TileId> tiles;
+
+            /// @brief Cached quads with positions relative to the chunk origin.
+            std::vector<SDL_Vertex> vertices;
+            std::size_t quad_count = 0;
+            std::uint64_t last_drawn_frame = 0;
+            bool dirty = true;
+            bool cached = false;
+        };
+
+        glm::ivec2 map_size_;
+        glm::ivec2 chunk_count_;
+        Tileset tileset_;
+        glm::vec2 texture_size_ = {0.0f, 0.0f};
+        glm::vec2 position_ = {0.0f, 0.0f};
+        engine::resource::ResourceManager& resource_manager_;
+
+        std::vector<Chunk> chunks_;
+        std::vector<std::size_t> cached_chunk_indices_;
+        std::size_t max_cached_chunks_ = 1024;
+        std::uint64_t frame_ = 0;
+        Stats stats_;
+
+        /// @brief Per-frame vertex scratch buffer for the batched draw call.
+        std::vector<SDL_Vertex> frame_vertices_;
+
+        /// @brief Shared quad index pattern, grown on demand.
+        std::vector<int> quad_indices_;
+
+        void rebuildChunk(Chunk& chunk, int chunk_x, int chunk_y);
+        void ensureIndexCapacity(std::size_t quad_count);
+    };
+
+} // namespace engine::render
+
+#endif // TILEMAP_HPP_
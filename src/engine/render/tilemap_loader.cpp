@@ -0,0 +1,178 @@
+#include "tilemap_loader.hpp"
+#include "tilemap.hpp"
+#include "../resource/resource_manager.hpp"
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <nlohmann/json.hpp>
+#include <spdlog/spdlog.h>
+
+namespace engine::render {
+
+    namespace {
+
+        constexpr char BINARY_MAGIC[4] = {'S', 'T', 'M', 'P'};
+        constexpr std::uint16_t BINARY_VERSION = 1;
+
+        /// @brief Fixed-size part of the binary header, after the magic.
+        struct BinaryHeader {
+            std::uint16_t version;
+            std::uint16_t reserved;
+            std::int32_t width;
+            std::int32_t height;
+            std::int32_t tile_width;
+            std::int32_t tile_height;
+            std::int32_t columns;
+            std::uint32_t texture_id_length;
+        };
+
+        static_assert(sizeof(BinaryHeader) == 28, "Tilemap binary header must be tightly packed.");
+
+    } // namespace
+
+    TilemapLoader::TilemapLoader(engine::resource::ResourceManager& resource_manager)
+        : resource_manager_(resource_manager) {}
+
+    std::unique_ptr<Tilemap> TilemapLoader::load(std::string_view file_path) {
+        std::ifstream file(std::filesystem::path(file_path), std::ios::binary);
+        if (!file.is_open()) {
+            spdlog::error("Unable to open tilemap file '{}'.", file_path);
+            return nullptr;
+        }
+
+        std::string bytes{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+
+        try {
+            if (bytes.size() >= sizeof(BINARY_MAGIC) &&
+                std::memcmp(bytes.data(), BINARY_MAGIC, sizeof(BINARY_MAGIC)) == 0) {
+                return loadBinary(bytes, file_path);
+            }
+            return loadJson(bytes, file_path);
+        }
+
+        catch (const std::exception& exc) {
+            spdlog::error("Error loading tilemap '{}': {}", file_path, exc.what());
+        }
+
+        return nullptr;
+    }
+
+    bool TilemapLoader::save(const Tilemap& tilemap, std::string_view file_path) {
+        std::ofstream file(std::filesystem::path(file_path), std::ios::binary);
+        if (!file.is_open()) {
+            spdlog::error("Unable to open tilemap file '{}' for writing.", file_path);
+            return false;
+        }
+
+        const auto& map_size = tilemap.getMapSize();
+        const auto& tileset = tilemap.getTileset();
+
+        BinaryHeader header{};
+        header.version = BINARY_VERSION;
+        header.width = map_size.x;
+        header.height = map_size.y;
+        header.tile_width = tileset.tile_size.x;
+        header.tile_height = tileset.tile_size.y;
+        header.columns = tileset.columns;
+        header.texture_id_length = static_cast<std::uint32_t>(tileset.texture_id.size());
+
+        std::vector<Tilemap::TileId> tiles;
+        tiles.reserve(static_cast<std::size_t>(map_size.x) * map_size.y);
+        for (int y = 0; y < map_size.y; ++y) {
+            for (int x = 0; x < map_size.x; ++x) {
+                tiles.push_back(tilemap.getTile(x, y));
+            }
+        }
+
+        file.write(BINARY_MAGIC, sizeof(BINARY_MAGIC));
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(tileset.texture_id.data(), static_cast<std::streamsize>(tileset.texture_id.size()));
+        file.write(
+            reinterpret_cast<const char*>(tiles.data()),
+            static_cast<std::streamsize>(tiles.size() * sizeof(Tilemap::TileId))
+        );
+
+        if (!file) {
+            spdlog::error("Error writing tilemap file '{}'.", file_path);
+            return false;
+        }
+
+        spdlog::info("Saved tilemap {}x{} to '{}'.", map_size.x, map_size.y, file_path);
+        return true;
+    }
+
+    std::unique_ptr<Tilemap> TilemapLoader::loadBinary(const std::string& bytes, std::string_view file_path) {
+        // The format is little-endian and read in place, which matches every platform
+        // SDL3 ships for; a big-endian port would need to swap here.
+        std::size_t offset = sizeof(BINARY_MAGIC);
+
+        BinaryHeader header{};
+        if (bytes.size() < offset + sizeof(header)) {
+            throw std::runtime_error("truncated header");
+        }
+        std::memcpy(&header, bytes.data() + offset, sizeof(header));
+        offset += sizeof(header);
+
+        if (header.version != BINARY_VERSION) {
+            throw std::runtime_error("unsupported version " + std::to_string(header.version));
+        }
+
+        if (header.width <= 0 || header.height <= 0) {
+            throw std::runtime_error("invalid map size");
+        }
+
+        if (bytes.size() < offset + header.texture_id_length) {
+            throw std::runtime_error("truncated texture id");
+        }
+        std::string texture_id = bytes.substr(offset, header.texture_id_length);
+        offset += header.texture_id_length;
+
+        std::size_t tile_count = static_cast<std::size_t>(header.width) * header.height;
+        if (bytes.size() < offset + tile_count * sizeof(Tilemap::TileId)) {
+            throw std::runtime_error("truncated tile data");
+        }
+
+        std::vector<Tilemap::TileId> tiles(tile_count);
+        std::memcpy(tiles.data(), bytes.data() + offset, tile_count * sizeof(Tilemap::TileId));
+
+        Tileset tileset{
+            std::move(texture_id),
+            glm::ivec2(header.tile_width, header.tile_height),
+            header.columns
+        };
+
+        auto tilemap = std::make_unique<Tilemap>(
+            glm::ivec2(header.width, header.height),
+            std::move(tileset),
+            resource_manager_
+        );
+        tilemap->setTiles(tiles);
+
+        spdlog::info("Loaded tilemap {}x{} from '{}'.", header.width, header.height, file_path);
+        return tilemap;
+    }
+
+    std::unique_ptr<Tilemap> TilemapLoader::loadJson(const std::string& bytes, std::string_view file_path) {
+        auto j = nlohmann::json::parse(bytes);
+
+        glm::ivec2 map_size(j.at("width").get<int>(), j.at("height").get<int>());
+
+        const auto& tileset_json = j.at("tileset");
+        Tileset tileset{
+            tileset_json.at("texture").get<std::string>(),
+            glm::ivec2(j.value("tile_width", 16), j.value("tile_height", 16)),
+            tileset_json.value("columns", 0)
+        };
+
+        auto tiles = j.at("data").get<std::vector<Tilemap::TileId>>();
+
+        auto tilemap = std::make_unique<Tilemap>(map_size, std::move(tileset), resource_manager_);
+        tilemap->setTiles(tiles);
+
+        spdlog::info("Loaded tilemap {}x{} from '{}'.", map_size.x, map_size.y, file_path);
+        return tilemap;
+    }
+
+} // namespace engine::render
@@ -0,0 +1,51 @@
+#ifndef TILEMAP_LOADER_HPP_
+#define TILEMAP_LOADER_HPP_
+
+#include <memory>
+#include <string_view>
+
+namespace engine::resource {
+    class ResourceManager;
+}
+
+namespace engine::render {
+    class Tilemap;
+
+    /**
+     * @brief Load and save tilemaps.
+     *
+     * Two formats are understood, selected by the file contents:
+     *
+     * - JSON, convenient for hand-written or exported levels:
+     *   `{"width", "height", "tile_width", "tile_height",
+     *     "tileset": {"texture", "columns"}, "data": [tile ids...]}`
+     * - A compact little-endian binary format ("STMP" magic) holding the same header
+     *   followed by the raw uint16 tile ids in row-major order. This is what save()
+     *   writes and is the preferred format for large maps.
+     */
+    class TilemapLoader final {
+    public:
+        explicit TilemapLoader(engine::resource::ResourceManager& resource_manager);
+
+        TilemapLoader(const TilemapLoader&) = delete;
+        TilemapLoader& operator=(const TilemapLoader&) = delete;
+        TilemapLoader(TilemapLoader&&) = delete;
+        TilemapLoader& operator=(TilemapLoader&&) = delete;
+
+        /// @brief Load a tilemap from a JSON or binary file.
+        /// @return The tilemap, or nullptr if the file is missing or malformed.
+        std::unique_ptr<Tilemap> load(std::string_view file_path);
+
+        /// @brief Write a tilemap in the binary format.
+        [[nodiscard]] bool save(const Tilemap& tilemap, std::string_view file_path);
+
+    private:
+        engine::resource::ResourceManager& resource_manager_;
+
+        std::unique_ptr<Tilemap> loadBinary(const std::string& bytes, std::string_view file_path);
+        std::unique_ptr<Tilemap> loadJson(const std::string& bytes, std::string_view file_path);
+    };
+
+} // namespace engine::render
+
+#endif // TILEMAP_LOADER_HPP_
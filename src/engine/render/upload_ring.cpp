@@ -0,0 +1,218 @@
+#include "upload_ring.hpp"
+#include <SDL3/SDL.h>
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <spdlog/spdlog.h>
+
+namespace engine::render {
+
+    UploadRing::UploadRing(SDL_GPUDevice* device, std::uint32_t capacity)
+        : device_(device)
+    {
+        if (!device_) {
+            throw std::runtime_error("UploadRing failed to load: The provided SDL_GPUDevice pointer is empty.");
+        }
+
+        if (!recreate(std::max<std::uint32_t>(capacity, 64u * 1024u))) {
+            throw std::runtime_error("UploadRing failed to create its transfer buffer.");
+        }
+    }
+
+    UploadRing::~UploadRing() {
+        release();
+    }
+
+    std::optional<UploadRing::Allocation> UploadRing::allocate(std::uint32_t size, std::uint32_t alignment) {
+        if (size == 0 || !transfer_buffer_) {
+            return std::nullopt;
+        }
+
+        // Too big for what is left: submit what the ring holds and restart at 0; too big
+        // for the whole ring: grow it right away
+        auto placement = allocator_.place(size, alignment);
+        if (placement.wraps) {
+            submitEarly();
+        }
+        if (placement.grow_to > 0 && !recreate(placement.grow_to)) {
+            return std::nullopt;
+        }
+
+        if (!mapped_ && !map()) {
+            return std::nullopt;
+        }
+
+        allocator_.commit(placement, size);
+        return Allocation{mapped_ + placement.offset, placement.offset, size};
+    }
+
+    bool UploadRing::uploadToBuffer(
+        SDL_GPUBuffer* buffer,
+        std::uint32_t buffer_offset,
+        const void* data,
+        std::uint32_t size,
+        bool cycle
+    ) {
+        if (!buffer || !data) {
+            return false;
+        }
+
+        auto allocation = allocate(size);
+        if (!allocation) {
+            spdlog::error("UploadRing could not allocate {} bytes for a buffer upload.", size);
+            return false;
+        }
+
+        std::memcpy(allocation->data, data, size);
+        buffer_copies_.push_back({allocation->offset, {buffer, buffer_offset, size}, cycle});
+        ++frame_copies_;
+        return true;
+    }
+
+    bool UploadRing::uploadToTexture(
+        const SDL_GPUTextureRegion& region,
+        const void* pixels,
+        std::uint32_t size,
+        bool cycle
+    ) {
+        if (!region.texture || !pixels) {
+            return false;
+        }
+
+        auto allocation = allocate(size);
+        if (!allocation) {
+            spdlog::error("UploadRing could not allocate {} bytes for a texture upload.", size);
+            return false;
+        }
+
+        std::memcpy(allocation->data, pixels, size);
+        texture_copies_.push_back({allocation->offset, region, cycle});
+        ++frame_copies_;
+        return true;
+    }
+
+    void UploadRing::flush(SDL_GPUCommandBuffer* command_buffer) {
+        unmap();
+        recordCopies(command_buffer);
+
+        std::uint64_t frame_bytes = allocator_.getFrameBytes();
+        stats_.last_frame_bytes = frame_bytes;
+        stats_.last_frame_copies = frame_copies_;
+        stats_.peak_frame_bytes = std::max(stats_.peak_frame_bytes, frame_bytes);
+        stats_.total_bytes += frame_bytes;
+        frame_copies_ = 0;
+
+        // Grow so that a frame like this one fits without an early submit next time
+        if (std::uint32_t grow_to = allocator_.endFrame(); grow_to > 0) {
+            recreate(grow_to);
+        }
+    }
+
+    void UploadRing::release() {
+        if (!transfer_buffer_) {
+            return;
+        }
+
+        unmap();
+        buffer_copies_.clear();
+        texture_copies_.clear();
+        SDL_ReleaseGPUTransferBuffer(device_, transfer_buffer_);
+        transfer_buffer_ = nullptr;
+        allocator_.setCapacity(0);
+        stats_.capacity = 0;
+    }
+
+    bool UploadRing::map() {
+        // cycle=true: if the GPU still reads the previous contents, SDL hands out new
+        // backing memory instead of waiting for it
+        mapped_ = static_cast<std::uint8_t*>(SDL_MapGPUTransferBuffer(device_, transfer_buffer_, true));
+
+        if (!mapped_) {
+            spdlog::error("Mapping upload buffer failed: {}", SDL_GetError());
+            return false;
+        }
+        return true;
+    }
+
+    void UploadRing::unmap() {
+        if (mapped_) {
+            SDL_UnmapGPUTransferBuffer(device_, transfer_buffer_);
+            mapped_ = nullptr;
+        }
+    }
+
+    void UploadRing::recordCopies(SDL_GPUCommandBuffer* command_buffer) {
+        if (buffer_copies_.empty() && texture_copies_.empty()) {
+            return;
+        }
+
+        SDL_GPUCopyPass* copy_pass = SDL_BeginGPUCopyPass(command_buffer);
+
+        for (const auto& copy : buffer_copies_) {
+            SDL_GPUTransferBufferLocation location{};
+            location.transfer_buffer = transfer_buffer_;
+            location.offset = copy.src_offset;
+            SDL_UploadToGPUBuffer(copy_pass, &location, &copy.dst, copy.cycle);
+        }
+
+        for (const auto& copy : texture_copies_) {
+            SDL_GPUTextureTransferInfo source{};
+            source.transfer_buffer = transfer_buffer_;
+            source.offset = copy.src_offset;
+            SDL_UploadToGPUTexture(copy_pass, &source, &copy.dst, copy.cycle);
+        }
+
+        SDL_EndGPUCopyPass(copy_pass);
+        buffer_copies_.clear();
+        texture_copies_.clear();
+    }
+
+    void UploadRing::submitEarly() {
+        unmap();
+
+        if (buffer_copies_.empty() && texture_copies_.empty()) {
+            return;
+        }
+
+        SDL_GPUCommandBuffer* command_buffer = SDL_AcquireGPUCommandBuffer(device_);
+        if (!command_buffer) {
+            spdlog::error("UploadRing could not acquire a command buffer: {}", SDL_GetError());
+            buffer_copies_.clear();
+            texture_copies_.clear();
+            return;
+        }
+
+        recordCopies(command_buffer);
+        SDL_SubmitGPUCommandBuffer(command_buffer);
+        ++stats_.early_submits;
+    }
+
+    bool UploadRing::recreate(std::uint32_t capacity) {
+        unmap();
+
+        if (transfer_buffer_) {
+            // Released once the GPU is done with any copies already submitted from it
+            SDL_ReleaseGPUTransferBuffer(device_, transfer_buffer_);
+            transfer_buffer_ = nullptr;
+            ++stats_.resizes;
+        }
+
+        SDL_GPUTransferBufferCreateInfo info{};
+        info.usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD;
+        info.size = capacity;
+        transfer_buffer_ = SDL_CreateGPUTransferBuffer(device_, &info);
+
+        if (!transfer_buffer_) {
+            spdlog::error("Creating {} byte upload buffer failed: {}", capacity, SDL_GetError());
+            allocator_.setCapacity(0);
+            stats_.capacity = 0;
+            return false;
+        }
+
+        allocator_.setCapacity(capacity);
+        stats_.capacity = capacity;
+        spdlog::debug("Upload ring capacity set to {} bytes.", capacity);
+        return true;
+    }
+
+} // namespace engine::render
@@ -0,0 +1,119 @@
+#ifndef UPLOAD_RING_HPP_
+#define UPLOAD_RING_HPP_
+
+#include "upload_ring_allocator.hpp"
+#include <SDL3/SDL_gpu.h>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace engine::render {
+
+    /// @brief Persistent upload memory for GPU buffer and texture copies.
+    ///
+    /// One large transfer buffer is sub-allocated linearly through the frame. It is
+    /// mapped lazily with cycle=true, so if the GPU is still reading last frame's uploads
+    /// SDL swaps in fresh backing memory instead of blocking. Copies recorded during the
+    /// frame are issued together in a single copy pass by flush().
+    ///
+    /// If a frame runs out of space, the pending copies are submitted on their own
+    /// command buffer and the buffer is cycled; this is counted as an early submit, and
+    /// the ring grows to the frame's usage on the next flush. Offsets are worked out by
+    /// an UploadRingAllocator.
+    class UploadRing final {
+    public:
+        struct Allocation {
+            void* data = nullptr;
+            std::uint32_t offset = 0;
+            std::uint32_t size = 0;
+        };
+
+        struct Stats {
+            std::uint64_t last_frame_bytes = 0;
+            std::uint64_t peak_frame_bytes = 0;
+            std::uint64_t total_bytes = 0;
+            std::uint32_t last_frame_copies = 0;
+            std::uint32_t early_submits = 0;   ///< @brief Copies submitted mid-frame to wrap the ring
+            std::uint32_t resizes = 0;
+            std::uint32_t capacity = 0;
+        };
+
+        static constexpr std::uint32_t DEFAULT_CAPACITY = 4u * 1024u * 1024u;
+
+        UploadRing(SDL_GPUDevice* device, std::uint32_t capacity = DEFAULT_CAPACITY);
+        ~UploadRing();
+
+        UploadRing(const UploadRing&) = delete;
+        UploadRing& operator=(const UploadRing&) = delete;
+        UploadRing(UploadRing&&) = delete;
+        UploadRing& operator=(UploadRing&&) = delete;
+
+        /// @brief Reserve `size` bytes of mapped upload memory. The caller fills `data`
+        /// and then records a copy from `offset`. Valid until the next flush().
+        std::optional<Allocation> allocate(std::uint32_t size, std::uint32_t alignment = 16);
+
+        /// @brief Copy `size` bytes into the ring and record an upload into `buffer`.
+        /// Used for vertex, index and storage/uniform-style buffers alike.
+        bool uploadToBuffer(
+            SDL_GPUBuffer* buffer,
+            std::uint32_t buffer_offset,
+            const void* data,
+            std::uint32_t size,
+            bool cycle = false
+        );
+
+        /// @brief Copy tightly packed pixels into the ring and record an upload into `region`.
+        bool uploadToTexture(
+            const SDL_GPUTextureRegion& region,
+            const void* pixels,
+            std::uint32_t size,
+            bool cycle = false
+        );
+
+        /// @brief Record all pending copies into one copy pass on `command_buffer`.
+        /// Call once per frame before any render pass that reads the uploaded data.
+        void flush(SDL_GPUCommandBuffer* command_buffer);
+
+        /// @brief Release the transfer buffer. Must be called before the device is destroyed.
+        void release();
+
+        const Stats& getStats() const { return stats_; }
+
+        static constexpr std::uint32_t alignUp(std::uint32_t value, std::uint32_t alignment) {
+            return UploadRingAllocator::alignUp(value, alignment);
+        }
+
+    private:
+        struct BufferCopy {
+            std::uint32_t src_offset;
+            SDL_GPUBufferRegion dst;
+            bool cycle;
+        };
+
+        struct TextureCopy {
+            std::uint32_t src_offset;
+            SDL_GPUTextureRegion dst;
+            bool cycle;
+        };
+
+        SDL_GPUDevice* device_ = nullptr;
+        SDL_GPUTransferBuffer* transfer_buffer_ = nullptr;
+        std::uint8_t* mapped_ = nullptr;
+        UploadRingAllocator allocator_;
+
+        std::vector<BufferCopy> buffer_copies_;
+        std::vector<TextureCopy> texture_copies_;
+
+        std::uint32_t frame_copies_ = 0;
+        Stats stats_;
+
+        bool map();
+        void unmap();
+        void recordCopies(SDL_GPUCommandBuffer* command_buffer);
+        void submitEarly();
+        bool recreate(std::uint32_t capacity);
+    };
+
+} // namespace engine::render
+
+#endif // UPLOAD_RING_HPP_
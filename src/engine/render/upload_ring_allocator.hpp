@@ -0,0 +1,101 @@
+#ifndef UPLOAD_RING_ALLOCATOR_HPP_
+#define UPLOAD_RING_ALLOCATOR_HPP_
+
+#include <bit>
+#include <cstdint>
+
+namespace engine::render {
+
+    /// @brief The offset arithmetic of UploadRing, without the GPU: where each allocation
+    /// of a frame goes, when the ring must be submitted and wrapped, and how large it must
+    /// grow so that a frame fits.
+    ///
+    /// Allocations are placed linearly from offset 0. One that does not fit behind the
+    /// previous ones wraps to 0 (the ring submits what it holds first); one larger than
+    /// the whole ring makes it grow. At the end of a frame, the ring grows to the bytes
+    /// the frame consumed so that the next such frame does not wrap.
+    class UploadRingAllocator final {
+    public:
+        struct Placement {
+            std::uint32_t offset = 0;
+            /// @brief The pending copies must be submitted first: the ring restarts at 0.
+            bool wraps = false;
+            /// @brief Non-zero: the ring must first be recreated with this capacity.
+            std::uint32_t grow_to = 0;
+        };
+
+        explicit UploadRingAllocator(std::uint32_t capacity = 0) : capacity_(capacity) {}
+
+        /// @brief Where `size` bytes go. Nothing changes until commit().
+        Placement place(std::uint32_t size, std::uint32_t alignment) const {
+            if (size > capacity_) {
+                return {0, true, growthFor(size)};
+            }
+
+            std::uint32_t offset = alignUp(head_, alignment);
+            if (offset < head_ || offset > capacity_ || size > capacity_ - offset) {
+                return {0, true, 0};
+            }
+            return {offset, false, 0};
+        }
+
+        /// @brief Take `size` bytes at a placement from place(), once the ring has done
+        /// what the placement asked for (submitted, grown).
+        void commit(const Placement& placement, std::uint32_t size) {
+            if (placement.wraps) {
+                head_ = 0;
+            }
+
+            frame_consumed_ += (placement.offset + size) - head_;
+            frame_bytes_ += size;
+            head_ = placement.offset + size;
+        }
+
+        /// @brief Close the frame and restart at offset 0.
+        /// @return The capacity to grow to so that a frame like this one fits without
+        /// wrapping, or 0 if it already does.
+        std::uint32_t endFrame() {
+            std::uint32_t grow_to = 0;
+            if (frame_consumed_ > capacity_) {
+                std::uint64_t target = std::bit_ceil(frame_consumed_);
+                grow_to = target <= UINT32_MAX ? static_cast<std::uint32_t>(target) : UINT32_MAX;
+            }
+
+            frame_consumed_ = 0;
+            frame_bytes_ = 0;
+            head_ = 0;
+            return grow_to;
+        }
+
+        /// @brief The ring was recreated (or released, with 0).
+        void setCapacity(std::uint32_t capacity) {
+            capacity_ = capacity;
+            head_ = 0;
+        }
+
+        std::uint32_t getCapacity() const { return capacity_; }
+        std::uint32_t getHead() const { return head_; }
+        /// @brief Bytes allocated this frame.
+        std::uint64_t getFrameBytes() const { return frame_bytes_; }
+        /// @brief Bytes of ring this frame used up, alignment padding included.
+        std::uint64_t getFrameConsumed() const { return frame_consumed_; }
+
+        static constexpr std::uint32_t alignUp(std::uint32_t value, std::uint32_t alignment) {
+            return alignment <= 1 ? value : (value + alignment - 1) / alignment * alignment;
+        }
+
+    private:
+        std::uint32_t capacity_ = 0;
+        std::uint32_t head_ = 0;
+        std::uint64_t frame_bytes_ = 0;
+        std::uint64_t frame_consumed_ = 0;
+
+        static std::uint32_t growthFor(std::uint32_t size) {
+            // Past 2 GiB the next power of two does not fit in 32 bits
+            return size > (1u << 31) ? size : std::bit_ceil(size);
+        }
+    };
+
+} // namespace engine::render
+
+#endif // UPLOAD_RING_ALLOCATOR_HPP_
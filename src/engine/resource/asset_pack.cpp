@@ -0,0 +1,151 @@
+#include "asset_pack.hpp"
+#include "../utils/mapped_file.hpp"
+#include <SDL3/SDL.h>
+#include <chrono>
+#include <cstring>
+#include <stdexcept>
+#include <spdlog/spdlog.h>
+
+namespace engine::resource {
+
+    AssetPack::AssetPack(std::string_view file_path)
+        : file_path_(file_path)
+        , file_(std::make_unique<engine::utils::MappedFile>(file_path))
+    {
+        auto bytes = file_->bytes();
+
+        Header header{};
+        if (bytes.size() < sizeof(header)) {
+            throw std::runtime_error("Asset pack '" + file_path_ + "' is too small to hold a header.");
+        }
+        std::memcpy(&header, bytes.data(), sizeof(header));
+
+        if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0) {
+            throw std::runtime_error("'" + file_path_ + "' is not an asset pack.");
+        }
+
+        if (header.version != VERSION) {
+            throw std::runtime_error(
+                "Asset pack '" + file_path_ + "' has unsupported version " + std::to_string(header.version) + "."
+            );
+        }
+
+        if (header.toc_offset > bytes.size() || header.toc_size > bytes.size() - header.toc_offset) {
+            throw std::runtime_error("Asset pack '" + file_path_ + "' has a truncated table of contents.");
+        }
+
+        const std::byte* cursor = bytes.data() + header.toc_offset;
+        const std::byte* toc_end = cursor + header.toc_size;
+        entries_.reserve(header.entry_count);
+
+        for (std::uint32_t i = 0; i < header.entry_count; ++i) {
+            EntryRecord record{};
+            if (static_cast<std::size_t>(toc_end - cursor) < sizeof(record)) {
+                throw std::runtime_error("Asset pack '" + file_path_ + "' has a truncated entry record.");
+            }
+            std::memcpy(&record, cursor, sizeof(record));
+            cursor += sizeof(record);
+
+            if (static_cast<std::size_t>(toc_end - cursor) < record.path_length) {
+                throw std::runtime_error("Asset pack '" + file_path_ + "' has a truncated entry path.");
+            }
+            std::string path(reinterpret_cast<const char*>(cursor), record.path_length);
+            cursor += record.path_length;
+
+            if (record.offset > bytes.size() || record.size > bytes.size() - record.offset) {
+                throw std::runtime_error("Asset pack entry '" + path + "' lies outside the pack.");
+            }
+
+            entries_.insert_or_assign(
+                std::move(path),
+                Entry{record.offset, record.size, static_cast<Compression>(record.compression)}
+            );
+        }
+    }
+
+    AssetPack::~AssetPack() = default;
+
+    const AssetPack::Entry* AssetPack::findEntry(std::string_view asset_path) const {
+        auto it = entries_.find(asset_path);
+        return it != entries_.end() ? &it->second : nullptr;
+    }
+
+    bool AssetPack::contains(std::string_view asset_path) const {
+        return findEntry(asset_path) != nullptr;
+    }
+
+    std::span<const std::byte> AssetPack::getData(std::string_view asset_path) const {
+        const Entry* entry = findEntry(asset_path);
+        if (!entry) {
+            return {};
+        }
+
+        if (entry->compression != Compression::NONE) {
+            spdlog::error(
+                "Asset '{}' in pack '{}' uses unsupported compression {}.",
+                asset_path,
+                file_path_,
+                static_cast<std::uint32_t>(entry->compression)
+            );
+            return {};
+        }
+
+        return file_->bytes().subspan(entry->offset, entry->size);
+    }
+
+    SDL_IOStream* AssetPack::openStream(std::string_view asset_path) const {
+        auto data = getData(asset_path);
+        if (data.empty()) {
+            return nullptr;
+        }
+
+        SDL_IOStream* stream = SDL_IOFromConstMem(data.data(), data.size());
+        if (!stream) {
+            spdlog::error("Unable to open stream for '{}' in pack '{}': {}", asset_path, file_path_, SDL_GetError());
+        }
+        return stream;
+    }
+
+    AssetLocator::~AssetLocator() = default;
+
+    bool AssetLocator::mount(std::string_view pack_path) {
+        auto start = std::chrono::steady_clock::now();
+
+        try {
+            packs_.push_back(std::make_unique<AssetPack>(pack_path));
+        }
+
+        catch (const std::exception& exc) {
+            spdlog::error("Mounting asset pack failed: {}", exc.what());
+            return false;
+        }
+
+        auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start);
+        spdlog::info(
+            "Mounted asset pack '{}' with {} entries in {:.2f} ms.",
+            pack_path,
+            packs_.back()->getEntryCount(),
+            elapsed.count()
+        );
+        return true;
+    }
+
+    std::span<const std::byte> AssetLocator::getData(std::string_view asset_path) const {
+        for (auto it = packs_.rbegin(); it != packs_.rend(); ++it) {
+            if ((*it)->contains(asset_path)) {
+                return (*it)->getData(asset_path);
+            }
+        }
+        return {};
+    }
+
+    SDL_IOStream* AssetLocator::openStream(std::string_view asset_path) const {
+        for (auto it = packs_.rbegin(); it != packs_.rend(); ++it) {
+            if ((*it)->contains(asset_path)) {
+                return (*it)->openStream(asset_path);
+            }
+        }
+        return nullptr;
+    }
+
+} // namespace engine::resource
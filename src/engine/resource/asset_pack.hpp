@@ -0,0 +1,123 @@
+#ifndef ASSET_PACK_HPP_
+#define ASSET_PACK_HPP_
+
+#include "../utils/hash.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+struct SDL_IOStream;
+
+namespace engine::utils {
+    class MappedFile;
+}
+
+namespace engine::resource {
+
+    /// @brief A read-only archive of assets, memory-mapped as a whole.
+    ///
+    /// File layout (little-endian):
+    ///
+    ///   Header                      (32 bytes, see Header)
+    ///   entry data ...              (each entry aligned to Header::alignment)
+    ///   table of contents           (Header::entry_count records, see EntryRecord,
+    ///                                each followed by its UTF-8 path)
+    ///
+    /// Entry paths are the same strings game code passes to the ResourceManager, e.g.
+    /// "assets/textures/player.png". Stored entries are handed to decoders as
+    /// SDL_IOStreams over the mapped memory, so no per-asset open/read takes place.
+    class AssetPack final {
+    public:
+        enum class Compression : std::uint32_t {
+            NONE = 0,
+        };
+
+        static constexpr char MAGIC[4] = {'S', 'P', 'A', 'K'};
+        static constexpr std::uint32_t VERSION = 1;
+        static constexpr std::uint32_t DEFAULT_ALIGNMENT = 64;
+
+        struct Header {
+            char magic[4];
+            std::uint32_t version;
+            std::uint32_t entry_count;
+            std::uint32_t alignment;
+            std::uint64_t toc_offset;
+            std::uint64_t toc_size;
+        };
+
+        struct EntryRecord {
+            std::uint64_t offset;
+            std::uint64_t size;
+            std::uint64_t original_size;
+            std::uint32_t compression;
+            std::uint32_t path_length;
+        };
+
+        static_assert(sizeof(Header) == 32, "AssetPack header must be tightly packed.");
+        static_assert(sizeof(EntryRecord) == 32, "AssetPack entry record must be tightly packed.");
+
+        explicit AssetPack(std::string_view file_path);
+        ~AssetPack();
+
+        AssetPack(const AssetPack&) = delete;
+        AssetPack& operator=(const AssetPack&) = delete;
+        AssetPack(AssetPack&&) = delete;
+        AssetPack& operator=(AssetPack&&) = delete;
+
+        bool contains(std::string_view asset_path) const;
+
+        /// @brief Mapped bytes of a stored entry; empty if missing or compressed.
+        std::span<const std::byte> getData(std::string_view asset_path) const;
+
+        /// @brief Open a read-only stream over an entry, or nullptr if missing.
+        SDL_IOStream* openStream(std::string_view asset_path) const;
+
+        std::size_t getEntryCount() const { return entries_.size(); }
+        const std::string& getFilePath() const { return file_path_; }
+
+    private:
+        struct Entry {
+            std::uint64_t offset;
+            std::uint64_t size;
+            Compression compression;
+        };
+
+        std::string file_path_;
+        std::unique_ptr<engine::utils::MappedFile> file_;
+        std::unordered_map<std::string, Entry, engine::utils::StringHash, std::equal_to<>> entries_;
+
+        const Entry* findEntry(std::string_view asset_path) const;
+    };
+
+    /// @brief Resolves asset paths against the mounted packs.
+    ///
+    /// Packs mounted later take precedence, so a patch pack can override a base pack.
+    /// Paths not found in any pack are left to the caller to load from loose files.
+    class AssetLocator final {
+    public:
+        AssetLocator() = default;
+        ~AssetLocator();
+
+        AssetLocator(const AssetLocator&) = delete;
+        AssetLocator& operator=(const AssetLocator&) = delete;
+        AssetLocator(AssetLocator&&) = delete;
+        AssetLocator& operator=(AssetLocator&&) = delete;
+
+        bool mount(std::string_view pack_path);
+
+        std::span<const std::byte> getData(std::string_view asset_path) const;
+        SDL_IOStream* openStream(std::string_view asset_path) const;
+        std::size_t getPackCount() const { return packs_.size(); }
+
+    private:
+        std::vector<std::unique_ptr<AssetPack>> packs_;
+    };
+
+} // namespace engine::resource
+
+#endif // ASSET_PACK_HPP_
@@ -1,10 +1,11 @@
 #include "audio_manager.hpp"
+#include "asset_pack.hpp"
 #include <spdlog/spdlog.h>
 #include <stdexcept>
 
 namespace engine::resource {
 
-    AudioManager::AudioManager() {
+    AudioManager::AudioManager(const AssetLocator& asset_locator) : asset_locator_(asset_locator) {
         MIX_InitFlags flags = MIX_INIT_OGG | MIX_INIT_MP3;
 
         if ((Mix_Init(flags) & flags) != flags) {
@@ -29,14 +30,19 @@ namespace engine::resource {
     }
 
     Mix_Chunk* AudioManager::loadSound(std::string_view file_path) {
-        auto it = sounds_.find(std::string(file_path));
+        auto it = sounds_.find(file_path);
         if (it != sounds_.end()) {
             return it->second.get();
         }
 
         spdlog::debug("Loading sounds effects: {}.", file_path);
 
-        Mix_Chunk* raw_chunk = Mix_LoadWAV(file_path.data());
+        Mix_Chunk* raw_chunk = nullptr;
+        if (SDL_IOStream* stream = asset_locator_.openStream(file_path)) {
+            raw_chunk = Mix_LoadWAV_IO(stream, true);
+        } else {
+            raw_chunk = Mix_LoadWAV(file_path.data());
+        }
         if (!raw_chunk) {
             spdlog::error("Loading sound effect failed: '{}': {}.", file_path, SDL_GetError());
             return nullptr;
@@ -48,7 +54,7 @@ namespace engine::resource {
     }
 
     Mix_Chunk* AudioManager::getSound(std::string_view file_path) {
-        auto it = sounds_.find(std::string(file_path));
+        auto it = sounds_.find(file_path);
         if (it != sounds_.end()) {
             return it->second.get();
         }
@@ -58,7 +64,7 @@ namespace engine::resource {
     }
 
     void AudioManager::unloadSound(std::string_view file_path) {
-        auto it = sounds_.find(std::string(file_path));
+        auto it = sounds_.find(file_path);
         if (it != sounds_.end()) {
             spdlog::debug("Unloaded sound effect: {}.", file_path);
             sounds_.erase(it);
@@ -76,13 +82,19 @@ namespace engine::resource {
     }
 
     Mix_Music* AudioManager::loadMusic(std::string_view file_path) {
-        auto it = music_.find(std::string(file_path));
+        auto it = music_.find(file_path);
         if (it != music_.end()) {
             return it->second.get();
         }
 
         spdlog::debug("Loaded music: {}.", file_path);
-        Mix_Music* raw_music = Mix_LoadMUS(file_path.data());
+        // Music streams from the pack's mapped memory for as long as it plays
+        Mix_Music* raw_music = nullptr;
+        if (SDL_IOStream* stream = asset_locator_.openStream(file_path)) {
+            raw_music = Mix_LoadMUS_IO(stream, true);
+        } else {
+            raw_music = Mix_LoadMUS(file_path.data());
+        }
 
         if (!raw_music) {
             spdlog::error("Loading music failed: '{}': {}.", file_path, SDL_GetError());
@@ -95,17 +107,17 @@ namespace engine::resource {
     }
 
     Mix_Music* AudioManager::getMusic(std::string_view file_path) {
-        auto it = music_.find(std::string(file_path));
+        auto it = music_.find(file_path);
         if (it != music_.end()) {
             return it->second.get();
         }
 
-        spdlog::warn("Cached music '{}' not found. Trying to load.");
+        spdlog::warn("Cached music '{}' not found. Trying to load.", file_path);
         return loadMusic(file_path);
     }
 
     void AudioManager::unloadMusic(std::string_view file_path) {
-        auto it = music_.find(std::string(file_path));
+        auto it = music_.find(file_path);
         if (it != music_.end()) {
             spdlog::debug("Unloaded music: {}.", file_path);
             music_.erase(it);
@@ -1,6 +1,7 @@
 #ifndef AUDIO_MANAGER_HPP_
 #define AUDIO_MANAGER_HPP_
 
+#include "../utils/hash.hpp"
 #include <memory>
 #include <stdexcept>
 #include <string>
@@ -9,12 +10,13 @@
 #include <SDL3_mixer/SDL_mixer.h>
 
 namespace engine::resource {
+    class AssetLocator;
 
     class AudioManager final {
         friend class ResourceManager;
 
     public:
-        AudioManager();
+        explicit AudioManager(const AssetLocator& asset_locator);
         ~AudioManager();
 
         AudioManager(const AudioManager&) = delete;
@@ -23,6 +25,8 @@ namespace engine::resource {
         AudioManager& operator=(AudioManager&&) = delete;
 
     private:
+        const AssetLocator& asset_locator_;
+
         struct SDLMixChunkDeleter {
             void operator()(Mix_Chunk* chunk) const {
                 if (chunk) {
@@ -39,8 +43,8 @@ namespace engine::resource {
             }
         };
 
-        std::unordered_map<std::string, std::unique_ptr<Mix_Chunk, SDLMixChunkDeleter>> sounds_;
-        std::unordered_map<std::string, std::unique_ptr<Mix_Music, SDLMixMusicDeleter>> music_;
+        std::unordered_map<std::string, std::unique_ptr<Mix_Chunk, SDLMixChunkDeleter>, engine::utils::StringHash, std::equal_to<>> sounds_;
+        std::unordered_map<std::string, std::unique_ptr<Mix_Music, SDLMixMusicDeleter>, engine::utils::StringHash, std::equal_to<>> music_;
 
         Mix_Chunk* loadSound(std::string_view file_path);
         Mix_Chunk* getSound(std::string_view file_path);
@@ -1,4 +1,5 @@
 #include "font_manager.hpp"
+#include "asset_pack.hpp"
 #include <spdlog/spdlog.h>
 #include <stdexcept>
 
@@ -15,7 +16,7 @@ namespace engine::resource {
         return fs::status_known(s) ? fs::exists(s) : fs::exists(p);
     }
 
-    FontManager::FontManager() {
+    FontManager::FontManager(const AssetLocator& asset_locator) : asset_locator_(asset_locator) {
         if (!TTF_WasInit() && !TTF_Init()) {
             throw std::runtime_error("FontManager error: TTF_Init failed: " + std::string(SDL_GetError()));
         }
@@ -36,29 +37,31 @@ namespace engine::resource {
             return nullptr;
         }
 
-        FontKey key = {std::string(file_path), point_size};
-
-        auto it = fonts_.find(key);
+        auto it = fonts_.find(FontKeyView(file_path, point_size));
         if (it != fonts_.end()) {
             return it->second.get();
         }
 
         spdlog::debug("Loading font: {} ({}pt).", file_path, point_size);
 
-        TTF_Font* raw_font = TTF_OpenFont(file_path.data(), point_size);
+        TTF_Font* raw_font = nullptr;
+        if (SDL_IOStream* stream = asset_locator_.openStream(file_path)) {
+            raw_font = TTF_OpenFontIO(stream, true, point_size);
+        } else {
+            raw_font = TTF_OpenFont(file_path.data(), point_size);
+        }
         if (!raw_font) {
             spdlog::error("Loading font '{}' ({}pt) failed: {}.", file_path, point_size, SDL_GetError());
             return nullptr;
         }
 
-        fonts_.emplace(key, std::unique_ptr<TTF_Font, SDLFontDeleter>(raw_font));
+        fonts_.emplace(FontKey(file_path, point_size), std::unique_ptr<TTF_Font, SDLFontDeleter>(raw_font));
         spdlog::debug("Successfully loaded and cached font: {} ({}pt).", file_path, point_size);
         return raw_font;
     }
 
     TTF_Font* FontManager::getFont(std::string_view file_path, int point_size) {
-        FontKey key = {std::string(file_path), point_size};
-        auto it = fonts_.find(key);
+        auto it = fonts_.find(FontKeyView(file_path, point_size));
         if (it != fonts_.end()) {
             return it->second.get();
         }
@@ -68,8 +71,7 @@ namespace engine::resource {
     }
 
     void FontManager::unloadFont(std::string_view file_path, int point_size) {
-        FontKey key = {std::string(file_path), point_size};
-        auto it = fonts_.find(key);
+        auto it = fonts_.find(FontKeyView(file_path, point_size));
         if (it != fonts_.end()) {
             spdlog::debug("Unloaded font: {} ({}pt).", file_path, point_size);
             fonts_.erase(it);
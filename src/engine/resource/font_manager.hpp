@@ -11,22 +11,38 @@
 #include <SDL3_ttf/SDL_ttf.h>
 
 namespace engine::resource {
+    class AssetLocator;
+
 
     using FontKey = std::pair<std::string, int>;
+    /// @brief Non-owning form of FontKey, so lookups do not have to copy the path.
+    using FontKeyView = std::pair<std::string_view, int>;
 
     struct FontKeyHash {
-        std::size_t operator()(const FontKey& key) const {
-            std::hash<std::string> string_hasher;
+        using is_transparent = void;
+
+        std::size_t operator()(const FontKeyView& key) const {
+            std::hash<std::string_view> string_hasher;
             std::hash<int> int_hasher;
             return string_hasher(key.first) ^ int_hasher(key.second);
         }
+        std::size_t operator()(const FontKey& key) const { return (*this)(FontKeyView(key.first, key.second)); }
+    };
+
+    struct FontKeyEqual {
+        using is_transparent = void;
+
+        template <typename Lhs, typename Rhs>
+        bool operator()(const Lhs& lhs, const Rhs& rhs) const {
+            return lhs.second == rhs.second && std::string_view(lhs.first) == std::string_view(rhs.first);
+        }
     };
 
     class FontManager final {
         friend class ResourceManager;
 
     public:
-        FontManager();
+        explicit FontManager(const AssetLocator& asset_locator);
         ~FontManager();
 
         FontManager(const FontManager&) = delete;
@@ -35,6 +51,8 @@ namespace engine::resource {
         FontManager& operator=(FontManager&&) = delete;
 
     private:
+        const AssetLocator& asset_locator_;
+
         struct SDLFontDeleter {
             void operator()(TTF_Font* font) const {
                 if (font) {
@@ -43,7 +61,7 @@ namespace engine::resource {
             }
         };
 
-        std::unordered_map<FontKey, std::unique_ptr<TTF_Font, SDLFontDeleter>, FontKeyHash> fonts_;
+        std::unordered_map<FontKey, std::unique_ptr<TTF_Font, SDLFontDeleter>, FontKeyHash, FontKeyEqual> fonts_;
 
         TTF_Font* loadFont(std::string_view file_path, int point_size);
         TTF_Font* getFont(std::string_view file_path, int point_size);
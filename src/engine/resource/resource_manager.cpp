@@ -2,6 +2,8 @@
 #include "texture_manager.hpp"
 #include "audio_manager.hpp"
 #include "font_manager.hpp"
+#include "shader_manager.hpp"
+#include "asset_pack.hpp"
 #include <SDL3_mixer/SDL_mixer.h>
 #include <SDL3_ttf/SDL_ttf.h>
 #include <glm/glm.hpp>
@@ -11,10 +13,12 @@ namespace engine::resource {
 
     ResourceManager::~ResourceManager() = default;
 
-    ResourceManager::ResourceManager(SDL_Renderer* renderer) {
-        texture_manager_ = std::make_unique<TextureManager>(renderer);
-        audio_manager_ = std::make_unique<AudioManager>();
-        font_manager_ = std::make_unique<FontManager>();
+    ResourceManager::ResourceManager(SDL_Renderer* renderer, SDL_GPUDevice* gpu_device) {
+        asset_locator_ = std::make_unique<AssetLocator>();
+        texture_manager_ = std::make_unique<TextureManager>(renderer, *asset_locator_);
+        audio_manager_ = std::make_unique<AudioManager>(*asset_locator_);
+        font_manager_ = std::make_unique<FontManager>(*asset_locator_);
+        shader_manager_ = std::make_unique<ShaderManager>(gpu_device, *asset_locator_);
     }
 
     void ResourceManager::clear() {
@@ -22,23 +26,137 @@ namespace engine::resource {
         audio_manager_->clearSounds();
         audio_manager_->clearMusic();
         texture_manager_->clearTextures();
+        shader_manager_->clearShaders();
+        ref_counts_.clear();
+        pending_release_.clear();
+    }
+
+    void ResourceManager::releaseScope(ResourceScope& scope) {
+        if (active_scope_ == &scope) {
+            active_scope_ = nullptr;
+        }
+
+        for (const auto& key : scope.keys_) {
+            auto it = ref_counts_.find(key);
+            if (it == ref_counts_.end()) {
+                continue;  // Unloaded manually in the meantime
+            }
+
+            if (--it->second == 0) {
+                pending_release_.push_back(key);
+                if (key.type == ResourceType::TEXTURE) {
+                    texture_manager_->setPinned(key.path, false);
+                }
+            }
+        }
+
+        spdlog::debug("Released resource scope '{}' ({} resources).", scope.name_, scope.keys_.size());
+        scope.keys_.clear();
+    }
+
+    void ResourceManager::endFrame() {
+        releasePending();
+        texture_manager_->endFrame();
+    }
+
+    void ResourceManager::releasePending() {
+        if (pending_release_.empty()) {
+            return;
+        }
+
+        std::size_t unloaded = 0;
+        for (const auto& key : pending_release_) {
+            // Re-acquired by another scope since it was released (e.g. a replacement
+            // scene using the same assets)
+            auto it = ref_counts_.find(key);
+            if (it == ref_counts_.end() || it->second > 0) {
+                continue;
+            }
+
+            ref_counts_.erase(it);
+            unload(key);
+            ++unloaded;
+        }
+
+        if (unloaded > 0) {
+            spdlog::debug("Unloaded {} unreferenced resources.", unloaded);
+        }
+        pending_release_.clear();
+    }
+
+    void ResourceManager::track(ResourceType type, std::string_view file_path, int point_size) {
+        if (!active_scope_) {
+            return;
+        }
+
+        // Called on every lookup: only a resource new to the scope copies its path
+        if (active_scope_->keys_.contains(ResourceKeyView{type, file_path, point_size})) {
+            return;
+        }
+
+        ResourceKey key{type, std::string(file_path), point_size};
+        // Referenced textures stay resident whatever the budget, until their last scope lets go
+        if (++ref_counts_[key] == 1 && type == ResourceType::TEXTURE) {
+            texture_manager_->setPinned(file_path, true);
+        }
+        active_scope_->keys_.insert(std::move(key));
+    }
+
+    void ResourceManager::untrack(ResourceType type, std::string_view file_path, int point_size) {
+        auto it = ref_counts_.find(ResourceKeyView{type, file_path, point_size});
+        if (it != ref_counts_.end()) {
+            ref_counts_.erase(it);
+        }
+    }
+
+    void ResourceManager::unload(const ResourceKey& key) {
+        switch (key.type) {
+            case ResourceType::TEXTURE:
+                texture_manager_->unloadTexture(key.path);
+                break;
+            case ResourceType::SOUND:
+                audio_manager_->unloadSound(key.path);
+                break;
+            case ResourceType::MUSIC:
+                audio_manager_->unloadMusic(key.path);
+                break;
+            case ResourceType::FONT:
+                font_manager_->unloadFont(key.path, key.point_size);
+                break;
+        }
+    }
+
+    bool ResourceManager::mountPack(std::string_view file_path) {
+        return asset_locator_->mount(file_path);
     }
 
     // --- Textures ---
 
     SDL_Texture* ResourceManager::loadTexture(std::string_view file_path) {
-        return texture_manager_->loadTexture(file_path);
+        auto* result = texture_manager_->loadTexture(file_path);
+        if (result) {
+            track(ResourceType::TEXTURE, file_path);
+        }
+        return result;
     }
 
     SDL_Texture* ResourceManager::getTexture(std::string_view file_path) {
-        return texture_manager_->getTexture(file_path);
+        auto* result = texture_manager_->getTexture(file_path);
+        if (result) {
+            track(ResourceType::TEXTURE, file_path);
+        }
+        return result;
     }
 
     glm::vec2 ResourceManager::getTextureSize(std::string_view file_path) {
+        if (active_scope_) {
+            getTexture(file_path);
+        }
         return texture_manager_->getTextureSize(file_path);
     }
 
     void ResourceManager::unloadTexture(std::string_view file_path) {
+        untrack(ResourceType::TEXTURE, file_path);
         texture_manager_->unloadTexture(file_path);
     }
 
@@ -46,17 +164,38 @@ namespace engine::resource {
         texture_manager_->clearTextures();
     }
 
+    void ResourceManager::setTextureCacheEnabled(bool enabled) {
+        texture_manager_->setCacheEnabled(enabled);
+    }
+
+    void ResourceManager::setTextureBudget(std::size_t budget_bytes) {
+        texture_manager_->setBudget(budget_bytes);
+    }
+
+    TextureManager::Stats ResourceManager::getTextureStats() const {
+        return texture_manager_->getStats();
+    }
+
     // --- Audio ---
 
     Mix_Chunk* ResourceManager::loadSound(std::string_view file_path) {
-        return audio_manager_->loadSound(file_path);
+        auto* result = audio_manager_->loadSound(file_path);
+        if (result) {
+            track(ResourceType::SOUND, file_path);
+        }
+        return result;
     }
 
     Mix_Chunk* ResourceManager::getSound(std::string_view file_path) {
-        return audio_manager_->getSound(file_path);
+        auto* result = audio_manager_->getSound(file_path);
+        if (result) {
+            track(ResourceType::SOUND, file_path);
+        }
+        return result;
     }
 
     void ResourceManager::unloadSound(std::string_view file_path) {
+        untrack(ResourceType::SOUND, file_path);
         audio_manager_->unloadSound(file_path);
     }
 
@@ -65,14 +204,23 @@ namespace engine::resource {
     }
 
     Mix_Music* ResourceManager::loadMusic(std::string_view file_path) {
-        return audio_manager_->loadMusic(file_path);
+        auto* result = audio_manager_->loadMusic(file_path);
+        if (result) {
+            track(ResourceType::MUSIC, file_path);
+        }
+        return result;
     }
 
     Mix_Music* ResourceManager::getMusic(std::string_view file_path) {
-        return audio_manager_->getMusic(file_path);
+        auto* result = audio_manager_->getMusic(file_path);
+        if (result) {
+            track(ResourceType::MUSIC, file_path);
+        }
+        return result;
     }
 
     void ResourceManager::unloadMusic(std::string_view file_path) {
+        untrack(ResourceType::MUSIC, file_path);
         audio_manager_->unloadMusic(file_path);
     }
 
@@ -83,14 +231,23 @@ namespace engine::resource {
     // --- Fonts ---
 
     TTF_Font* ResourceManager::loadFont(std::string_view file_path, int point_size) {
-        return font_manager_->loadFont(file_path, point_size);
+        auto* result = font_manager_->loadFont(file_path, point_size);
+        if (result) {
+            track(ResourceType::FONT, file_path, point_size);
+        }
+        return result;
     }
 
     TTF_Font* ResourceManager::getFont(std::string_view file_path, int point_size) {
-        return font_manager_->getFont(file_path, point_size);
+        auto* result = font_manager_->getFont(file_path, point_size);
+        if (result) {
+            track(ResourceType::FONT, file_path, point_size);
+        }
+        return result;
     }
 
     void ResourceManager::unloadFont(std::string_view file_path, int point_size) {
+        untrack(ResourceType::FONT, file_path, point_size);
         font_manager_->unloadFont(file_path, point_size);
     }
 
@@ -98,4 +255,30 @@ namespace engine::resource {
         font_manager_->clearFonts();
     }
 
+    // --- Shaders ---
+
+    ShaderId ResourceManager::loadShader(
+        std::string_view file_path,
+        SDL_GPUShaderStage stage,
+        const ShaderResources& resources
+    ) {
+        return shader_manager_->loadShader(file_path, stage, resources);
+    }
+
+    SDL_GPUShader* ResourceManager::getShader(ShaderId id) {
+        return shader_manager_->getShader(id);
+    }
+
+    SDL_GPUGraphicsPipeline* ResourceManager::getPipeline(const PipelineDescriptor& descriptor) {
+        return shader_manager_->getPipeline(descriptor);
+    }
+
+    std::size_t ResourceManager::precompilePipelines(std::span<const PipelineDescriptor> descriptors) {
+        return shader_manager_->precompile(descriptors);
+    }
+
+    void ResourceManager::clearShaders() {
+        shader_manager_->clearShaders();
+    }
+
 } // namespace engine::resource
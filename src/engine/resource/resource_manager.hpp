@@ -1,11 +1,18 @@
 #ifndef RESOURCE_MANAGER_HPP_
 #define RESOURCE_MANAGER_HPP_
+#include "shader_manager.hpp"
+#include "resource_scope.hpp"
+#include "texture_manager.hpp"
 #include <memory>
+#include <span>
 #include <string>
 #include <string_view>
+#include <unordered_map>
+#include <vector>
 #include <glm/glm.hpp>
 
 struct SDL_Renderer;
+struct SDL_GPUDevice;
 struct SDL_Texture;
 struct Mix_Chunk;
 struct Mix_Music;
@@ -13,13 +20,14 @@ struct TTF_Font;
 
 namespace engine::resource {
 
-    class TextureManager;
     class AudioManager;
     class FontManager;
+    class ShaderManager;
+    class AssetLocator;
 
     class ResourceManager final {
     public:
-        explicit ResourceManager(SDL_Renderer* renderer);
+        explicit ResourceManager(SDL_Renderer* renderer, SDL_GPUDevice* gpu_device = nullptr);
 
         ~ResourceManager();
 
@@ -30,12 +38,43 @@ namespace engine::resource {
 
         void clear();
 
+        /// @brief Make `scope` collect every texture, sound, music and font loaded or
+        /// looked up until the active scope changes. Pass nullptr for untracked,
+        /// application-lifetime resources.
+        void setActiveScope(ResourceScope* scope) { active_scope_ = scope; }
+        ResourceScope* getActiveScope() const { return active_scope_; }
+
+        /// @brief Drop the references held by `scope`. Resources left unreferenced are
+        /// unloaded at the next endFrame(), unless another scope acquires them first.
+        void releaseScope(ResourceScope& scope);
+
+        /// @brief Frame boundary: destroy resources released during the frame.
+        void endFrame();
+
+        /// @brief Cap the memory used by resident textures; 0 removes the limit. Textures
+        /// referenced by a live scope are never evicted for it.
+        void setTextureBudget(std::size_t budget_bytes);
+        TextureManager::Stats getTextureStats() const;
+
+        std::size_t getTrackedResourceCount() const { return ref_counts_.size(); }
+
+        /// @brief Mount an asset pack. Assets found in mounted packs are read from the
+        /// mapped archive instead of loose files; later mounts take precedence.
+        bool mountPack(std::string_view file_path);
+
+        /// @brief Lookup over the mounted packs. Read-only once mounting is done, so it
+        /// may be shared with other threads from then on.
+        const AssetLocator& getAssetLocator() const { return *asset_locator_; }
+
         SDL_Texture* loadTexture(std::string_view file_path);
         SDL_Texture* getTexture(std::string_view file_path);
         void unloadTexture(std::string_view file_path);
         glm::vec2 getTextureSize(std::string_view file_path);
         void clearTextures();
 
+        /// @brief Enable or disable the on-disk cache of decoded textures (on by default).
+        void setTextureCacheEnabled(bool enabled);
+
         Mix_Chunk* loadSound(std::string_view file_path);
         Mix_Chunk* getSound(std::string_view file_path);
         void unloadSound(std::string_view file_path);
@@ -51,13 +90,40 @@ namespace engine::resource {
         void unloadFont(std::string_view file_path, int point_size);
         void clearFonts();
 
+        ShaderId loadShader(
+            std::string_view file_path,
+            SDL_GPUShaderStage stage,
+            const ShaderResources& resources = {}
+        );
+        SDL_GPUShader* getShader(ShaderId id);
+
+        /// @brief Get the pipeline for a descriptor, creating it if it was not precompiled.
+        SDL_GPUGraphicsPipeline* getPipeline(const PipelineDescriptor& descriptor);
+
+        /// @brief Create every pipeline in `descriptors` ahead of the first frame.
+        /// @return The number of pipelines created; ones already cached are skipped.
+        std::size_t precompilePipelines(std::span<const PipelineDescriptor> descriptors);
+        void clearShaders();
+
     private:
+        /// @brief Declared first so the packs outlive every asset streamed from them.
+        std::unique_ptr<AssetLocator> asset_locator_;
         std::unique_ptr<TextureManager> texture_manager_;
         std::unique_ptr<AudioManager> audio_manager_;
         std::unique_ptr<FontManager> font_manager_;
+        std::unique_ptr<ShaderManager> shader_manager_;
+
+        ResourceScope* active_scope_ = nullptr;
+        std::unordered_map<ResourceKey, std::uint32_t, ResourceKeyHash, ResourceKeyEqual> ref_counts_;
+        std::vector<ResourceKey> pending_release_;
+
+        void track(ResourceType type, std::string_view file_path, int point_size = 0);
+        void untrack(ResourceType type, std::string_view file_path, int point_size = 0);
+        void unload(const ResourceKey& key);
+        void releasePending();
 
     };
 
 } // engine::resource
 
-#endif RESOURCE_MANAGER_HPP_
\ No newline at end of file
+#endif // RESOURCE_MANAGER_HPP_
@@ -0,0 +1,86 @@
+#ifndef RESOURCE_SCOPE_HPP_
+#define RESOURCE_SCOPE_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+
+namespace engine::resource {
+
+    enum class ResourceType : std::uint8_t {
+        TEXTURE,
+        SOUND,
+        MUSIC,
+        FONT,
+    };
+
+    /// @brief Identifies one cached resource across all managers.
+    struct ResourceKey {
+        ResourceType type;
+        std::string path;
+        int point_size = 0;
+
+        bool operator==(const ResourceKey&) const = default;
+    };
+
+    /// @brief Non-owning form of ResourceKey, so lookups do not have to copy the path.
+    struct ResourceKeyView {
+        ResourceType type;
+        std::string_view path;
+        int point_size = 0;
+
+        ResourceKeyView(ResourceType type, std::string_view path, int point_size = 0)
+            : type(type), path(path), point_size(point_size) {}
+        ResourceKeyView(const ResourceKey& key) : type(key.type), path(key.path), point_size(key.point_size) {}
+    };
+
+    struct ResourceKeyHash {
+        using is_transparent = void;
+
+        std::size_t operator()(const ResourceKeyView& key) const {
+            std::size_t hash = std::hash<std::string_view>{}(key.path);
+            hash ^= std::hash<int>{}(key.point_size) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+            return hash ^ (static_cast<std::size_t>(key.type) << 1);
+        }
+    };
+
+    struct ResourceKeyEqual {
+        using is_transparent = void;
+
+        bool operator()(const ResourceKeyView& lhs, const ResourceKeyView& rhs) const {
+            return lhs.type == rhs.type && lhs.point_size == rhs.point_size && lhs.path == rhs.path;
+        }
+    };
+
+    /// @brief The set of resources held by one owner, typically a Scene.
+    ///
+    /// While a scope is active on the ResourceManager, every resource it loads or looks
+    /// up is added to the scope and holds one reference. Releasing the scope drops those
+    /// references; resources no scope references any more are unloaded at the next frame
+    /// boundary, so assets shared by an outgoing and an incoming scene are never reloaded.
+    class ResourceScope final {
+        friend class ResourceManager;
+
+    public:
+        explicit ResourceScope(std::string_view name) : name_(name) {}
+
+        ResourceScope(const ResourceScope&) = delete;
+        ResourceScope& operator=(const ResourceScope&) = delete;
+        ResourceScope(ResourceScope&&) = delete;
+        ResourceScope& operator=(ResourceScope&&) = delete;
+
+        const std::string& getName() const { return name_; }
+        std::size_t size() const { return keys_.size(); }
+        bool contains(const ResourceKeyView& key) const { return keys_.contains(key); }
+
+    private:
+        std::string name_;
+        std::unordered_set<ResourceKey, ResourceKeyHash, ResourceKeyEqual> keys_;
+    };
+
+} // namespace engine::resource
+
+#endif // RESOURCE_SCOPE_HPP_
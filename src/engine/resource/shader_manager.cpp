@@ -0,0 +1,317 @@
+#include "shader_manager.hpp"
+#include "asset_pack.hpp"
+#include "../utils/hash.hpp"
+#include <SDL3/SDL.h>
+#include <algorithm>
+#include <chrono>
+#include <spdlog/spdlog.h>
+
+namespace engine::resource {
+
+    namespace {
+
+        void fillBlendState(BlendMode mode, SDL_GPUColorTargetBlendState& state) {
+            state = {};
+            state.color_blend_op = SDL_GPU_BLENDOP_ADD;
+            state.alpha_blend_op = SDL_GPU_BLENDOP_ADD;
+
+            switch (mode) {
+                case BlendMode::NONE:
+                    state.enable_blend = false;
+                    break;
+
+                case BlendMode::ALPHA:
+                    state.enable_blend = true;
+                    state.src_color_blendfactor = SDL_GPU_BLENDFACTOR_SRC_ALPHA;
+                    state.dst_color_blendfactor = SDL_GPU_BLENDFACTOR_ONE_MINUS_SRC_ALPHA;
+                    state.src_alpha_blendfactor = SDL_GPU_BLENDFACTOR_SRC_ALPHA;
+                    state.dst_alpha_blendfactor = SDL_GPU_BLENDFACTOR_ONE_MINUS_SRC_ALPHA;
+                    break;
+
+                case BlendMode::ADDITIVE:
+                    state.enable_blend = true;
+                    state.src_color_blendfactor = SDL_GPU_BLENDFACTOR_SRC_ALPHA;
+                    state.dst_color_blendfactor = SDL_GPU_BLENDFACTOR_ONE;
+                    state.src_alpha_blendfactor = SDL_GPU_BLENDFACTOR_ONE;
+                    state.dst_alpha_blendfactor = SDL_GPU_BLENDFACTOR_ONE;
+                    break;
+
+                case BlendMode::PREMULTIPLIED:
+                    state.enable_blend = true;
+                    state.src_color_blendfactor = SDL_GPU_BLENDFACTOR_ONE;
+                    state.dst_color_blendfactor = SDL_GPU_BLENDFACTOR_ONE_MINUS_SRC_ALPHA;
+                    state.src_alpha_blendfactor = SDL_GPU_BLENDFACTOR_ONE;
+                    state.dst_alpha_blendfactor = SDL_GPU_BLENDFACTOR_ONE_MINUS_SRC_ALPHA;
+                    break;
+            }
+        }
+
+    } // namespace
+
+    // --- ShaderContentIndex ---
+
+    std::uint64_t ShaderContentIndex::hash(
+        std::span<const std::byte> code,
+        SDL_GPUShaderStage stage,
+        const ShaderResources& resources
+    ) {
+        // The stage and resource counts are part of the created object, so they are
+        // part of its identity too
+        std::uint64_t hash = engine::utils::fnv1a64(code.data(), code.size());
+        hash = engine::utils::fnv1a64(&stage, sizeof(stage), hash);
+        return engine::utils::fnv1a64(&resources, sizeof(resources), hash);
+    }
+
+    ShaderId ShaderContentIndex::find(
+        std::uint64_t hash,
+        std::span<const std::byte> code,
+        SDL_GPUShaderStage stage,
+        const ShaderResources& resources
+    ) const {
+        auto [first, last] = entries_.equal_range(hash);
+        for (auto it = first; it != last; ++it) {
+            const Entry& entry = it->second;
+            if (entry.stage == stage && entry.resources == resources &&
+                std::ranges::equal(entry.code, code)) {
+                return entry.id;
+            }
+        }
+        return INVALID_SHADER;
+    }
+
+    void ShaderContentIndex::add(
+        std::uint64_t hash,
+        std::span<const std::byte> code,
+        SDL_GPUShaderStage stage,
+        const ShaderResources& resources,
+        ShaderId id
+    ) {
+        entries_.emplace(hash, Entry{{code.begin(), code.end()}, stage, resources, id});
+    }
+
+    // --- ShaderManager ---
+
+    ShaderManager::ShaderManager(SDL_GPUDevice* device, const AssetLocator& asset_locator)
+        : device_(device)
+        , asset_locator_(asset_locator)
+    {}
+
+    ShaderManager::~ShaderManager() {
+        clearShaders();
+    }
+
+    ShaderId ShaderManager::loadShader(
+        std::string_view file_path,
+        SDL_GPUShaderStage stage,
+        const ShaderResources& resources
+    ) {
+        if (!device_) {
+            spdlog::error("Cannot load shader '{}': no GPU device.", file_path);
+            return INVALID_SHADER;
+        }
+
+        std::string path(file_path);
+        auto path_it = shaders_by_path_.find(path);
+        if (path_it != shaders_by_path_.end()) {
+            return path_it->second;
+        }
+
+        // Packed shaders are read straight from the mapping; loose files are loaded and freed
+        const void* code = nullptr;
+        std::size_t code_size = 0;
+        void* loaded_code = nullptr;
+
+        auto packed = asset_locator_.getData(file_path);
+        if (!packed.empty()) {
+            code = packed.data();
+            code_size = packed.size();
+        } else {
+            loaded_code = SDL_LoadFile(path.c_str(), &code_size);
+            if (!loaded_code) {
+                spdlog::error("Loading shader '{}' failed: {}", file_path, SDL_GetError());
+                return INVALID_SHADER;
+            }
+            code = loaded_code;
+        }
+
+        std::span<const std::byte> content(static_cast<const std::byte*>(code), code_size);
+        std::uint64_t hash = ShaderContentIndex::hash(content, stage, resources);
+
+        if (ShaderId existing = shaders_by_content_.find(hash, content, stage, resources)) {
+            SDL_free(loaded_code);
+            spdlog::debug("Shader '{}' is identical to an already loaded shader; reusing it.", file_path);
+            shaders_by_path_.emplace(std::move(path), existing);
+            return existing;
+        }
+
+        if (shaders_.size() >= 0xFFFF) {
+            SDL_free(loaded_code);
+            spdlog::error("Cannot load shader '{}': shader limit reached.", file_path);
+            return INVALID_SHADER;
+        }
+
+        SDL_GPUShaderCreateInfo info{};
+        info.code = static_cast<const Uint8*>(code);
+        info.code_size = code_size;
+        info.entrypoint = "main";
+        info.format = SDL_GPU_SHADERFORMAT_SPIRV;
+        info.stage = stage;
+        info.num_samplers = resources.num_samplers;
+        info.num_storage_textures = resources.num_storage_textures;
+        info.num_storage_buffers = resources.num_storage_buffers;
+        info.num_uniform_buffers = resources.num_uniform_buffers;
+
+        SDL_GPUShader* shader = SDL_CreateGPUShader(device_, &info);
+        if (!shader) {
+            SDL_free(loaded_code);
+            spdlog::error("Creating shader '{}' failed: {}", file_path, SDL_GetError());
+            return INVALID_SHADER;
+        }
+
+        shaders_.push_back({shader});
+        auto id = static_cast<ShaderId>(shaders_.size());
+        shaders_by_content_.add(hash, content, stage, resources, id);
+        shaders_by_path_.emplace(std::move(path), id);
+        SDL_free(loaded_code);
+
+        spdlog::debug("Loaded shader '{}' ({} bytes) as #{}.", file_path, code_size, id);
+        return id;
+    }
+
+    SDL_GPUShader* ShaderManager::getShader(ShaderId id) const {
+        if (id == INVALID_SHADER || id > shaders_.size()) {
+            return nullptr;
+        }
+        return shaders_[id - 1].shader;
+    }
+
+    SDL_GPUGraphicsPipeline* ShaderManager::getPipeline(const PipelineDescriptor& descriptor) {
+        auto it = pipelines_.find(descriptor.pack());
+        if (it != pipelines_.end()) {
+            return it->second;
+        }
+
+        if (precompiled_) {
+            spdlog::warn(
+                "Pipeline {:#018x} was not precompiled and is being created at runtime.",
+                descriptor.pack()
+            );
+        }
+
+        SDL_GPUGraphicsPipeline* pipeline = createPipeline(descriptor);
+        if (pipeline) {
+            pipelines_.emplace(descriptor.pack(), pipeline);
+        }
+        return pipeline;
+    }
+
+    std::size_t ShaderManager::precompile(std::span<const PipelineDescriptor> descriptors) {
+        auto start = std::chrono::steady_clock::now();
+        std::size_t created = 0;
+
+        for (const auto& descriptor : descriptors) {
+            if (pipelines_.contains(descriptor.pack())) {
+                continue;
+            }
+
+            if (SDL_GPUGraphicsPipeline* pipeline = createPipeline(descriptor)) {
+                pipelines_.emplace(descriptor.pack(), pipeline);
+                ++created;
+            }
+        }
+
+        auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start);
+        spdlog::info(
+            "Precompiled {} of {} pipeline variants in {:.2f} ms ({} cached).",
+            created,
+            descriptors.size(),
+            elapsed.count(),
+            pipelines_.size()
+        );
+
+        precompiled_ = true;
+        return created;
+    }
+
+    SDL_GPUGraphicsPipeline* ShaderManager::createPipeline(const PipelineDescriptor& descriptor) {
+        SDL_GPUShader* vertex_shader = getShader(descriptor.vertex_shader);
+        SDL_GPUShader* fragment_shader = getShader(descriptor.fragment_shader);
+        if (!device_ || !vertex_shader || !fragment_shader) {
+            spdlog::error("Cannot create pipeline {:#018x}: missing device or shader.", descriptor.pack());
+            return nullptr;
+        }
+
+        SDL_GPUGraphicsPipelineCreateInfo pipeline_info{};
+        pipeline_info.vertex_shader = vertex_shader;
+        pipeline_info.fragment_shader = fragment_shader;
+        pipeline_info.primitive_type = descriptor.primitive_type;
+
+        SDL_GPUVertexBufferDescription buffer_description{};
+        buffer_description.slot = 0;
+        buffer_description.input_rate = SDL_GPU_VERTEXINPUTRATE_VERTEX;
+        buffer_description.instance_step_rate = 0;
+
+        SDL_GPUVertexAttribute attributes[3]{};
+        Uint32 num_attributes = 0;
+
+        switch (descriptor.vertex_layout) {
+            case VertexLayout::POSITION_COLOR:
+                attributes[0] = {0, 0, SDL_GPU_VERTEXELEMENTFORMAT_FLOAT3, 0};
+                attributes[1] = {1, 0, SDL_GPU_VERTEXELEMENTFORMAT_FLOAT4, sizeof(float) * 3};
+                num_attributes = 2;
+                buffer_description.pitch = sizeof(float) * 7;
+                break;
+
+            case VertexLayout::POSITION_COLOR_UV:
+                attributes[0] = {0, 0, SDL_GPU_VERTEXELEMENTFORMAT_FLOAT2, 0};
+                attributes[1] = {1, 0, SDL_GPU_VERTEXELEMENTFORMAT_FLOAT4, sizeof(float) * 2};
+                attributes[2] = {2, 0, SDL_GPU_VERTEXELEMENTFORMAT_FLOAT2, sizeof(float) * 6};
+                num_attributes = 3;
+                buffer_description.pitch = sizeof(float) * 8;
+                break;
+        }
+
+        pipeline_info.vertex_input_state.num_vertex_buffers = 1;
+        pipeline_info.vertex_input_state.vertex_buffer_descriptions = &buffer_description;
+        pipeline_info.vertex_input_state.num_vertex_attributes = num_attributes;
+        pipeline_info.vertex_input_state.vertex_attributes = attributes;
+
+        SDL_GPUColorTargetDescription color_target{};
+        color_target.format = descriptor.color_format;
+        fillBlendState(descriptor.blend_mode, color_target.blend_state);
+
+        pipeline_info.target_info.num_color_targets = 1;
+        pipeline_info.target_info.color_target_descriptions = &color_target;
+
+        SDL_GPUGraphicsPipeline* pipeline = SDL_CreateGPUGraphicsPipeline(device_, &pipeline_info);
+        if (!pipeline) {
+            spdlog::error("Creating pipeline {:#018x} failed: {}", descriptor.pack(), SDL_GetError());
+        }
+        return pipeline;
+    }
+
+    void ShaderManager::clearShaders() {
+        if (!device_) {
+            return;
+        }
+
+        if (!pipelines_.empty() || !shaders_.empty()) {
+            spdlog::debug("Releasing {} pipelines and {} shaders.", pipelines_.size(), shaders_.size());
+        }
+
+        for (auto& [key, pipeline] : pipelines_) {
+            SDL_ReleaseGPUGraphicsPipeline(device_, pipeline);
+        }
+
+        for (auto& entry : shaders_) {
+            SDL_ReleaseGPUShader(device_, entry.shader);
+        }
+
+        pipelines_.clear();
+        shaders_.clear();
+        shaders_by_path_.clear();
+        shaders_by_content_.clear();
+        precompiled_ = false;
+    }
+
+} // namespace engine::resource
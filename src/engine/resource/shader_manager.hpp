@@ -1,31 +1,179 @@
 #ifndef SHADER_MANAGER_HPP_
 #define SHADER_MANAGER_HPP_
 
-#include <memory>
-#include <stdexcept>
+#include <cstddef>
+#include <cstdint>
+#include <span>
 #include <string>
 #include <string_view>
 #include <unordered_map>
-#include <SDL3/SDL_render.h>
-#include <glm/glm.hpp>
+#include <vector>
+#include <SDL3/SDL_gpu.h>
 
 namespace engine::resource {
+    class AssetLocator;
 
+    /// @brief Handle to a shader owned by the ShaderManager. 0 is never a valid shader.
+    using ShaderId = std::uint16_t;
+    inline constexpr ShaderId INVALID_SHADER = 0;
+
+    enum class BlendMode : std::uint8_t {
+        NONE,
+        ALPHA,
+        ADDITIVE,
+        PREMULTIPLIED,
+    };
+
+    enum class VertexLayout : std::uint8_t {
+        /// @brief float3 position, float4 color (engine::render::Vertex).
+        POSITION_COLOR,
+        /// @brief float2 position, float4 color, float2 uv (same layout as SDL_Vertex).
+        POSITION_COLOR_UV,
+    };
+
+    /// @brief Resource counts a shader is compiled against.
+    struct ShaderResources {
+        std::uint32_t num_samplers = 0;
+        std::uint32_t num_storage_textures = 0;
+        std::uint32_t num_storage_buffers = 0;
+        std::uint32_t num_uniform_buffers = 0;
+
+        bool operator==(const ShaderResources& other) const = default;
+    };
+
+    /// @brief Everything that distinguishes one graphics pipeline from another.
+    ///
+    /// The descriptor packs losslessly into 64 bits, which is used directly as the
+    /// pipeline cache key.
+    struct PipelineDescriptor {
+        ShaderId vertex_shader = INVALID_SHADER;
+        ShaderId fragment_shader = INVALID_SHADER;
+        SDL_GPUTextureFormat color_format = SDL_GPU_TEXTUREFORMAT_INVALID;
+        BlendMode blend_mode = BlendMode::ALPHA;
+        VertexLayout vertex_layout = VertexLayout::POSITION_COLOR;
+        SDL_GPUPrimitiveType primitive_type = SDL_GPU_PRIMITIVETYPE_TRIANGLELIST;
+
+        /// @brief Layout: vertex 16 | fragment 16 | format 16 | blend 4 | layout 4 | primitive 4.
+        constexpr std::uint64_t pack() const {
+            return (static_cast<std::uint64_t>(vertex_shader) << 48) |
+                   (static_cast<std::uint64_t>(fragment_shader) << 32) |
+                   (static_cast<std::uint64_t>(color_format & 0xFFFF) << 16) |
+                   (static_cast<std::uint64_t>(static_cast<std::uint8_t>(blend_mode) & 0xF) << 8) |
+                   (static_cast<std::uint64_t>(static_cast<std::uint8_t>(vertex_layout) & 0xF) << 4) |
+                   (static_cast<std::uint64_t>(primitive_type & 0xF));
+        }
+
+        /// @brief The descriptor a key returned by pack() was made from.
+        static constexpr PipelineDescriptor unpack(std::uint64_t key) {
+            PipelineDescriptor descriptor;
+            descriptor.vertex_shader = static_cast<ShaderId>(key >> 48);
+            descriptor.fragment_shader = static_cast<ShaderId>(key >> 32);
+            descriptor.color_format = static_cast<SDL_GPUTextureFormat>((key >> 16) & 0xFFFF);
+            descriptor.blend_mode = static_cast<BlendMode>((key >> 8) & 0xF);
+            descriptor.vertex_layout = static_cast<VertexLayout>((key >> 4) & 0xF);
+            descriptor.primitive_type = static_cast<SDL_GPUPrimitiveType>(key & 0xF);
+            return descriptor;
+        }
+
+        constexpr bool operator==(const PipelineDescriptor& other) const {
+            return pack() == other.pack();
+        }
+    };
+
+    /// @brief The shaders created so far, by content: bytecode, stage and resource counts.
+    ///
+    /// Lookups go through a 64-bit hash of the content, and a hit is confirmed by comparing
+    /// the bytes, so two programs whose hashes collide are never mistaken for one another.
+    class ShaderContentIndex final {
+    public:
+        static std::uint64_t hash(
+            std::span<const std::byte> code,
+            SDL_GPUShaderStage stage,
+            const ShaderResources& resources
+        );
+
+        /// @brief The shader with this content, or INVALID_SHADER.
+        /// @param hash hash() of the content
+        ShaderId find(
+            std::uint64_t hash,
+            std::span<const std::byte> code,
+            SDL_GPUShaderStage stage,
+            const ShaderResources& resources
+        ) const;
+
+        /// @brief Record the content of a created shader; the bytes are copied.
+        void add(
+            std::uint64_t hash,
+            std::span<const std::byte> code,
+            SDL_GPUShaderStage stage,
+            const ShaderResources& resources,
+            ShaderId id
+        );
+
+        void clear() { entries_.clear(); }
+        std::size_t size() const { return entries_.size(); }
+
+    private:
+        struct Entry {
+            std::vector<std::byte> code;
+            SDL_GPUShaderStage stage;
+            ShaderResources resources;
+            ShaderId id;
+        };
+
+        std::unordered_multimap<std::uint64_t, Entry> entries_;
+    };
+
+    /// @brief Loads GPU shaders once and caches graphics pipelines by descriptor.
+    ///
+    /// Shaders are deduplicated by their bytecode, stage and resources, so the same
+    /// program referenced through different paths is only created once. Pipelines are
+    /// expected to be built up front with precompile(); a pipeline first requested at
+    /// runtime is still created, but logged, since creating it stalls the frame.
     class ShaderManager final {
         friend class ResourceManager;
 
     public:
-      explicit ShaderManager();
+        ShaderManager(SDL_GPUDevice* device, const AssetLocator& asset_locator);
+        ~ShaderManager();
 
-      ShaderManager(const ShaderManager&) = delete;
-      ShaderManager& operator=(const ShaderManager&) = delete;
-      ShaderManager(ShaderManager&&) = delete;
-      ShaderManager& operator=(ShaderManager&&) = delete;
+        ShaderManager(const ShaderManager&) = delete;
+        ShaderManager& operator=(const ShaderManager&) = delete;
+        ShaderManager(ShaderManager&&) = delete;
+        ShaderManager& operator=(ShaderManager&&) = delete;
 
     private:
+        struct ShaderEntry {
+            SDL_GPUShader* shader = nullptr;
+        };
+
+        /// @brief Non-owned GPU device. May be null, in which case nothing can be created.
+        SDL_GPUDevice* device_ = nullptr;
+        const AssetLocator& asset_locator_;
+
+        /// @brief Indexed by ShaderId - 1.
+        std::vector<ShaderEntry> shaders_;
+        std::unordered_map<std::string, ShaderId> shaders_by_path_;
+        ShaderContentIndex shaders_by_content_;
+        std::unordered_map<std::uint64_t, SDL_GPUGraphicsPipeline*> pipelines_;
+        bool precompiled_ = false;
+
+        ShaderId loadShader(
+            std::string_view file_path,
+            SDL_GPUShaderStage stage,
+            const ShaderResources& resources
+        );
+        SDL_GPUShader* getShader(ShaderId id) const;
+
+        SDL_GPUGraphicsPipeline* getPipeline(const PipelineDescriptor& descriptor);
+        /// @return The number of pipelines created; ones already cached are skipped.
+        std::size_t precompile(std::span<const PipelineDescriptor> descriptors);
+        std::size_t getPipelineCount() const { return pipelines_.size(); }
 
+        SDL_GPUGraphicsPipeline* createPipeline(const PipelineDescriptor& descriptor);
+        void clearShaders();
     };
 
 } // namespace engine::resource
 
-#endif // SHADER_MANAGER_HPP_
\ No newline at end of file
+#endif // SHADER_MANAGER_HPP_
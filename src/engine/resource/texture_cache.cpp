@@ -0,0 +1,150 @@
+#include "texture_cache.hpp"
+#include "../utils/mapped_file.hpp"
+#include <SDL3/SDL.h>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <vector>
+#include <spdlog/spdlog.h>
+
+namespace engine::resource {
+
+    TextureCache::TextureCache(std::string_view cache_directory)
+        : directory_(cache_directory)
+    {}
+
+    std::filesystem::path TextureCache::getEntryPath(std::uint64_t source_hash) const {
+        char name[32];
+        std::snprintf(name, sizeof(name), "%016llx.stex", static_cast<unsigned long long>(source_hash));
+        return directory_ / name;
+    }
+
+    SDL_Texture* TextureCache::load(SDL_Renderer* renderer, std::uint64_t source_hash) {
+        auto path = getEntryPath(source_hash);
+
+        std::error_code ec;
+        if (!std::filesystem::exists(path, ec)) {
+            ++stats_.misses;
+            return nullptr;
+        }
+
+        try {
+            engine::utils::MappedFile file(path.string());
+            auto bytes = file.bytes();
+
+            Header header{};
+            if (bytes.size() < sizeof(header)) {
+                throw std::runtime_error("truncated header");
+            }
+            std::memcpy(&header, bytes.data(), sizeof(header));
+
+            if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 ||
+                header.version != VERSION ||
+                header.source_hash != source_hash ||
+                header.pixel_format != SDL_PIXELFORMAT_RGBA32) {
+                throw std::runtime_error("stale or foreign entry");
+            }
+
+            if (header.pitch < header.width * 4u ||
+                header.data_size < static_cast<std::uint64_t>(header.pitch) * header.height ||
+                header.data_offset > bytes.size() ||
+                header.data_size > bytes.size() - header.data_offset) {
+                throw std::runtime_error("inconsistent sizes");
+            }
+
+            SDL_Texture* texture = SDL_CreateTexture(
+                renderer,
+                SDL_PIXELFORMAT_RGBA32,
+                SDL_TEXTUREACCESS_STATIC,
+                static_cast<int>(header.width),
+                static_cast<int>(header.height)
+            );
+
+            if (!texture) {
+                spdlog::error("Creating texture from cache entry '{}' failed: {}", path.string(), SDL_GetError());
+                ++stats_.misses;
+                return nullptr;
+            }
+
+            if (!SDL_UpdateTexture(texture, nullptr, bytes.data() + header.data_offset, static_cast<int>(header.pitch))) {
+                spdlog::error("Uploading cache entry '{}' failed: {}", path.string(), SDL_GetError());
+                SDL_DestroyTexture(texture);
+                ++stats_.misses;
+                return nullptr;
+            }
+
+            SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+            ++stats_.hits;
+            return texture;
+        }
+
+        catch (const std::exception& exc) {
+            spdlog::warn("Ignoring texture cache entry '{}': {}.", path.string(), exc.what());
+        }
+
+        ++stats_.misses;
+        return nullptr;
+    }
+
+    bool TextureCache::store(std::uint64_t source_hash, SDL_Surface* surface) {
+        if (!surface || surface->format != SDL_PIXELFORMAT_RGBA32) {
+            return false;
+        }
+
+        std::error_code ec;
+        std::filesystem::create_directories(directory_, ec);
+        if (ec) {
+            spdlog::warn("Unable to create texture cache directory '{}': {}", directory_.string(), ec.message());
+            return false;
+        }
+
+        Header header{};
+        std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+        header.version = VERSION;
+        header.width = static_cast<std::uint32_t>(surface->w);
+        header.height = static_cast<std::uint32_t>(surface->h);
+        header.pitch = (header.width * 4u + ROW_ALIGNMENT - 1) / ROW_ALIGNMENT * ROW_ALIGNMENT;
+        header.pixel_format = SDL_PIXELFORMAT_RGBA32;
+        header.source_hash = source_hash;
+        header.data_offset = sizeof(Header);
+        header.data_size = static_cast<std::uint64_t>(header.pitch) * header.height;
+
+        // Written to a temporary name first so a crash never leaves a truncated entry
+        auto path = getEntryPath(source_hash);
+        auto temp_path = path;
+        temp_path += ".tmp";
+
+        {
+            std::ofstream out(temp_path, std::ios::binary | std::ios::trunc);
+            if (!out.is_open()) {
+                spdlog::warn("Unable to write texture cache entry '{}'.", temp_path.string());
+                return false;
+            }
+
+            out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+            std::vector<char> row(header.pitch, 0);
+            const auto* pixels = static_cast<const char*>(surface->pixels);
+            for (std::uint32_t y = 0; y < header.height; ++y) {
+                std::memcpy(row.data(), pixels + static_cast<std::size_t>(y) * surface->pitch, header.width * 4u);
+                out.write(row.data(), static_cast<std::streamsize>(row.size()));
+            }
+
+            if (!out) {
+                spdlog::warn("Error writing texture cache entry '{}'.", temp_path.string());
+                return false;
+            }
+        }
+
+        std::filesystem::rename(temp_path, path, ec);
+        if (ec) {
+            spdlog::warn("Unable to finalize texture cache entry '{}': {}", path.string(), ec.message());
+            std::filesystem::remove(temp_path, ec);
+            return false;
+        }
+
+        ++stats_.writes;
+        return true;
+    }
+
+} // namespace engine::resource
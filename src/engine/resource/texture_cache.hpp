@@ -0,0 +1,72 @@
+#ifndef TEXTURE_CACHE_HPP_
+#define TEXTURE_CACHE_HPP_
+
+#include <cstdint>
+#include <filesystem>
+#include <string_view>
+
+struct SDL_Renderer;
+struct SDL_Texture;
+struct SDL_Surface;
+
+namespace engine::resource {
+
+    /// @brief On-disk cache of decoded textures, so images are only decoded once.
+    ///
+    /// Entries are `.stex` files named after the content hash of the source image, so
+    /// an edited source simply misses and is re-decoded and re-cached. An entry is a
+    /// 64-byte header followed by the RGBA32 pixels with rows padded to ROW_ALIGNMENT,
+    /// which lets a hit be mapped and uploaded without any conversion.
+    class TextureCache final {
+    public:
+        static constexpr char MAGIC[4] = {'S', 'T', 'E', 'X'};
+        static constexpr std::uint32_t VERSION = 1;
+        static constexpr std::uint32_t ROW_ALIGNMENT = 16;
+
+        struct Header {
+            char magic[4];
+            std::uint32_t version;
+            std::uint32_t width;
+            std::uint32_t height;
+            std::uint32_t pitch;
+            std::uint32_t pixel_format;
+            std::uint64_t source_hash;
+            std::uint64_t data_offset;
+            std::uint64_t data_size;
+            std::uint8_t reserved[16];
+        };
+
+        static_assert(sizeof(Header) == 64, "Texture cache header must be tightly packed.");
+
+        struct Stats {
+            std::uint32_t hits = 0;
+            std::uint32_t misses = 0;
+            std::uint32_t writes = 0;
+        };
+
+        explicit TextureCache(std::string_view cache_directory);
+
+        TextureCache(const TextureCache&) = delete;
+        TextureCache& operator=(const TextureCache&) = delete;
+        TextureCache(TextureCache&&) = delete;
+        TextureCache& operator=(TextureCache&&) = delete;
+
+        /// @brief Create a texture from the entry for `source_hash`, or nullptr on a miss
+        /// (including entries that are corrupt or from an older format).
+        SDL_Texture* load(SDL_Renderer* renderer, std::uint64_t source_hash);
+
+        /// @brief Write an entry for `source_hash` from a decoded RGBA32 surface.
+        bool store(std::uint64_t source_hash, SDL_Surface* surface);
+
+        const Stats& getStats() const { return stats_; }
+
+    private:
+        std::filesystem::path directory_;
+        Stats stats_;
+
+        std::filesystem::path getEntryPath(std::uint64_t source_hash) const;
+    };
+
+} // namespace engine::resource
+
+#endif // TEXTURE_CACHE_HPP_
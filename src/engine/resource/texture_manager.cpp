@@ -1,45 +1,200 @@
 #include "texture_manager.hpp"
+#include "asset_pack.hpp"
+#include "texture_cache.hpp"
+#include "../utils/hash.hpp"
 #include <SDL3_image/SDL_image.h>
 #include <spdlog/spdlog.h>
 #include <stdexcept>
 
 namespace engine::resource {
 
-    TextureManager::TextureManager(SDL_Renderer* renderer): renderer_(renderer) {
+    TextureManager::TextureManager(SDL_Renderer* renderer, const AssetLocator& asset_locator)
+        : renderer_(renderer)
+        , asset_locator_(asset_locator)
+    {
         if (!renderer_) {
             throw std::runtime_error("TextureManager initialization failed: SDL_Renderer pointer missing.");
         }
+
+        setCacheEnabled(true);
+    }
+
+    TextureManager::~TextureManager() = default;
+
+    void TextureManager::setCacheEnabled(bool enabled) {
+        if (enabled && !cache_) {
+            cache_ = std::make_unique<TextureCache>("cache/textures");
+        } else if (!enabled) {
+            cache_.reset();
+        }
+    }
+
+    void TextureManager::setBudget(std::size_t budget_bytes) {
+        budget_bytes_ = budget_bytes;
+        evictToBudget();
+    }
+
+    TextureManager::Stats TextureManager::getStats() const {
+        Stats stats = stats_;
+        stats.budget_bytes = budget_bytes_;
+        return stats;
+    }
+
+    void TextureManager::endFrame() {
+        ++frame_;
+        evictToBudget();
+    }
+
+    SDL_Texture* TextureManager::touch(TextureEntry& entry) {
+        ++stats_.hits;
+        entry.last_used_frame = frame_;
+        lru_.splice(lru_.begin(), lru_, entry.lru_position);
+        return entry.texture.get();
+    }
+
+    std::size_t TextureManager::computeSize(SDL_Texture* texture) {
+        float width = 0.0f;
+        float height = 0.0f;
+        if (!SDL_GetTextureSize(texture, &width, &height)) {
+            return 0;
+        }
+
+        // Textures are created as RGBA32, but count what the renderer actually chose
+        std::size_t bytes_per_pixel = SDL_BYTESPERPIXEL(texture->format);
+        if (bytes_per_pixel == 0) {
+            bytes_per_pixel = 4;
+        }
+        return static_cast<std::size_t>(width) * static_cast<std::size_t>(height) * bytes_per_pixel;
+    }
+
+    void TextureManager::evictToBudget() {
+        if (budget_bytes_ == 0) {
+            return;
+        }
+
+        auto it = lru_.end();
+        while (stats_.resident_bytes > budget_bytes_ && it != lru_.begin()) {
+            --it;
+            auto entry_it = textures_.find(*it);
+
+            // Everything in front of a texture used this frame was used this frame too
+            if (entry_it->second.last_used_frame == frame_) {
+                break;
+            }
+
+            // A scope still holds it: it is unloaded once released, not before
+            if (entry_it->second.pinned) {
+                continue;
+            }
+
+            stats_.resident_bytes -= entry_it->second.size_bytes;
+            ++stats_.evictions;
+            evicted_.insert(*it);
+            textures_.erase(entry_it);
+            it = lru_.erase(it);
+        }
+
+        if (stats_.resident_bytes > budget_bytes_) {
+            spdlog::debug(
+                "Textures used this frame or held by scopes ({} bytes) exceed the {} byte budget.",
+                stats_.resident_bytes,
+                budget_bytes_
+            );
+        }
     }
 
     SDL_Texture* TextureManager::loadTexture(std::string_view file_path) {
-        auto it = textures_.find(std::string(file_path));
+        auto it = textures_.find(file_path);
 
         // Try to load from the texture cache first
         if (it != textures_.end()) {
-            spdlog::error("Unable to load texture '{}'.", file_path);
-            return it->second.get();
+            return touch(it->second);
+        }
+
+        ++stats_.misses;
+
+        // Didn't find cached texture, so reading the source from a mounted pack, then the file path
+        auto source = asset_locator_.getData(file_path);
+        void* loaded_source = nullptr;
+        if (source.empty()) {
+            std::size_t size = 0;
+            loaded_source = SDL_LoadFile(std::string(file_path).c_str(), &size);
+            if (!loaded_source) {
+                spdlog::error("Loading texture '{}' failed: {}.", file_path, SDL_GetError());
+                return nullptr;
+            }
+            source = {static_cast<const std::byte*>(loaded_source), size};
         }
 
-        // Didn't find cached texture, so trying to load from file path
-        SDL_Texture* raw_tex = IMG_LoadTexture(renderer_, file_path.data());
+        SDL_Texture* raw_tex = createTexture(file_path, source);
+        SDL_free(loaded_source);
 
         if (!raw_tex) {
             spdlog::error("Loading texture '{}' failed: {}.", file_path, SDL_GetError());
             return nullptr;
         }
 
-        textures_.emplace(file_path, std::unique_ptr<SDL_Texture, SDLTextureDeleter>(raw_tex));
+        TextureEntry entry;
+        entry.texture.reset(raw_tex);
+        entry.size_bytes = computeSize(raw_tex);
+        entry.last_used_frame = frame_;
+        entry.lru_position = lru_.emplace(lru_.begin(), file_path);
+
+        stats_.resident_bytes += entry.size_bytes;
+        textures_.emplace(file_path, std::move(entry));
+        if (auto evicted = evicted_.find(file_path); evicted != evicted_.end()) {
+            evicted_.erase(evicted);
+        }
         spdlog::debug("Successfully loaded and cached texture: {}.", file_path);
+
+        evictToBudget();
         return raw_tex;
     }
 
+    SDL_Texture* TextureManager::createTexture(std::string_view file_path, std::span<const std::byte> source) {
+        std::uint64_t source_hash = engine::utils::fnv1a64(source.data(), source.size());
+
+        if (cache_) {
+            if (SDL_Texture* cached = cache_->load(renderer_, source_hash)) {
+                ++stats_.cache_hits;
+                return cached;
+            }
+        }
+
+        ++stats_.decodes;
+        SDL_IOStream* stream = SDL_IOFromConstMem(source.data(), source.size());
+        SDL_Surface* decoded = stream ? IMG_Load_IO(stream, true) : nullptr;
+        if (!decoded) {
+            return nullptr;
+        }
+
+        // Normalized to RGBA32 so the cache entry can be uploaded as-is next time
+        SDL_Surface* surface = SDL_ConvertSurface(decoded, SDL_PIXELFORMAT_RGBA32);
+        SDL_DestroySurface(decoded);
+        if (!surface) {
+            return nullptr;
+        }
+
+        SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer_, surface);
+        if (texture && cache_ && !cache_->store(source_hash, surface)) {
+            spdlog::debug("Texture '{}' was not written to the texture cache.", file_path);
+        }
+
+        SDL_DestroySurface(surface);
+        return texture;
+    }
+
     SDL_Texture* TextureManager::getTexture(std::string_view file_path) {
-        auto it = textures_.find(std::string(file_path));
+        auto it = textures_.find(file_path);
         if (it != textures_.end()) {
-            return it->second.get();
+            return touch(it->second);
         }
 
-        spdlog::warn("Texture '{}' not in cache. Trying to load.", file_path);
+        if (evicted_.contains(file_path)) {
+            spdlog::debug("Reloading texture '{}' evicted for the memory budget.", file_path);
+        } else {
+            spdlog::warn("Texture '{}' not in cache. Trying to load.", file_path);
+        }
         return loadTexture(file_path);
     }
 
@@ -57,22 +212,39 @@ namespace engine::resource {
     }
 
     void TextureManager::unloadTexture(std::string_view file_path) {
-        auto it = textures_.find(std::string(file_path));
+        auto it = textures_.find(file_path);
         if (it != textures_.end()) {
             spdlog::debug("Unloaded texture: {}.", file_path);
+            stats_.resident_bytes -= it->second.size_bytes;
+            lru_.erase(it->second.lru_position);
             textures_.erase(it);
         }
 
+        // Evicted for the budget in the meantime: it is gone already, but no longer wanted back
+        else if (auto evicted = evicted_.find(file_path); evicted != evicted_.end()) {
+            evicted_.erase(evicted);
+        }
+
         else {
             spdlog::warn("Tried unloading non-existent texture: {}.", file_path);
         }
     }
 
+    void TextureManager::setPinned(std::string_view file_path, bool pinned) {
+        if (auto it = textures_.find(file_path); it != textures_.end()) {
+            it->second.pinned = pinned;
+        }
+    }
+
     void TextureManager::clearTextures() {
         if (!textures_.empty()) {
             spdlog::debug("Clearing all {} cached textures.", textures_.size());
             textures_.clear();
         }
+
+        lru_.clear();
+        evicted_.clear();
+        stats_.resident_bytes = 0;
     }
 
 } // namespace engine::resource
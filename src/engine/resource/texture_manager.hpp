@@ -1,21 +1,49 @@
 #ifndef TEXTURE_MANAGER_HPP_
 #define TEXTURE_MANAGER_HPP_
 
+#include "../utils/hash.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <list>
 #include <memory>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <string_view>
 #include <unordered_map>
+#include <unordered_set>
 #include <SDL3/SDL_render.h>
 #include <glm/glm.hpp>
 
 namespace engine::resource {
+    class AssetLocator;
+    class TextureCache;
 
+    /// @brief Loads and caches textures by path, within an optional memory budget.
+    ///
+    /// Every lookup moves the texture to the front of an LRU list. When the resident
+    /// size exceeds the budget, the least recently used textures are destroyed, except
+    /// those used during the current frame since callers may still hold their pointers,
+    /// and those pinned because a live resource scope references them.
+    /// An evicted texture is reloaded transparently the next time it is requested.
     class TextureManager final {
         friend class ResourceManager;
 
     public:
-        explicit TextureManager(SDL_Renderer* renderer);
+        struct Stats {
+            std::uint64_t hits = 0;
+            std::uint64_t misses = 0;
+            std::uint64_t evictions = 0;
+            /// @brief Loads that decoded their source image.
+            std::uint64_t decodes = 0;
+            /// @brief Loads served by the decoded texture cache instead.
+            std::uint64_t cache_hits = 0;
+            std::size_t resident_bytes = 0;
+            std::size_t budget_bytes = 0;
+        };
+
+        TextureManager(SDL_Renderer* renderer, const AssetLocator& asset_locator);
+        ~TextureManager();
 
         TextureManager(const TextureManager&) = delete;
         TextureManager& operator=(const TextureManager&) = delete;
@@ -31,14 +59,55 @@ namespace engine::resource {
             }
         };
 
-        std::unordered_map<std::string, std::unique_ptr<SDL_Texture, SDLTextureDeleter>> textures_;
+        struct TextureEntry {
+            std::unique_ptr<SDL_Texture, SDLTextureDeleter> texture;
+            std::size_t size_bytes = 0;
+            std::uint64_t last_used_frame = 0;
+            /// @brief Referenced by a live resource scope: never evicted for the budget.
+            bool pinned = false;
+            /// @brief Position in lru_; the key it points at is this entry's own key.
+            std::list<std::string>::iterator lru_position;
+        };
+
+        std::unordered_map<std::string, TextureEntry, engine::utils::StringHash, std::equal_to<>> textures_;
+        /// @brief Texture paths, most recently used first.
+        std::list<std::string> lru_;
+        /// @brief Paths evicted for the budget, so their reload is not reported as a miss-load.
+        std::unordered_set<std::string, engine::utils::StringHash, std::equal_to<>> evicted_;
+
         SDL_Renderer* renderer_ = nullptr;
+        const AssetLocator& asset_locator_;
+
+        /// @brief Decoded texture cache; null when disabled.
+        std::unique_ptr<TextureCache> cache_;
+
+        /// @brief 0 means unlimited.
+        std::size_t budget_bytes_ = 0;
+        std::uint64_t frame_ = 0;
+        Stats stats_;
 
         SDL_Texture* loadTexture(std::string_view file_path);
         SDL_Texture* getTexture(std::string_view file_path);
         glm::vec2 getTextureSize(std::string_view file_path);
         void unloadTexture(std::string_view file_path);
         void clearTextures();
+        void setCacheEnabled(bool enabled);
+        /// @brief Exempt a resident texture from budget eviction, or make it evictable again.
+        void setPinned(std::string_view file_path, bool pinned);
+
+        void setBudget(std::size_t budget_bytes);
+        Stats getStats() const;
+
+        /// @brief Advance the frame counter and evict down to the budget.
+        void endFrame();
+
+        /// @brief Mark a resident texture as used this frame.
+        SDL_Texture* touch(TextureEntry& entry);
+        void evictToBudget();
+        static std::size_t computeSize(SDL_Texture* texture);
+
+        /// @brief Create a texture from encoded image bytes, through the decoded cache.
+        SDL_Texture* createTexture(std::string_view file_path, std::span<const std::byte> source);
 
     };
 
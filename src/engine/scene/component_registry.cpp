@@ -0,0 +1,268 @@
+#include "component_registry.hpp"
+#include "../core/context.hpp"
+#include "../object/components/transform_component.hpp"
+#include "../object/components/sprite_component.hpp"
+#include "../object/components/parallax_component.hpp"
+#include "../object/components/physics_component.hpp"
+#include "../resource/resource_manager.hpp"
+#include <spdlog/spdlog.h>
+
+namespace engine::scene {
+
+    using engine::object::GameObject;
+    using engine::object::components::ParallaxComponent;
+    using engine::object::components::PhysicsComponent;
+    using engine::object::components::SpriteComponent;
+    using engine::object::components::TransformComponent;
+
+    namespace {
+
+        // --- TransformComponent ---
+
+        struct TransformRecord {
+            float position[2];
+            float scale[2];
+            float rotation;
+        };
+
+        static_assert(sizeof(TransformRecord) == 20, "Transform record must be tightly packed.");
+
+        TransformRecord saveTransform(const TransformComponent& transform) {
+            return TransformRecord{
+                {transform.position_.x, transform.position_.y},
+                {transform.scale_.x, transform.scale_.y},
+                transform.rotation_,
+            };
+        }
+
+        void applyTransform(TransformComponent& transform, const TransformRecord& record) {
+            transform.position_ = {record.position[0], record.position[1]};
+            transform.scale_ = {record.scale[0], record.scale[1]};
+            transform.rotation_ = record.rotation;
+        }
+
+        TransformComponent* createTransform(GameObject& game_object, engine::core::Context&, const TransformRecord& record) {
+            // The object may already have one, added by a component restored before it
+            auto* transform = game_object.addComponent<TransformComponent>();
+            applyTransform(*transform, record);
+            return transform;
+        }
+
+        // --- PhysicsComponent ---
+
+        struct PhysicsRecord {
+            float velocity[2];
+            float collider_size[2];
+            float collider_offset[2];
+            float mass;
+            std::uint8_t use_gravity;
+            std::uint8_t enabled;
+            std::uint8_t is_static;
+            std::uint8_t reserved;
+        };
+
+        static_assert(sizeof(PhysicsRecord) == 32, "Physics record must be tightly packed.");
+
+        PhysicsRecord savePhysics(const PhysicsComponent& body) {
+            glm::vec2 velocity = body.getVelocity();
+            return PhysicsRecord{
+                {velocity.x, velocity.y},
+                {body.getColliderSize().x, body.getColliderSize().y},
+                {body.getColliderOffset().x, body.getColliderOffset().y},
+                body.getMass(),
+                body.isUsingGravity(),
+                body.isEnabled(),
+                body.isStatic(),
+                0,
+            };
+        }
+
+        void applyPhysics(PhysicsComponent& body, const PhysicsRecord& record) {
+            body.setMass(record.mass);
+            body.setUseGravity(record.use_gravity != 0);
+            body.setEnabled(record.enabled != 0);
+            body.setStatic(record.is_static != 0);
+            body.setCollider(
+                {record.collider_size[0], record.collider_size[1]},
+                {record.collider_offset[0], record.collider_offset[1]}
+            );
+            body.setVelocity({record.velocity[0], record.velocity[1]});
+        }
+
+        PhysicsComponent* createPhysics(GameObject& game_object, engine::core::Context& context, const PhysicsRecord& record) {
+            auto* body = game_object.addComponent<PhysicsComponent>(context.getPhysicsEngine(), record.use_gravity != 0, record.mass);
+            applyPhysics(*body, record);
+            return body;
+        }
+
+        // --- SpriteComponent ---
+
+        enum SpriteFlags : std::uint8_t {
+            SPRITE_HAS_SOURCE_RECT = 1 << 0,
+            SPRITE_FLIPPED = 1 << 1,
+            SPRITE_HIDDEN = 1 << 2,
+        };
+
+        void saveSprite(const SpriteComponent& sprite_component, SnapshotWriter& writer) {
+            const auto& sprite = sprite_component.getSprite();
+            const auto& source_rect = sprite.getSourceRect();
+
+            std::uint8_t flags = 0;
+            flags |= source_rect.has_value() ? SPRITE_HAS_SOURCE_RECT : 0;
+            flags |= sprite.isFlipped() ? SPRITE_FLIPPED : 0;
+            flags |= sprite_component.isHidden() ? SPRITE_HIDDEN : 0;
+
+            writer.writeString(sprite.getTextureId());
+            writer.write(flags);
+            if (source_rect.has_value()) {
+                writer.write(*source_rect);
+            }
+        }
+
+        struct SpriteState {
+            std::string_view texture_id;
+            std::optional<SDL_FRect> source_rect;
+            bool is_flipped;
+            bool is_hidden;
+        };
+
+        SpriteState readSprite(SnapshotReader& reader) {
+            SpriteState state;
+            state.texture_id = reader.readString();
+            auto flags = reader.read<std::uint8_t>();
+            if (flags & SPRITE_HAS_SOURCE_RECT) {
+                state.source_rect = reader.read<SDL_FRect>();
+            }
+            state.is_flipped = (flags & SPRITE_FLIPPED) != 0;
+            state.is_hidden = (flags & SPRITE_HIDDEN) != 0;
+            return state;
+        }
+
+        SpriteComponent* createSprite(GameObject& game_object, engine::core::Context& context, SnapshotReader& reader) {
+            SpriteState state = readSprite(reader);
+            auto* sprite = game_object.addComponent<SpriteComponent>(
+                state.texture_id,
+                context.getResourceManager(),
+                state.source_rect,
+                state.is_flipped
+            );
+            sprite->setHidden(state.is_hidden);
+            return sprite;
+        }
+
+        void applySprite(SpriteComponent& sprite, SnapshotReader& reader) {
+            SpriteState state = readSprite(reader);
+            if (sprite.getSprite().getTextureId() != state.texture_id) {
+                sprite.setTextureId(state.texture_id);
+            }
+            sprite.setSourceRect(state.source_rect);
+            sprite.setFlipped(state.is_flipped);
+            sprite.setHidden(state.is_hidden);
+        }
+
+        // --- ParallaxComponent ---
+
+        struct ParallaxState {
+            std::string_view texture_id;
+            float scroll_factor[2];
+            std::uint8_t repeat[2];
+            std::uint8_t is_hidden;
+        };
+
+        void saveParallax(const ParallaxComponent& parallax, SnapshotWriter& writer) {
+            writer.writeString(parallax.getSprite().getTextureId());
+            writer.write(parallax.getScrollFactor().x);
+            writer.write(parallax.getScrollFactor().y);
+            writer.write(static_cast<std::uint8_t>(parallax.getRepeat().x));
+            writer.write(static_cast<std::uint8_t>(parallax.getRepeat().y));
+            writer.write(static_cast<std::uint8_t>(parallax.isHidden()));
+        }
+
+        ParallaxState readParallax(SnapshotReader& reader) {
+            ParallaxState state;
+            state.texture_id = reader.readString();
+            state.scroll_factor[0] = reader.read<float>();
+            state.scroll_factor[1] = reader.read<float>();
+            state.repeat[0] = reader.read<std::uint8_t>();
+            state.repeat[1] = reader.read<std::uint8_t>();
+            state.is_hidden = reader.read<std::uint8_t>();
+            return state;
+        }
+
+        void applyParallaxState(ParallaxComponent& parallax, const ParallaxState& state) {
+            if (parallax.getSprite().getTextureId() != state.texture_id) {
+                parallax.setSprite(engine::render::Sprite(state.texture_id));
+            }
+            parallax.setScrollFactor({state.scroll_factor[0], state.scroll_factor[1]});
+            parallax.setRepeat({state.repeat[0] != 0, state.repeat[1] != 0});
+            parallax.setHidden(state.is_hidden != 0);
+        }
+
+        ParallaxComponent* createParallax(GameObject& game_object, engine::core::Context&, SnapshotReader& reader) {
+            ParallaxState state = readParallax(reader);
+            auto* parallax = game_object.addComponent<ParallaxComponent>(
+                state.texture_id,
+                glm::vec2(state.scroll_factor[0], state.scroll_factor[1]),
+                glm::bvec2(state.repeat[0] != 0, state.repeat[1] != 0)
+            );
+            parallax->setHidden(state.is_hidden != 0);
+            return parallax;
+        }
+
+        void applyParallax(ParallaxComponent& parallax, SnapshotReader& reader) {
+            applyParallaxState(parallax, readParallax(reader));
+        }
+
+    } // namespace
+
+    ComponentRegistry& ComponentRegistry::shared() {
+        static auto* registry = new ComponentRegistry();
+        return *registry;
+    }
+
+    ComponentRegistry::ComponentRegistry() {
+        registerEngineComponents();
+    }
+
+    const ComponentRegistry::ComponentType* ComponentRegistry::find(std::type_index type) const {
+        auto it = by_type_.find(type);
+        return it != by_type_.end() ? types_[it->second].get() : nullptr;
+    }
+
+    const ComponentRegistry::ComponentType* ComponentRegistry::findById(std::uint32_t id) const {
+        auto it = by_id_.find(id);
+        return it != by_id_.end() ? types_[it->second].get() : nullptr;
+    }
+
+    void ComponentRegistry::add(ComponentType type) {
+        if (by_type_.contains(type.type)) {
+            spdlog::warn("Component type '{}' is already registered for snapshots.", type.name);
+            return;
+        }
+
+        if (auto it = by_id_.find(type.id); it != by_id_.end()) {
+            spdlog::error(
+                "Component type '{}' hashes like '{}'; pick another name to register it.",
+                type.name,
+                types_[it->second]->name
+            );
+            return;
+        }
+
+        type.order = types_.size();
+        by_type_.emplace(type.type, types_.size());
+        by_id_.emplace(type.id, types_.size());
+        types_.push_back(std::make_unique<ComponentType>(std::move(type)));
+    }
+
+    void ComponentRegistry::registerEngineComponents() {
+        // TransformComponent first: the others add a default one in init() when it is missing
+        registerPodComponent<TransformComponent, TransformRecord>("transform", saveTransform, createTransform, applyTransform);
+        registerPodComponent<PhysicsComponent, PhysicsRecord>("physics", savePhysics, createPhysics, applyPhysics);
+        registerComponent<SpriteComponent>("sprite", saveSprite, createSprite, applySprite);
+        registerComponent<ParallaxComponent>("parallax", saveParallax, createParallax, applyParallax);
+
+        // TilemapComponent is left out: its map comes from a level file, not from state
+    }
+
+} // namespace engine::scene
@@ -0,0 +1,186 @@
+#ifndef COMPONENT_REGISTRY_HPP_
+#define COMPONENT_REGISTRY_HPP_
+
+#include "snapshot_io.hpp"
+#include "../object/game_object.hpp"
+#include "../utils/hash.hpp"
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+namespace engine::core {
+    class Context;
+}
+
+namespace engine::scene {
+
+    /**
+     * @brief The component types scene snapshots can hold, and how each is saved and
+     * restored.
+     *
+     * A type registers under a name whose hash identifies its records in snapshot data, so
+     * snapshots stay readable when types are added or reordered. Two kinds of types exist:
+     *
+     *  - POD components describe their state as a trivially copyable record. Records are
+     *    stored back to back and copied out with memcpy when restoring: no parsing.
+     *  - Other components write and read their state field by field (e.g. a texture id).
+     *
+     * Components are restored type by type in registration order, so types that others
+     * look up in their init() (TransformComponent) must be registered first. The engine's
+     * components are registered when the registry is created; games register their own at
+     * startup. Not thread-safe: used from the main thread only.
+     */
+    class ComponentRegistry final {
+    public:
+        struct ComponentType {
+            std::uint32_t id;               ///< @brief Hash of the name, stored in snapshots
+            std::string name;
+            std::type_index type;
+            std::uint32_t record_size;      ///< @brief Bytes per record; 0 for variable-size records
+            std::size_t order;              ///< @brief Position in registration (and restore) order
+
+            /// @brief The component of this type on an object, or null.
+            engine::object::Component* (*find)(const engine::object::GameObject&);
+            /// @brief Write the records of `components` back to back; variable-size records
+            /// also push where each starts, and where the last ends, to the offsets.
+            std::function<void(std::span<const engine::object::Component* const>, SnapshotWriter&, std::vector<std::uint32_t>&)> save;
+            /// @brief Add a component to each object, built from the record of the same index.
+            std::function<void(std::span<engine::object::GameObject* const>, engine::core::Context&, const SnapshotColumn&)> create;
+            /// @brief Overwrite existing components with the record of the same index.
+            std::function<void(std::span<engine::object::Component* const>, const SnapshotColumn&)> apply;
+        };
+
+        /// @brief The process-wide registry. Never destroyed.
+        static ComponentRegistry& shared();
+
+        ComponentRegistry();
+
+        ComponentRegistry(const ComponentRegistry&) = delete;
+        ComponentRegistry& operator=(const ComponentRegistry&) = delete;
+        ComponentRegistry(ComponentRegistry&&) = delete;
+        ComponentRegistry& operator=(ComponentRegistry&&) = delete;
+
+        /// @brief Register a component whose state is the trivially copyable `Record`.
+        /// @param save Record of a component's state
+        /// @param create Add a component built from a record to an object
+        /// @param apply Set an existing component to the state of a record
+        template <typename T, typename Record>
+        void registerPodComponent(
+            std::string_view name,
+            Record (*save)(const T&),
+            T* (*create)(engine::object::GameObject&, engine::core::Context&, const Record&),
+            void (*apply)(T&, const Record&)
+        ) {
+            static_assert(std::is_trivially_copyable_v<Record>, "POD component records must be trivially copyable.");
+
+            auto type = makeType<T>(name, sizeof(Record));
+            type.save = [save](std::span<const engine::object::Component* const> components, SnapshotWriter& writer, std::vector<std::uint32_t>&) {
+                std::byte* out = writer.grow(components.size() * sizeof(Record));
+                for (const auto* component : components) {
+                    Record record = save(*static_cast<const T*>(component));
+                    std::memcpy(out, &record, sizeof(Record));
+                    out += sizeof(Record);
+                }
+            };
+            type.create = [create](std::span<engine::object::GameObject* const> owners, engine::core::Context& context, const SnapshotColumn& column) {
+                const std::byte* in = column.getRecords().data();
+                for (auto* owner : owners) {
+                    Record record;
+                    std::memcpy(&record, in, sizeof(Record));
+                    create(*owner, context, record);
+                    in += sizeof(Record);
+                }
+            };
+            type.apply = [apply](std::span<engine::object::Component* const> components, const SnapshotColumn& column) {
+                const std::byte* in = column.getRecords().data();
+                for (auto* component : components) {
+                    Record record;
+                    std::memcpy(&record, in, sizeof(Record));
+                    apply(*static_cast<T*>(component), record);
+                    in += sizeof(Record);
+                }
+            };
+            add(std::move(type));
+        }
+
+        /// @brief Register a component that writes and reads its state field by field.
+        /// @param save Write a component's state
+        /// @param create Add a component read from a record to an object
+        /// @param apply Set an existing component to the state read from a record
+        template <typename T>
+        void registerComponent(
+            std::string_view name,
+            void (*save)(const T&, SnapshotWriter&),
+            T* (*create)(engine::object::GameObject&, engine::core::Context&, SnapshotReader&),
+            void (*apply)(T&, SnapshotReader&)
+        ) {
+            auto type = makeType<T>(name, 0);
+            type.save = [save](std::span<const engine::object::Component* const> components, SnapshotWriter& writer, std::vector<std::uint32_t>& offsets) {
+                std::size_t start = writer.size();
+                for (const auto* component : components) {
+                    offsets.push_back(static_cast<std::uint32_t>(writer.size() - start));
+                    save(*static_cast<const T*>(component), writer);
+                }
+                offsets.push_back(static_cast<std::uint32_t>(writer.size() - start));
+            };
+            type.create = [create](std::span<engine::object::GameObject* const> owners, engine::core::Context& context, const SnapshotColumn& column) {
+                for (std::uint32_t i = 0; i < owners.size(); ++i) {
+                    SnapshotReader reader(column.getRecord(i));
+                    create(*owners[i], context, reader);
+                }
+            };
+            type.apply = [apply](std::span<engine::object::Component* const> components, const SnapshotColumn& column) {
+                for (std::uint32_t i = 0; i < components.size(); ++i) {
+                    SnapshotReader reader(column.getRecord(i));
+                    apply(*static_cast<T*>(components[i]), reader);
+                }
+            };
+            add(std::move(type));
+        }
+
+        /// @brief The registered type of a component, or null. Pointers stay valid.
+        const ComponentType* find(std::type_index type) const;
+        /// @brief The type a snapshot column belongs to, or null.
+        const ComponentType* findById(std::uint32_t id) const;
+
+        std::size_t getTypeCount() const { return types_.size(); }
+        const ComponentType& getType(std::size_t order) const { return *types_[order]; }
+
+    private:
+        std::vector<std::unique_ptr<ComponentType>> types_;
+        std::unordered_map<std::type_index, std::size_t> by_type_;
+        std::unordered_map<std::uint32_t, std::size_t> by_id_;
+
+        template <typename T>
+        static ComponentType makeType(std::string_view name, std::uint32_t record_size) {
+            static_assert(std::is_base_of_v<engine::object::Component, T>, "T must inherit Component");
+            return ComponentType{
+                static_cast<std::uint32_t>(engine::utils::fnv1a64(name.data(), name.size())),
+                std::string(name),
+                std::type_index(typeid(T)),
+                record_size,
+                0,
+                [](const engine::object::GameObject& game_object) -> engine::object::Component* {
+                    return game_object.getComponent<T>();
+                },
+                {},
+                {},
+                {},
+            };
+        }
+
+        void add(ComponentType type);
+        void registerEngineComponents();
+    };
+
+} // namespace engine::scene
+
+#endif // COMPONENT_REGISTRY_HPP_
@@ -0,0 +1,111 @@
+#include "game_object_index.hpp"
+#include "../object/game_object.hpp"
+#include <spdlog/spdlog.h>
+
+namespace engine::scene {
+
+    GameObjectIndex::~GameObjectIndex() {
+        // Objects outliving the index must not report back to it
+        for (auto& [name_id, objects] : by_name_) {
+            for (auto* game_object : objects) {
+                game_object->index_ = nullptr;
+            }
+        }
+    }
+
+    void GameObjectIndex::add(engine::object::GameObject& game_object) {
+        if (game_object.index_) {
+            spdlog::warn("GameObject '{}' is already indexed by a scene.", game_object.getName());
+            return;
+        }
+
+        insert(by_name_, game_object.name_id_, game_object, &engine::object::GameObject::name_slot_);
+        insert(by_tag_, game_object.tag_id_, game_object, &engine::object::GameObject::tag_slot_);
+        game_object.index_ = this;
+    }
+
+    void GameObjectIndex::remove(engine::object::GameObject& game_object) {
+        if (game_object.index_ != this) {
+            return;
+        }
+
+        erase(by_name_, game_object.name_id_, game_object, &engine::object::GameObject::name_slot_);
+        erase(by_tag_, game_object.tag_id_, game_object, &engine::object::GameObject::tag_slot_);
+        game_object.index_ = nullptr;
+    }
+
+    std::span<engine::object::GameObject* const> GameObjectIndex::findByName(engine::utils::StringId name_id) const {
+        return find(by_name_, name_id);
+    }
+
+    std::span<engine::object::GameObject* const> GameObjectIndex::findByTag(engine::utils::StringId tag_id) const {
+        return find(by_tag_, tag_id);
+    }
+
+    std::span<engine::object::GameObject* const> GameObjectIndex::findByName(std::string_view name) const {
+        return find(by_name_, engine::utils::StringInterner::shared().find(name));
+    }
+
+    std::span<engine::object::GameObject* const> GameObjectIndex::findByTag(std::string_view tag) const {
+        return find(by_tag_, engine::utils::StringInterner::shared().find(tag));
+    }
+
+    void GameObjectIndex::rename(engine::object::GameObject& game_object, engine::utils::StringId name_id) {
+        if (name_id == game_object.name_id_) {
+            return;
+        }
+
+        erase(by_name_, game_object.name_id_, game_object, &engine::object::GameObject::name_slot_);
+        game_object.name_id_ = name_id;
+        insert(by_name_, name_id, game_object, &engine::object::GameObject::name_slot_);
+    }
+
+    void GameObjectIndex::retag(engine::object::GameObject& game_object, engine::utils::StringId tag_id) {
+        if (tag_id == game_object.tag_id_) {
+            return;
+        }
+
+        erase(by_tag_, game_object.tag_id_, game_object, &engine::object::GameObject::tag_slot_);
+        game_object.tag_id_ = tag_id;
+        insert(by_tag_, tag_id, game_object, &engine::object::GameObject::tag_slot_);
+    }
+
+    void GameObjectIndex::insert(
+        Lists& lists,
+        engine::utils::StringId id,
+        engine::object::GameObject& game_object,
+        std::uint32_t engine::object::GameObject::* slot
+    ) {
+        auto& objects = lists[id];
+        game_object.*slot = static_cast<std::uint32_t>(objects.size());
+        objects.push_back(&game_object);
+    }
+
+    void GameObjectIndex::erase(
+        Lists& lists,
+        engine::utils::StringId id,
+        engine::object::GameObject& game_object,
+        std::uint32_t engine::object::GameObject::* slot
+    ) {
+        auto it = lists.find(id);
+        if (it == lists.end()) {
+            return;
+        }
+
+        // Swap-and-pop; emptied lists are kept, as their name or tag usually comes back
+        auto& objects = it->second;
+        engine::object::GameObject* last = objects.back();
+        objects[game_object.*slot] = last;
+        last->*slot = game_object.*slot;
+        objects.pop_back();
+    }
+
+    std::span<engine::object::GameObject* const> GameObjectIndex::find(const Lists& lists, engine::utils::StringId id) {
+        auto it = lists.find(id);
+        if (it == lists.end()) {
+            return {};
+        }
+        return it->second;
+    }
+
+} // namespace engine::scene
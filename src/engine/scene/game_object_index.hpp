@@ -0,0 +1,74 @@
+#ifndef GAME_OBJECT_INDEX_HPP_
+#define GAME_OBJECT_INDEX_HPP_
+
+#include "../utils/string_interner.hpp"
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace engine::object {
+    class GameObject;
+}
+
+namespace engine::scene {
+
+    /**
+     * @brief The GameObjects of a scene by interned name and by interned tag.
+     *
+     * Each name and each tag has a dense list of objects. Objects remember their position
+     * in both lists, so adding, removing, renaming and retagging are O(1) (removal moves
+     * the last object of a list into the freed position), and queries return the lists
+     * themselves as spans. A span is invalidated by the next change to the index.
+     */
+    class GameObjectIndex final {
+        friend class engine::object::GameObject;
+
+    public:
+        GameObjectIndex() = default;
+        ~GameObjectIndex();
+
+        GameObjectIndex(const GameObjectIndex&) = delete;
+        GameObjectIndex& operator=(const GameObjectIndex&) = delete;
+        GameObjectIndex(GameObjectIndex&&) = delete;
+        GameObjectIndex& operator=(GameObjectIndex&&) = delete;
+
+        void add(engine::object::GameObject& game_object);
+        void remove(engine::object::GameObject& game_object);
+
+        std::span<engine::object::GameObject* const> findByName(engine::utils::StringId name_id) const;
+        std::span<engine::object::GameObject* const> findByTag(engine::utils::StringId tag_id) const;
+
+        /// @brief Queries by string; a string no object ever had is not interned.
+        std::span<engine::object::GameObject* const> findByName(std::string_view name) const;
+        std::span<engine::object::GameObject* const> findByTag(std::string_view tag) const;
+
+    private:
+        using Lists = std::unordered_map<engine::utils::StringId, std::vector<engine::object::GameObject*>>;
+
+        Lists by_name_;
+        Lists by_tag_;
+
+        /// @brief Called by GameObject::setName/setTag on an indexed object.
+        void rename(engine::object::GameObject& game_object, engine::utils::StringId name_id);
+        void retag(engine::object::GameObject& game_object, engine::utils::StringId tag_id);
+
+        static void insert(
+            Lists& lists,
+            engine::utils::StringId id,
+            engine::object::GameObject& game_object,
+            std::uint32_t engine::object::GameObject::* slot
+        );
+        static void erase(
+            Lists& lists,
+            engine::utils::StringId id,
+            engine::object::GameObject& game_object,
+            std::uint32_t engine::object::GameObject::* slot
+        );
+        static std::span<engine::object::GameObject* const> find(const Lists& lists, engine::utils::StringId id);
+    };
+
+} // namespace engine::scene
+
+#endif // GAME_OBJECT_INDEX_HPP_
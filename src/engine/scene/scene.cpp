@@ -1,12 +1,21 @@
 #include "scene.hpp"
 #include "scene_manager.hpp"
+#include "game_object_index.hpp"
+#include "scene_snapshot.hpp"
 #include "../object/game_object.hpp"
+#include "../object/components/sprite_component.hpp"
+#include "../object/components/transform_component.hpp"
 #include "../core/context.hpp"
-// #include "../core/game_state.hpp"
-// #include "../physics/physics_engine.hpp"
-// #include "../render/camera.hpp"
+#include "../core/game_state.hpp"
+#include "../physics/physics_engine.hpp"
+#include "../render/camera.hpp"
+#include "../render/sprite_index.hpp"
+#include "../resource/resource_manager.hpp"
+#include "../resource/resource_scope.hpp"
 #include "../ui/ui_manager.hpp"
-#include <algorithm>  // for std::remove_if
+#include "../ui/ui_panel.hpp"
+#include "../utils/frame_arena.hpp"
+#include <algorithm>
 #include <spdlog/spdlog.h>
 
 namespace engine::scene {
@@ -20,6 +29,9 @@ namespace engine::scene {
         , context_(context)
         , scene_manager_(scene_manager)
         , ui_manager_(std::make_unique<engine::ui::UIManager>())
+        , sprite_index_(std::make_unique<engine::render::SpriteIndex>())
+        , game_object_index_(std::make_unique<engine::scene::GameObjectIndex>())
+        , resource_scope_(std::make_unique<engine::resource::ResourceScope>(name))
         , is_initialized_(false)
     {}
 
@@ -35,18 +47,23 @@ namespace engine::scene {
             return;
         }
 
-        bool need_remove = false;
+        // Bodies move before the objects update, so they react to this frame's contacts
+        if (!context_.getGameState().isInPaused()) {
+            context_.getPhysicsEngine().update(delta_time);
+        }
+
+        context_.getCamera().update(delta_time);
+
         for (auto& obj : game_objects_) {
-            if (!obj) {
-                need_remove = true;
-                continue;
+            if (obj && !obj->isNeedRemove()) {
+                obj->update(delta_time, context_);
             }
-
-            // TODO GameObject
         }
 
         ui_manager_->update(delta_time, context_);
 
+        // Frame end: objects marked this frame leave, objects spawned this frame join
+        processPendingRemovals();
         processPendingAdditions();
     }
 
@@ -55,8 +72,18 @@ namespace engine::scene {
             return;
         }
 
+        // Objects drawing themselves (tilemaps, backgrounds) go underneath world sprites
         for (const auto& obj : game_objects_) {
-            // TODO GameObject
+            if (obj) {
+                obj->render(context_);
+            }
+        }
+
+        // Only sprites overlapping the viewport are submitted; the list lives in the frame arena
+        std::pmr::vector<engine::object::components::SpriteComponent*> visible_sprites(&context_.getFrameArena());
+        sprite_index_->collectVisible(context_.getCamera(), visible_sprites);
+        for (const auto* sprite : visible_sprites) {
+            sprite->draw(context_);
         }
 
         ui_manager_->render(context_);
@@ -72,7 +99,9 @@ namespace engine::scene {
         }
 
         for (auto& obj : game_objects_) {
-            // TODO GameObject
+            if (obj) {
+                obj->handleInput(context_);
+            }
         }
     }
 
@@ -82,30 +111,192 @@ namespace engine::scene {
         }
 
         for (const auto& obj : game_objects_) {
-            // TODO GameObject
+            if (obj) {
+                obj->clean();
+            }
         }
 
         game_objects_.clear();
+        pending_additions_.clear();
+
+        // Unreferenced resources are unloaded at the end of the frame, after the next
+        // scene (if any) has had the chance to acquire the ones it shares with this one
+        context_.getResourceManager().releaseScope(*resource_scope_);
 
         is_initialized_ = false;
     }
 
-    void Scene::addGameObject(std::unique_ptr<engine::object::GameObject>&& game_object) {}
+    void Scene::addGameObject(std::unique_ptr<engine::object::GameObject>&& game_object) {
+        if (!game_object) {
+            spdlog::warn("Tried adding an empty GameObject to scene '{}'.", scene_name_);
+            return;
+        }
+
+        registerGameObject(*game_object);
+        game_objects_.push_back(std::move(game_object));
+    }
+
+    void Scene::safeAddGameObject(std::unique_ptr<engine::object::GameObject>&& game_object) {
+        if (!game_object) {
+            spdlog::warn("Tried adding an empty GameObject to scene '{}'.", scene_name_);
+            return;
+        }
+
+        pending_additions_.push_back(std::move(game_object));
+    }
 
-    void Scene::safeAddGameObject(std::unique_ptr<engine::object::GameObject>&& game_object) {}
+    void Scene::removeGameObject(engine::object::GameObject* game_object_ptr) {
+        auto it = std::find_if(game_objects_.begin(), game_objects_.end(), [game_object_ptr](const auto& obj) {
+            return obj.get() == game_object_ptr;
+        });
+        if (it == game_objects_.end()) {
+            spdlog::warn("Tried removing a GameObject that is not in scene '{}'.", scene_name_);
+            return;
+        }
 
-    void Scene::removeGameObject(engine::object::GameObject* game_object_ptr) {}
+        game_object_index_->remove(**it);
+        (*it)->clean();
+        game_objects_.erase(it);
+    }
 
-    void Scene::safeRemoveGameObject(engine::object::GameObject* game_object_ptr) {}
+    void Scene::safeRemoveGameObject(engine::object::GameObject* game_object_ptr) {
+        if (game_object_ptr) {
+            game_object_ptr->setNeedRemove(true);
+        }
+    }
 
     const engine::object::GameObject* Scene::findGameObjectByName(std::string_view name) const {
-        // for (const auto& obj : game_objects_) {
-        //     if (obj && obj->getName() == name) {
-        //         return obj.get();
-        //     }
-        // }
+        for (const auto* obj : game_object_index_->findByName(name)) {
+            if (!obj->isNeedRemove()) {
+                return obj;
+            }
+        }
         return nullptr;
     }
 
-    void Scene::processPendingAdditions() {}
+    std::span<engine::object::GameObject* const> Scene::findGameObjectsByName(std::string_view name) const {
+        return game_object_index_->findByName(name);
+    }
+
+    std::span<engine::object::GameObject* const> Scene::findGameObjectsByTag(std::string_view tag) const {
+        return game_object_index_->findByTag(tag);
+    }
+
+    std::uint64_t Scene::computeStateHash(std::uint64_t seed) const {
+        return hashTransforms(game_objects_, seed);
+    }
+
+    std::uint64_t Scene::hashTransforms(
+        std::span<const std::unique_ptr<engine::object::GameObject>> game_objects,
+        std::uint64_t seed
+    ) {
+        std::uint64_t hash = seed;
+        std::uint64_t transform_count = 0;
+        for (const auto& obj : game_objects) {
+            if (!obj) {
+                continue;
+            }
+
+            const auto* transform = obj->getComponent<engine::object::components::TransformComponent>();
+            if (!transform) {
+                continue;
+            }
+
+            // Packed field by field: the hash must not see padding bytes
+            const float state[5] = {
+                transform->position_.x,
+                transform->position_.y,
+                transform->scale_.x,
+                transform->scale_.y,
+                transform->rotation_,
+            };
+            hash = engine::utils::fnv1a64(state, sizeof(state), hash);
+            ++transform_count;
+        }
+
+        // Objects appearing or vanishing change the hash even when they sit at the origin
+        return engine::utils::fnv1a64(&transform_count, sizeof(transform_count), hash);
+    }
+
+    SceneSnapshot Scene::saveSnapshot() const {
+        return SceneSnapshot::capture(game_objects_, ui_manager_->getRootElement());
+    }
+
+    bool Scene::restoreSnapshot(const SceneSnapshot& snapshot, bool restore_ui) {
+        if (snapshot.getKind() == SceneSnapshot::Kind::DELTA) {
+            if (!snapshot.apply(game_objects_)) {
+                return false;
+            }
+        } else {
+            for (auto& obj : game_objects_) {
+                if (obj) {
+                    game_object_index_->remove(*obj);
+                    obj->clean();
+                }
+            }
+            game_objects_.clear();
+            pending_additions_.clear();
+
+            game_objects_ = snapshot.instantiate(context_);
+            for (const auto& obj : game_objects_) {
+                registerGameObject(*obj);
+            }
+        }
+
+        if (restore_ui) {
+            snapshot.restoreUI(*ui_manager_->getRootElement(), context_);
+        }
+        return true;
+    }
+
+    bool Scene::restore(const SceneSnapshot& snapshot) {
+        if (!restoreSnapshot(snapshot)) {
+            return false;
+        }
+
+        Scene::init();
+        return true;
+    }
+
+    void Scene::processPendingAdditions() {
+        if (pending_additions_.empty()) {
+            return;
+        }
+
+        game_objects_.reserve(game_objects_.size() + pending_additions_.size());
+        for (auto& obj : pending_additions_) {
+            registerGameObject(*obj);
+            game_objects_.push_back(std::move(obj));
+        }
+        pending_additions_.clear();
+    }
+
+    void Scene::processPendingRemovals() {
+        // Stable compaction: survivors keep their relative (update and draw) order
+        auto kept = game_objects_.begin();
+        for (auto it = game_objects_.begin(); it != game_objects_.end(); ++it) {
+            if (*it && !(*it)->isNeedRemove()) {
+                if (kept != it) {
+                    *kept = std::move(*it);
+                }
+                ++kept;
+                continue;
+            }
+
+            if (*it) {
+                game_object_index_->remove(**it);
+                (*it)->clean();
+                it->reset();
+            }
+        }
+        game_objects_.erase(kept, game_objects_.end());
+    }
+
+    void Scene::registerGameObject(engine::object::GameObject& game_object) {
+        if (auto* sprite = game_object.getComponent<engine::object::components::SpriteComponent>()) {
+            sprite_index_->add(sprite);
+        }
+
+        game_object_index_->add(game_object);
+    }
 }
@@ -1,7 +1,10 @@
 #ifndef SCENE_HPP_
 #define SCENE_HPP_
+#include "../utils/hash.hpp"
+#include <cstdint>
 #include <vector>
 #include <memory>
+#include <span>
 #include <string>
 #include <string_view>
 
@@ -17,8 +20,22 @@ namespace engine::object {
     class GameObject;
 }
 
+namespace engine::object::components {
+    class SpriteComponent;
+}
+
+namespace engine::render {
+    class SpriteIndex;
+}
+
+namespace engine::resource {
+    class ResourceScope;
+}
+
 namespace engine::scene {
     class SceneManager;
+    class GameObjectIndex;
+    class SceneSnapshot;
 
     class Scene {
     public:
@@ -53,7 +70,8 @@ namespace engine::scene {
         /// @param game_object
         virtual void addGameObject(std::unique_ptr<engine::object::GameObject>&& game_object);
 
-        /// @brief Safely add GameObject to the scene (adding to pending_additions_).
+        /// @brief Safely add GameObject to the scene (adding to pending_additions_). Pending
+        /// objects join the scene together at the end of the scene's update.
         /// @param game_object
         virtual void safeAddGameObject(std::unique_ptr<engine::object::GameObject>&& game_object);
 
@@ -62,17 +80,70 @@ namespace engine::scene {
         /// @param game_object_ptr
         virtual void removeGameObject(engine::object::GameObject* game_object_ptr);
 
-        /// @brief Safely remove GameObject (set need_remove_marker).
+        /// @brief Safely remove GameObject (set need_remove_marker). All marked objects are
+        /// removed together by one compaction pass at the end of the scene's update.
         /// @param game_object_ptr
         virtual void safeRemoveGameObject(engine::object::GameObject* game_object_ptr);
 
         /// @brief Get the GameObject container in the scene.
         const std::vector<std::unique_ptr<engine::object::GameObject>>& getGameObjects() const { return game_objects_; }
 
+        /// @brief Get the spatial index used to cull the scene's world sprites.
+        engine::render::SpriteIndex& getSpriteIndex() const { return *sprite_index_; }
+
         /// @brief Finds a GameObject by name (returns the first object found).
         /// @param name
         const engine::object::GameObject* findGameObjectByName(std::string_view name) const;
 
+        /// @brief All objects of the scene with this name. Invalidated when objects are
+        /// added, removed, renamed or retagged.
+        std::span<engine::object::GameObject* const> findGameObjectsByName(std::string_view name) const;
+
+        /// @brief All objects of the scene with this tag. Invalidated when objects are
+        /// added, removed, renamed or retagged.
+        std::span<engine::object::GameObject* const> findGameObjectsByTag(std::string_view tag) const;
+
+        /// @brief Hash of every object's TransformComponent (position, scale, rotation), in
+        /// update order. Runs that step identically hash identically tick for tick, so two
+        /// runs can be diffed by their hashes.
+        /// @param seed A previous hash, to chain several scenes into one value
+        std::uint64_t computeStateHash(std::uint64_t seed = engine::utils::FNV1A_OFFSET_BASIS) const;
+
+        /// @brief computeStateHash() over any list of objects, e.g. ones kept outside a scene.
+        static std::uint64_t hashTransforms(
+            std::span<const std::unique_ptr<engine::object::GameObject>> game_objects,
+            std::uint64_t seed = engine::utils::FNV1A_OFFSET_BASIS
+        );
+
+        /// @brief Snapshot of the scene's objects and UI tree (see SceneSnapshot).
+        engine::scene::SceneSnapshot saveSnapshot() const;
+
+        /// @brief Bring the scene to a snapshot's state. A full snapshot replaces the scene's
+        /// objects (and, with `restore_ui`, its UI tree); a delta updates them in place.
+        /// @return False if a delta does not match the scene's objects.
+        bool restoreSnapshot(const engine::scene::SceneSnapshot& snapshot, bool restore_ui = true);
+
+        /// @brief Initialize the scene from a snapshot of an earlier visit instead of init().
+        /// The default restores the snapshot and marks the scene initialized. Only scenes
+        /// that enable snapshot caching are restored; those whose init() does more than add
+        /// objects (interactive UI, level maps, pointers to their objects) override this to
+        /// redo that part.
+        /// @return False, leaving the scene uninitialized, if the snapshot did not apply;
+        /// the SceneManager then calls init().
+        virtual bool restore(const engine::scene::SceneSnapshot& snapshot);
+
+        /// @brief Whether the SceneManager keeps a snapshot of this scene when it is
+        /// replaced, and restores the next scene of the same name from it. Off by default:
+        /// enable it in scenes whose restore() rebuilds everything init() sets up.
+        void setSnapshotCaching(bool enabled) { snapshot_caching_ = enabled; }
+        bool isSnapshotCaching() const { return snapshot_caching_; }
+
+        /// @brief Get the name and tag index of the scene's objects.
+        engine::scene::GameObjectIndex& getGameObjectIndex() const { return *game_object_index_; }
+
+        /// @brief Get the resources held by this scene; released when the scene is cleaned.
+        engine::resource::ResourceScope& getResourceScope() const { return *resource_scope_; }
+
         void setName(std::string_view name) { scene_name_ = name; }
         std::string_view getName() const { return scene_name_; }
         void setInitialized(bool initialized) { is_initialized_ = initialized; }
@@ -89,11 +160,26 @@ namespace engine::scene {
         //
         std::unique_ptr<engine::ui::UIManager> ui_manager_;
 
+        /// @brief Spatial index over the world sprites of this scene.
+        std::unique_ptr<engine::render::SpriteIndex> sprite_index_;
+
+        /// @brief The scene's objects by name and by tag.
+        std::unique_ptr<engine::scene::GameObjectIndex> game_object_index_;
+
+        /// @brief Textures, sounds and fonts acquired while this scene was active.
+        std::unique_ptr<engine::resource::ResourceScope> resource_scope_;
+
         bool is_initialized_ = false;
+        bool snapshot_caching_ = false;
         std::vector<std::unique_ptr<engine::object::GameObject>> game_objects_;
         std::vector<std::unique_ptr<engine::object::GameObject>> pending_additions_;
 
         void processPendingAdditions();
+        /// @brief Remove every object marked with setNeedRemove() in one stable pass.
+        void processPendingRemovals();
+
+        /// @brief Add an object to the scene's indexes (names, sprites).
+        void registerGameObject(engine::object::GameObject& game_object);
 
     };
 
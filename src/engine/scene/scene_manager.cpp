@@ -1,10 +1,41 @@
 #include "scene_manager.hpp"
 #include "scene.hpp"
 #include "../core/context.hpp"
+#include "../resource/resource_manager.hpp"
+#include "../utils/hash.hpp"
 #include <spdlog/spdlog.h>
 
 namespace engine::scene {
 
+    namespace {
+
+        /// @brief Attributes resources acquired during a scene callback, rendering included,
+        /// to that scene.
+        class ActiveScope final {
+        public:
+            ActiveScope(engine::resource::ResourceManager& resource_manager, Scene& scene)
+                : resource_manager_(resource_manager)
+                , previous_(resource_manager.getActiveScope())
+            {
+                resource_manager_.setActiveScope(&scene.getResourceScope());
+            }
+
+            ~ActiveScope() {
+                resource_manager_.setActiveScope(previous_);
+            }
+
+            ActiveScope(const ActiveScope&) = delete;
+            ActiveScope& operator=(const ActiveScope&) = delete;
+            ActiveScope(ActiveScope&&) = delete;
+            ActiveScope& operator=(ActiveScope&&) = delete;
+
+        private:
+            engine::resource::ResourceManager& resource_manager_;
+            engine::resource::ResourceScope* previous_;
+        };
+
+    } // namespace
+
     SceneManager::SceneManager(engine::core::Context& context) : context_(context) {}
 
     SceneManager::~SceneManager() {
@@ -19,10 +50,21 @@ namespace engine::scene {
         return scene_stack_.back().get();
     }
 
+    std::uint64_t SceneManager::computeStateHash() const {
+        std::uint64_t hash = engine::utils::FNV1A_OFFSET_BASIS;
+        for (const auto& scene : scene_stack_) {
+            if (scene) {
+                hash = scene->computeStateHash(hash);
+            }
+        }
+        return hash;
+    }
+
     void SceneManager::update(float delta_time) {
         // Update logic only for the top of the scene stack
         Scene* current_scene = getCurrentScene();
         if (current_scene) {
+            ActiveScope scope(context_.getResourceManager(), *current_scene);
             current_scene->update(delta_time);
         }
 
@@ -33,6 +75,8 @@ namespace engine::scene {
         // Render all scenes in the scene stack, not just the topmost scene
         for (const auto& scene : scene_stack_) {
             if (scene) {
+                // Textures first requested while drawing belong to the scene drawing them
+                ActiveScope scope(context_.getResourceManager(), *scene);
                 scene->render();
             }
         }
@@ -41,6 +85,7 @@ namespace engine::scene {
     void SceneManager::handleInput() {
         Scene* current_scene = getCurrentScene();
         if (current_scene) {
+            ActiveScope scope(context_.getResourceManager(), *current_scene);
             current_scene->handleInput();
         }
     }
@@ -99,6 +144,7 @@ namespace engine::scene {
         }
 
         if (!scene->isInitialized()) {
+            ActiveScope scope(context_.getResourceManager(), *scene);
             scene->init();
         }
 
@@ -124,6 +170,7 @@ namespace engine::scene {
 
         while (!scene_stack_.empty()) {
             if (scene_stack_.back()) {
+                cacheSnapshot(*scene_stack_.back());
                 scene_stack_.back()->clean();
             }
 
@@ -131,9 +178,46 @@ namespace engine::scene {
         }
 
         if (!scene->isInitialized()) {
-            scene->init();
+            ActiveScope scope(context_.getResourceManager(), *scene);
+            auto snapshot = scene->isSnapshotCaching() ? takeSnapshot(scene->getName()) : nullptr;
+            if (!snapshot || !scene->restore(*snapshot)) {
+                if (snapshot) {
+                    spdlog::warn("Scene '{}' could not be restored from its snapshot; initializing it.", scene->getName());
+                }
+                scene->init();
+            }
         }
 
         scene_stack_.push_back(std::move(scene));
     }
+
+    void SceneManager::cacheSnapshot(const Scene& scene) {
+        if (!scene.isSnapshotCaching() || !scene.isInitialized()) {
+            return;
+        }
+
+        auto snapshot = scene.saveSnapshot();
+        // A scene restored without some of its components would not be the one left
+        if (!snapshot.hasAllComponents()) {
+            spdlog::debug("Scene '{}' is not cached: some of its components cannot be snapshotted.", scene.getName());
+            return;
+        }
+
+        takeSnapshot(scene.getName());
+        snapshot_cache_.emplace_front(std::string(scene.getName()), std::move(snapshot));
+        if (snapshot_cache_.size() > SNAPSHOT_CACHE_CAPACITY) {
+            snapshot_cache_.pop_back();
+        }
+    }
+
+    std::unique_ptr<SceneSnapshot> SceneManager::takeSnapshot(std::string_view scene_name) {
+        for (auto it = snapshot_cache_.begin(); it != snapshot_cache_.end(); ++it) {
+            if (it->first == scene_name) {
+                auto snapshot = std::make_unique<SceneSnapshot>(std::move(it->second));
+                snapshot_cache_.erase(it);
+                return snapshot;
+            }
+        }
+        return nullptr;
+    }
 }
@@ -1,7 +1,13 @@
 #ifndef SCENE_MANAGER_HPP_
 #define SCENE_MANAGER_HPP_
+#include "scene_snapshot.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <list>
 #include <memory>
 #include <string>
+#include <string_view>
+#include <utility>
 #include <vector>
 
 namespace engine::core {
@@ -23,11 +29,20 @@ namespace engine::scene {
 
         void requestPushScene(std::unique_ptr<Scene>&& scene);
         void requestPopScene();
+        /// @brief Replace the whole stack by `scene`. Replaced scenes with snapshot caching
+        /// on are snapshotted; if one of them had the same name as `scene`, it is restored
+        /// from that snapshot (Scene::restore()) instead of being initialized again.
         void requestReplaceScene(std::unique_ptr<Scene>&& scene);
 
         Scene* getCurrentScene() const;
         engine::core::Context& getContext() const { return context_; }
 
+        /// @brief Drop the cached snapshots, e.g. after the game state they show is reset.
+        void clearSnapshotCache() { snapshot_cache_.clear(); }
+
+        /// @brief Scene::computeStateHash() of every scene of the stack, bottom to top.
+        std::uint64_t computeStateHash() const;
+
         void update(float delta_time);
         void render();
         void handleInput();
@@ -41,11 +56,19 @@ namespace engine::scene {
         PendingAction pending_action_ = PendingAction::None;
         std::unique_ptr<Scene> pending_scene_;
 
+        /// @brief Snapshots of replaced scenes by scene name, most recently replaced first.
+        static constexpr std::size_t SNAPSHOT_CACHE_CAPACITY = 4;
+        std::list<std::pair<std::string, SceneSnapshot>> snapshot_cache_;
+
         void processPendingActions();
         void pushScene(std::unique_ptr<Scene>&& scene);
         void popScene();
         void replaceScene(std::unique_ptr<Scene>&& scene);
 
+        void cacheSnapshot(const Scene& scene);
+        /// @brief Take the cached snapshot of a scene name out of the cache, or null.
+        std::unique_ptr<SceneSnapshot> takeSnapshot(std::string_view scene_name);
+
     };
 }
 
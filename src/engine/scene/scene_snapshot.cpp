@@ -0,0 +1,695 @@
+#include "scene_snapshot.hpp"
+#include "component_registry.hpp"
+#include "../core/context.hpp"
+#include "../object/game_object.hpp"
+#include "../render/text_renderer.hpp"
+#include "../ui/ui_element.hpp"
+#include "../ui/ui_interactive.hpp"
+#include "../ui/ui_label.hpp"
+#include "../ui/ui_panel.hpp"
+#include "../utils/hash.hpp"
+#include "../utils/string_interner.hpp"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <optional>
+#include <spdlog/spdlog.h>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+
+namespace engine::scene {
+
+    using Format = SceneSnapshotFormat;
+
+    namespace {
+
+        constexpr std::size_t SNAPSHOT_ALIGNMENT = 4;
+
+        Format::Header makeSnapshotHeader(Format::Kind kind) {
+            Format::Header header = {};
+            std::copy(std::begin(Format::MAGIC), std::end(Format::MAGIC), header.magic);
+            header.version = Format::VERSION;
+            header.kind = kind;
+            return header;
+        }
+
+        /// @brief Write a column's parts after its header; `records` are written by `write_records`.
+        template <typename WriteRecords>
+        void writeColumn(
+            SnapshotWriter& writer,
+            std::uint32_t type_id,
+            std::uint32_t record_size,
+            std::span<const std::uint32_t> owners,
+            WriteRecords&& write_records
+        ) {
+            std::size_t header_offset = writer.size();
+            Format::ColumnHeader column_header = {type_id, record_size, static_cast<std::uint32_t>(owners.size()), 0};
+            writer.write(column_header);
+            writer.writeBytes(owners.data(), owners.size_bytes());
+
+            // Variable-size records: the offset table goes first, filled once the records are written
+            std::size_t offsets_offset = writer.size();
+            if (record_size == 0) {
+                writer.grow((owners.size() + 1) * sizeof(std::uint32_t));
+            }
+
+            std::size_t records_offset = writer.size();
+            std::vector<std::uint32_t> offsets;
+            write_records(offsets);
+
+            if (record_size == 0) {
+                writer.patch(offsets_offset, offsets.data(), offsets.size() * sizeof(std::uint32_t));
+            }
+
+            column_header.data_size = static_cast<std::uint32_t>(writer.size() - records_offset);
+            writer.patch(header_offset, &column_header, sizeof(column_header));
+            writer.align(SNAPSHOT_ALIGNMENT);
+        }
+
+        /// @brief Copy records of `column` into a new column; `pick(i)` gives the record to write for record i.
+        template <typename Pick>
+        void writeRecords(SnapshotWriter& writer, std::uint32_t record_size, std::uint32_t count, std::vector<std::uint32_t>& offsets, Pick&& pick) {
+            std::size_t start = writer.size();
+            for (std::uint32_t i = 0; i < count; ++i) {
+                if (record_size == 0) {
+                    offsets.push_back(static_cast<std::uint32_t>(writer.size() - start));
+                }
+                auto record = pick(i);
+                writer.writeBytes(record.data(), record.size());
+            }
+            if (record_size == 0) {
+                offsets.push_back(static_cast<std::uint32_t>(writer.size() - start));
+            }
+        }
+
+        bool sameBytes(std::span<const std::byte> a, std::span<const std::byte> b) {
+            return a.size() == b.size() && (a.empty() || std::memcmp(a.data(), b.data(), a.size()) == 0);
+        }
+
+        // --- UI tree ---
+
+        /// @brief Write `element` and its children depth first; returns the elements written.
+        std::uint32_t writeUIElement(SnapshotWriter& writer, const engine::ui::UIElement& element, bool& partial) {
+            // Interactive elements call back into code, which a snapshot cannot hold
+            if (dynamic_cast<const engine::ui::UIInteractive*>(&element)) {
+                partial = true;
+                return 0;
+            }
+
+            const auto* panel = dynamic_cast<const engine::ui::UIPanel*>(&element);
+            const auto* label = dynamic_cast<const engine::ui::UILabel*>(&element);
+
+            Format::UIElementRecord record = {};
+            record.kind = panel ? Format::UIElementKind::PANEL : label ? Format::UIElementKind::LABEL : Format::UIElementKind::ELEMENT;
+            record.visible = element.isVisible();
+            record.position[0] = element.getPosition().x;
+            record.position[1] = element.getPosition().y;
+            record.size[0] = element.getSize().x;
+            record.size[1] = element.getSize().y;
+
+            std::size_t record_offset = writer.size();
+            writer.write(record);
+
+            if (panel) {
+                const auto& color = panel->getBackgroundColor();
+                writer.write(static_cast<std::uint8_t>(color.has_value()));
+                writer.write(color.value_or(engine::utils::FColor{0.0f, 0.0f, 0.0f, 0.0f}));
+            } else if (label) {
+                writer.writeString(label->getText());
+                writer.writeString(label->getFontId());
+                writer.write(static_cast<std::int32_t>(label->getFontSize()));
+                writer.write(label->getTextFColor());
+            }
+
+            std::uint32_t written = 1;
+            for (const auto& child : element.getChildren()) {
+                std::uint32_t child_written = writeUIElement(writer, *child, partial);
+                record.child_count += child_written > 0 ? 1 : 0;
+                written += child_written;
+            }
+
+            writer.patch(record_offset, &record, sizeof(record));
+            return written;
+        }
+
+        /// @brief Read past a UI tree, checking that its records and child counts add up.
+        void skipUITree(SnapshotReader& reader) {
+            auto element_count = reader.read<std::uint32_t>();
+            std::uint64_t child_total = 0;
+            for (std::uint32_t i = 0; i < element_count; ++i) {
+                auto record = reader.read<Format::UIElementRecord>();
+                switch (record.kind) {
+                    case Format::UIElementKind::PANEL:
+                        reader.read<std::uint8_t>();
+                        reader.read<engine::utils::FColor>();
+                        break;
+                    case Format::UIElementKind::LABEL:
+                        reader.readString();
+                        reader.readString();
+                        reader.read<std::int32_t>();
+                        reader.read<engine::utils::FColor>();
+                        break;
+                    case Format::UIElementKind::ELEMENT:
+                        break;
+                    default:
+                        throw std::runtime_error("SceneSnapshot: unknown UI element kind.");
+                }
+                child_total += record.child_count;
+            }
+
+            // Every element but the root is the child of one other
+            if (element_count > 0 && child_total != element_count - 1) {
+                throw std::runtime_error("SceneSnapshot: UI tree is inconsistent.");
+            }
+        }
+
+        void applyUIRecord(engine::ui::UIElement& element, const Format::UIElementRecord& record) {
+            element.setPosition({record.position[0], record.position[1]});
+            element.setSize({record.size[0], record.size[1]});
+            element.setVisible(record.visible != 0);
+        }
+
+        std::unique_ptr<engine::ui::UIElement> readUIElement(SnapshotReader& reader, engine::core::Context& context);
+
+        void readUIChildren(SnapshotReader& reader, engine::ui::UIElement& parent, std::uint32_t child_count, engine::core::Context& context) {
+            for (std::uint32_t i = 0; i < child_count; ++i) {
+                parent.addChild(readUIElement(reader, context));
+            }
+        }
+
+        std::unique_ptr<engine::ui::UIElement> readUIElement(SnapshotReader& reader, engine::core::Context& context) {
+            auto record = reader.read<Format::UIElementRecord>();
+
+            std::unique_ptr<engine::ui::UIElement> element;
+            switch (record.kind) {
+                case Format::UIElementKind::PANEL: {
+                    auto has_color = reader.read<std::uint8_t>();
+                    auto color = reader.read<engine::utils::FColor>();
+                    auto panel = std::make_unique<engine::ui::UIPanel>();
+                    if (has_color) {
+                        panel->setBackgroundColor(color);
+                    }
+                    element = std::move(panel);
+                    break;
+                }
+                case Format::UIElementKind::LABEL: {
+                    auto text = reader.readString();
+                    auto font_id = reader.readString();
+                    auto font_size = reader.read<std::int32_t>();
+                    auto color = reader.read<engine::utils::FColor>();
+                    element = std::make_unique<engine::ui::UILabel>(context.getTextRenderer(), text, font_id, font_size, color);
+                    break;
+                }
+                case Format::UIElementKind::ELEMENT:
+                    element = std::make_unique<engine::ui::UIElement>();
+                    break;
+                default:
+                    throw std::runtime_error("SceneSnapshot: unknown UI element kind.");
+            }
+
+            applyUIRecord(*element, record);
+            readUIChildren(reader, *element, record.child_count, context);
+            return element;
+        }
+
+    } // namespace
+
+    SceneSnapshot::SceneSnapshot() : SceneSnapshot(capture({}, nullptr)) {}
+
+    SceneSnapshot::SceneSnapshot(std::vector<std::byte> data) : data_(std::move(data)) {
+        parse();
+    }
+
+    SceneSnapshot SceneSnapshot::capture(
+        std::span<const std::unique_ptr<engine::object::GameObject>> game_objects,
+        const engine::ui::UIElement* ui_root
+    ) {
+        const auto& registry = ComponentRegistry::shared();
+        const auto& interner = engine::utils::StringInterner::shared();
+
+        // Gather the components into one column per registered type
+        struct Column {
+            std::vector<const engine::object::Component*> components;
+            std::vector<std::uint32_t> owners;
+        };
+        std::vector<Column> columns(registry.getTypeCount());
+
+        // Objects hold a handful of components of few types; a short list beats hashing
+        std::vector<std::pair<std::type_index, const ComponentRegistry::ComponentType*>> seen_types;
+        auto find_type = [&](std::type_index type) {
+            for (const auto& [seen, registered] : seen_types) {
+                if (seen == type) {
+                    return registered;
+                }
+            }
+            const auto* registered = registry.find(type);
+            seen_types.emplace_back(type, registered);
+            return registered;
+        };
+
+        std::vector<Format::ObjectRecord> objects;
+        objects.reserve(game_objects.size());
+        std::vector<engine::utils::StringId> strings;
+        std::unordered_map<engine::utils::StringId, std::uint32_t> string_indices;
+        auto string_index = [&](engine::utils::StringId id) {
+            auto [it, inserted] = string_indices.try_emplace(id, static_cast<std::uint32_t>(strings.size()));
+            if (inserted) {
+                strings.push_back(id);
+            }
+            return it->second;
+        };
+
+        std::size_t skipped = 0;
+        for (const auto& game_object : game_objects) {
+            if (!game_object) {
+                continue;
+            }
+
+            auto object_index = static_cast<std::uint32_t>(objects.size());
+            objects.push_back({string_index(game_object->getNameId()), string_index(game_object->getTagId())});
+
+            game_object->forEachComponent([&](std::type_index type, const engine::object::Component& component) {
+                const auto* registered = find_type(type);
+                if (!registered) {
+                    ++skipped;
+                    return;
+                }
+                auto& column = columns[registered->order];
+                column.components.push_back(&component);
+                column.owners.push_back(object_index);
+            });
+        }
+
+        std::vector<std::byte> data;
+        SnapshotWriter writer(data);
+        auto header = makeSnapshotHeader(Kind::FULL);
+        if (skipped > 0) {
+            spdlog::warn("{} components of types not registered for snapshots were left out of a scene snapshot.", skipped);
+            header.flags |= Format::COMPONENTS_PARTIAL;
+        }
+        header.object_count = static_cast<std::uint32_t>(objects.size());
+        header.string_count = static_cast<std::uint32_t>(strings.size());
+        writer.write(header);
+
+        std::size_t structure_start = writer.size();
+        for (auto id : strings) {
+            writer.writeString(interner.lookup(id));
+        }
+        writer.align(SNAPSHOT_ALIGNMENT);
+        writer.writeBytes(objects.data(), objects.size() * sizeof(Format::ObjectRecord));
+        std::uint64_t structure_hash = engine::utils::fnv1a64(data.data() + structure_start, data.size() - structure_start);
+
+        for (std::size_t order = 0; order < columns.size(); ++order) {
+            const auto& column = columns[order];
+            if (column.owners.empty()) {
+                continue;
+            }
+
+            const auto& type = registry.getType(order);
+            structure_hash = engine::utils::fnv1a64(&type.id, sizeof(type.id), structure_hash);
+            structure_hash = engine::utils::fnv1a64(column.owners.data(), column.owners.size() * sizeof(std::uint32_t), structure_hash);
+
+            writeColumn(writer, type.id, type.record_size, column.owners, [&](std::vector<std::uint32_t>& offsets) {
+                type.save(column.components, writer, offsets);
+            });
+            ++header.column_count;
+        }
+
+        if (ui_root) {
+            bool partial = false;
+            std::size_t count_offset = writer.size();
+            writer.write(std::uint32_t{0});
+            std::uint32_t element_count = writeUIElement(writer, *ui_root, partial);
+            writer.patch(count_offset, &element_count, sizeof(element_count));
+
+            header.flags |= Format::HAS_UI;
+            if (partial) {
+                header.flags |= Format::UI_PARTIAL;
+            }
+        }
+
+        header.structure_hash = structure_hash;
+        writer.patch(0, &header, sizeof(header));
+        return SceneSnapshot(std::move(data));
+    }
+
+    SceneSnapshot SceneSnapshot::diff(const SceneSnapshot& base, const SceneSnapshot& current) {
+        if (base.getKind() != Kind::FULL || current.getKind() != Kind::FULL) {
+            spdlog::error("Scene snapshot deltas are taken between two full snapshots.");
+            return current;
+        }
+
+        // Different objects: the records cannot be matched up
+        if (base.header_.structure_hash != current.header_.structure_hash
+            || base.header_.object_count != current.header_.object_count
+            || base.columns_.size() != current.columns_.size()) {
+            return current;
+        }
+
+        std::vector<std::byte> data;
+        SnapshotWriter writer(data);
+        auto header = makeSnapshotHeader(Kind::DELTA);
+        header.flags = current.header_.flags & Format::COMPONENTS_PARTIAL;
+        header.object_count = base.header_.object_count;
+        header.column_count = static_cast<std::uint32_t>(current.columns_.size());
+        header.structure_hash = base.header_.structure_hash;
+        writer.write(header);
+
+        std::vector<std::uint32_t> changed;
+        std::vector<std::uint32_t> owners;
+        for (std::size_t c = 0; c < current.columns_.size(); ++c) {
+            SnapshotColumn old_column = base.getColumn(c);
+            SnapshotColumn new_column = current.getColumn(c);
+            if (old_column.getTypeId() != new_column.getTypeId() || old_column.getCount() != new_column.getCount()) {
+                return current;
+            }
+
+            changed.clear();
+            owners.clear();
+            bool fixed_size = new_column.getRecordSize() > 0;
+            if (!fixed_size || !sameBytes(old_column.getRecords(), new_column.getRecords())) {
+                for (std::uint32_t i = 0; i < new_column.getCount(); ++i) {
+                    if (!sameBytes(old_column.getRecord(i), new_column.getRecord(i))) {
+                        changed.push_back(i);
+                        owners.push_back(new_column.getOwner(i));
+                    }
+                }
+            }
+
+            writeColumn(writer, new_column.getTypeId(), new_column.getRecordSize(), owners, [&](std::vector<std::uint32_t>& offsets) {
+                writeRecords(writer, new_column.getRecordSize(), static_cast<std::uint32_t>(changed.size()), offsets, [&](std::uint32_t i) {
+                    return new_column.getRecord(changed[i]);
+                });
+            });
+        }
+
+        // The UI tree is small: it is carried whole when anything in it changed
+        if (current.hasUI() && !(base.hasUI() && sameBytes(base.getUIBytes(), current.getUIBytes()))) {
+            auto ui_bytes = current.getUIBytes();
+            writer.writeBytes(ui_bytes.data(), ui_bytes.size());
+            header.flags |= current.header_.flags & (Format::HAS_UI | Format::UI_PARTIAL);
+        }
+
+        writer.patch(0, &header, sizeof(header));
+        return SceneSnapshot(std::move(data));
+    }
+
+    bool SceneSnapshot::applyDelta(const SceneSnapshot& delta) {
+        if (getKind() != Kind::FULL || delta.getKind() != Kind::DELTA
+            || delta.header_.structure_hash != header_.structure_hash
+            || delta.columns_.size() != columns_.size()) {
+            spdlog::error("Scene snapshot delta does not apply to this snapshot.");
+            return false;
+        }
+
+        // Strings and objects are unchanged; every column is rewritten with the delta's records merged in
+        std::size_t columns_start = columns_.empty() ? ui_offset_ : columns_.front().owners_offset - sizeof(Format::ColumnHeader);
+        std::vector<std::byte> data(data_.begin(), data_.begin() + static_cast<std::ptrdiff_t>(columns_start));
+        SnapshotWriter writer(data);
+
+        for (std::size_t c = 0; c < columns_.size(); ++c) {
+            SnapshotColumn old_column = getColumn(c);
+            SnapshotColumn changes = delta.getColumn(c);
+            if (old_column.getTypeId() != changes.getTypeId()) {
+                spdlog::error("Scene snapshot delta does not apply to this snapshot.");
+                return false;
+            }
+
+            std::vector<std::uint32_t> owners(old_column.getCount());
+            for (std::uint32_t i = 0; i < old_column.getCount(); ++i) {
+                owners[i] = old_column.getOwner(i);
+            }
+
+            // Owners ascend in both columns: walk them side by side
+            std::uint32_t next_change = 0;
+            writeColumn(writer, old_column.getTypeId(), old_column.getRecordSize(), owners, [&](std::vector<std::uint32_t>& offsets) {
+                writeRecords(writer, old_column.getRecordSize(), old_column.getCount(), offsets, [&](std::uint32_t i) {
+                    if (next_change < changes.getCount() && changes.getOwner(next_change) == owners[i]) {
+                        return changes.getRecord(next_change++);
+                    }
+                    return old_column.getRecord(i);
+                });
+            });
+        }
+
+        auto header = header_;
+        if (delta.hasUI()) {
+            auto ui_bytes = delta.getUIBytes();
+            writer.writeBytes(ui_bytes.data(), ui_bytes.size());
+            header.flags &= ~static_cast<std::uint32_t>(Format::HAS_UI | Format::UI_PARTIAL);
+            header.flags |= delta.header_.flags & (Format::HAS_UI | Format::UI_PARTIAL);
+        } else {
+            auto ui_bytes = getUIBytes();
+            writer.writeBytes(ui_bytes.data(), ui_bytes.size());
+        }
+        writer.patch(0, &header, sizeof(header));
+
+        data_ = std::move(data);
+        parse();
+        return true;
+    }
+
+    std::vector<std::unique_ptr<engine::object::GameObject>> SceneSnapshot::instantiate(engine::core::Context& context) const {
+        std::vector<std::unique_ptr<engine::object::GameObject>> game_objects;
+        if (getKind() != Kind::FULL) {
+            spdlog::error("Only full scene snapshots can create objects.");
+            return game_objects;
+        }
+
+        auto strings = readStrings();
+        game_objects.reserve(header_.object_count);
+        for (std::uint32_t i = 0; i < header_.object_count; ++i) {
+            Format::ObjectRecord record;
+            std::memcpy(&record, data_.data() + objects_offset_ + i * sizeof(record), sizeof(record));
+            game_objects.push_back(std::make_unique<engine::object::GameObject>(strings[record.name], strings[record.tag]));
+        }
+
+        const auto& registry = ComponentRegistry::shared();
+        std::vector<engine::object::GameObject*> owners;
+        for (std::size_t c = 0; c < columns_.size(); ++c) {
+            SnapshotColumn column = getColumn(c);
+            const auto* type = registry.findById(column.getTypeId());
+            if (!type) {
+                spdlog::warn("Scene snapshot holds {} components of an unregistered type ({:08x}); skipping them.", column.getCount(), column.getTypeId());
+                continue;
+            }
+
+            owners.resize(column.getCount());
+            for (std::uint32_t i = 0; i < column.getCount(); ++i) {
+                owners[i] = game_objects[column.getOwner(i)].get();
+            }
+            type->create(owners, context, column);
+        }
+
+        return game_objects;
+    }
+
+    bool SceneSnapshot::apply(std::span<const std::unique_ptr<engine::object::GameObject>> game_objects) const {
+        if (game_objects.size() != header_.object_count) {
+            spdlog::error(
+                "Scene snapshot of {} objects cannot be applied to {} objects.",
+                header_.object_count,
+                game_objects.size()
+            );
+            return false;
+        }
+
+        const auto& registry = ComponentRegistry::shared();
+        std::vector<engine::object::Component*> components;
+        for (std::size_t c = 0; c < columns_.size(); ++c) {
+            SnapshotColumn column = getColumn(c);
+            const auto* type = registry.findById(column.getTypeId());
+            if (!type) {
+                continue;
+            }
+
+            components.resize(column.getCount());
+            for (std::uint32_t i = 0; i < column.getCount(); ++i) {
+                const auto& game_object = game_objects[column.getOwner(i)];
+                components[i] = game_object ? type->find(*game_object) : nullptr;
+                if (!components[i]) {
+                    spdlog::error("Scene snapshot expects a '{}' component on object {}.", type->name, column.getOwner(i));
+                    return false;
+                }
+            }
+            type->apply(components, column);
+        }
+
+        return true;
+    }
+
+    void SceneSnapshot::restoreUI(engine::ui::UIElement& root, engine::core::Context& context) const {
+        if (!hasUI()) {
+            return;
+        }
+
+        SnapshotReader reader(getUIBytes());
+        if (reader.read<std::uint32_t>() == 0) {
+            return;
+        }
+
+        auto record = reader.read<Format::UIElementRecord>();
+        if (record.kind == Format::UIElementKind::PANEL) {
+            auto has_color = reader.read<std::uint8_t>();
+            auto color = reader.read<engine::utils::FColor>();
+            if (auto* panel = dynamic_cast<engine::ui::UIPanel*>(&root)) {
+                panel->setBackgroundColor(has_color ? std::optional(color) : std::nullopt);
+            }
+        } else if (record.kind == Format::UIElementKind::LABEL) {
+            throw std::runtime_error("SceneSnapshot: a label cannot be the UI root.");
+        }
+
+        applyUIRecord(root, record);
+        root.removeAllChildren();
+        readUIChildren(reader, root, record.child_count, context);
+    }
+
+    bool SceneSnapshot::saveToFile(std::string_view file_path) const {
+        std::ofstream file{std::string(file_path), std::ios::binary};
+        if (!file) {
+            spdlog::error("Unable to open '{}' to save a scene snapshot.", file_path);
+            return false;
+        }
+
+        file.write(reinterpret_cast<const char*>(data_.data()), static_cast<std::streamsize>(data_.size()));
+        return static_cast<bool>(file);
+    }
+
+    SceneSnapshot SceneSnapshot::loadFromFile(std::string_view file_path) {
+        std::ifstream file{std::string(file_path), std::ios::binary | std::ios::ate};
+        if (!file) {
+            throw std::runtime_error("SceneSnapshot: unable to open '" + std::string(file_path) + "'.");
+        }
+
+        std::vector<std::byte> data(static_cast<std::size_t>(file.tellg()));
+        file.seekg(0);
+        file.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(data.size()));
+        if (!file) {
+            throw std::runtime_error("SceneSnapshot: unable to read '" + std::string(file_path) + "'.");
+        }
+
+        return SceneSnapshot(std::move(data));
+    }
+
+    std::size_t SceneSnapshot::getRecordCount() const {
+        std::size_t count = 0;
+        for (const auto& column : columns_) {
+            count += column.header.count;
+        }
+        return count;
+    }
+
+    void SceneSnapshot::parse() {
+        SnapshotReader reader(data_);
+        header_ = reader.read<Format::Header>();
+        if (!std::equal(std::begin(Format::MAGIC), std::end(Format::MAGIC), header_.magic)) {
+            throw std::runtime_error("SceneSnapshot: data is not a scene snapshot.");
+        }
+        if (header_.version != Format::VERSION) {
+            throw std::runtime_error("SceneSnapshot: unsupported version " + std::to_string(header_.version) + ".");
+        }
+        if (header_.kind != Kind::FULL && header_.kind != Kind::DELTA) {
+            throw std::runtime_error("SceneSnapshot: unknown snapshot kind.");
+        }
+
+        strings_offset_ = reader.getPosition();
+        for (std::uint32_t i = 0; i < header_.string_count; ++i) {
+            reader.readString();
+        }
+        reader.align(SNAPSHOT_ALIGNMENT);
+
+        objects_offset_ = reader.getPosition();
+        if (header_.kind == Kind::FULL) {
+            auto objects = reader.readBytes(static_cast<std::size_t>(header_.object_count) * sizeof(Format::ObjectRecord));
+            for (std::uint32_t i = 0; i < header_.object_count; ++i) {
+                Format::ObjectRecord record;
+                std::memcpy(&record, objects.data() + i * sizeof(record), sizeof(record));
+                if (record.name >= header_.string_count || record.tag >= header_.string_count) {
+                    throw std::runtime_error("SceneSnapshot: object names a missing string.");
+                }
+            }
+        }
+
+        columns_.clear();
+        columns_.reserve(header_.column_count);
+        for (std::uint32_t c = 0; c < header_.column_count; ++c) {
+            ColumnLayout layout = {};
+            layout.header = reader.read<Format::ColumnHeader>();
+            const auto& column_header = layout.header;
+
+            layout.owners_offset = reader.getPosition();
+            reader.readBytes(static_cast<std::size_t>(column_header.count) * sizeof(std::uint32_t));
+
+            layout.offsets_offset = reader.getPosition();
+            if (column_header.record_size == 0) {
+                reader.readBytes((static_cast<std::size_t>(column_header.count) + 1) * sizeof(std::uint32_t));
+            } else if (static_cast<std::size_t>(column_header.count) * column_header.record_size != column_header.data_size) {
+                throw std::runtime_error("SceneSnapshot: column size does not match its records.");
+            }
+
+            layout.records_offset = reader.getPosition();
+            reader.readBytes(column_header.data_size);
+            reader.align(SNAPSHOT_ALIGNMENT);
+            columns_.push_back(layout);
+
+            // Owners must name objects, in ascending order; record offsets must stay in the data
+            SnapshotColumn column = getColumn(columns_.size() - 1);
+            for (std::uint32_t i = 0; i < column_header.count; ++i) {
+                std::uint32_t owner = column.getOwner(i);
+                if (owner >= header_.object_count || (i > 0 && owner <= column.getOwner(i - 1))) {
+                    throw std::runtime_error("SceneSnapshot: column has invalid owners.");
+                }
+            }
+
+            if (column_header.record_size == 0) {
+                std::uint32_t previous = 0;
+                for (std::uint32_t i = 0; i <= column_header.count; ++i) {
+                    std::uint32_t offset;
+                    std::memcpy(&offset, data_.data() + layout.offsets_offset + i * sizeof(offset), sizeof(offset));
+                    if (offset < previous || offset > column_header.data_size) {
+                        throw std::runtime_error("SceneSnapshot: column has invalid record offsets.");
+                    }
+                    previous = offset;
+                }
+            }
+        }
+
+        ui_offset_ = reader.getPosition();
+        if (hasUI()) {
+            skipUITree(reader);
+        }
+        if (reader.getRemaining() > 0) {
+            throw std::runtime_error("SceneSnapshot: unexpected data at the end.");
+        }
+    }
+
+    SnapshotColumn SceneSnapshot::getColumn(std::size_t index) const {
+        const auto& layout = columns_[index];
+        return SnapshotColumn(
+            layout.header.type_id,
+            layout.header.record_size,
+            layout.header.count,
+            data_.data() + layout.owners_offset,
+            data_.data() + layout.offsets_offset,
+            data_.data() + layout.records_offset
+        );
+    }
+
+    std::vector<std::string_view> SceneSnapshot::readStrings() const {
+        std::vector<std::string_view> strings;
+        strings.reserve(header_.string_count);
+
+        SnapshotReader reader(std::span<const std::byte>(data_).subspan(strings_offset_));
+        for (std::uint32_t i = 0; i < header_.string_count; ++i) {
+            strings.push_back(reader.readString());
+        }
+        return strings;
+    }
+
+    std::span<const std::byte> SceneSnapshot::getUIBytes() const {
+        return std::span<const std::byte>(data_).subspan(ui_offset_);
+    }
+
+} // namespace engine::scene
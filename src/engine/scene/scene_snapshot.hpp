@@ -0,0 +1,193 @@
+#ifndef SCENE_SNAPSHOT_HPP_
+#define SCENE_SNAPSHOT_HPP_
+
+#include "snapshot_io.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace engine::core {
+    class Context;
+}
+
+namespace engine::object {
+    class GameObject;
+}
+
+namespace engine::ui {
+    class UIElement;
+}
+
+namespace engine::scene {
+
+    /// @brief Binary layout of a scene snapshot (".ssnp").
+    ///
+    ///   Header                      (40 bytes, see Header)
+    ///   string table                (string_count strings: 32-bit length, then UTF-8)
+    ///   objects                     (object_count ObjectRecords, full snapshots only)
+    ///   columns                     (column_count times: ColumnHeader, 32-bit owner object
+    ///                                indices, an offset table for variable-size records,
+    ///                                then the records; each part padded to 4 bytes)
+    ///   UI tree                     (when HAS_UI: 32-bit element count, then the elements
+    ///                                depth first, see UIElementRecord)
+    ///
+    /// A delta holds the records that changed since its base snapshot, and the UI tree only
+    /// when that changed. It applies to the objects its base was captured from, which the
+    /// structure hash (names, tags and which components each object has) identifies.
+    struct SceneSnapshotFormat {
+        static constexpr char MAGIC[4] = {'S', 'S', 'N', 'P'};
+        static constexpr std::uint32_t VERSION = 1;
+
+        enum class Kind : std::uint32_t {
+            FULL = 0,
+            DELTA = 1,
+        };
+
+        enum Flags : std::uint32_t {
+            HAS_UI = 1 << 0,
+            UI_PARTIAL = 1 << 1,            ///< @brief Interactive elements were left out
+            COMPONENTS_PARTIAL = 1 << 2,    ///< @brief Components of unregistered types were left out
+        };
+
+        struct Header {
+            char magic[4];
+            std::uint32_t version;
+            Kind kind;
+            std::uint32_t flags;
+            std::uint32_t object_count;     ///< @brief For a delta, the object count of its base
+            std::uint32_t string_count;
+            std::uint32_t column_count;
+            std::uint32_t reserved;
+            std::uint64_t structure_hash;
+        };
+
+        struct ObjectRecord {
+            std::uint32_t name;             ///< @brief Index in the string table
+            std::uint32_t tag;
+        };
+
+        struct ColumnHeader {
+            std::uint32_t type_id;          ///< @brief ComponentRegistry id of the component type
+            std::uint32_t record_size;      ///< @brief 0 for variable-size records
+            std::uint32_t count;
+            std::uint32_t data_size;        ///< @brief Bytes of records
+        };
+
+        enum class UIElementKind : std::uint8_t {
+            ELEMENT = 0,
+            PANEL = 1,
+            LABEL = 2,
+        };
+
+        /// @brief Followed by the kind's own fields: an optional colour for panels; text,
+        /// font id, font size and colour for labels.
+        struct UIElementRecord {
+            UIElementKind kind;
+            std::uint8_t visible;
+            std::uint16_t reserved;
+            std::uint32_t child_count;
+            float position[2];
+            float size[2];
+        };
+
+        static_assert(sizeof(Header) == 40, "Scene snapshot header must be tightly packed.");
+        static_assert(sizeof(ObjectRecord) == 8, "Scene snapshot object record must be tightly packed.");
+        static_assert(sizeof(ColumnHeader) == 16, "Scene snapshot column header must be tightly packed.");
+        static_assert(sizeof(UIElementRecord) == 24, "Scene snapshot UI record must be tightly packed.");
+    };
+
+    /**
+     * @brief The objects of a scene, the state of their components and its UI tree, as one
+     * binary buffer.
+     *
+     * Components are stored by type in columns (see ComponentRegistry); components of
+     * unregistered types are left out. Interactive UI elements are left out as well, with
+     * their children: their callbacks are code. Snapshots are values: copying one copies
+     * its buffer.
+     */
+    class SceneSnapshot final {
+    public:
+        using Kind = SceneSnapshotFormat::Kind;
+
+        /// @brief An empty full snapshot: restoring it clears a scene.
+        SceneSnapshot();
+
+        /// @brief Take over snapshot bytes, e.g. read from a file. Invalid data will throw
+        /// an exception.
+        explicit SceneSnapshot(std::vector<std::byte> data);
+
+        /// @brief Full snapshot of `game_objects` and, if given, of a UI tree.
+        static SceneSnapshot capture(
+            std::span<const std::unique_ptr<engine::object::GameObject>> game_objects,
+            const engine::ui::UIElement* ui_root
+        );
+
+        /// @brief What changed from `base` to `current`, both full snapshots. When objects
+        /// were added, removed, renamed or changed components, there is no delta to take and
+        /// the result is a copy of `current`.
+        static SceneSnapshot diff(const SceneSnapshot& base, const SceneSnapshot& current);
+
+        /// @brief Bring a full snapshot forward by a delta taken from it.
+        /// @return False, leaving this snapshot unchanged, if the delta has another base.
+        bool applyDelta(const SceneSnapshot& delta);
+
+        /// @brief Create the objects of a full snapshot, with their components.
+        std::vector<std::unique_ptr<engine::object::GameObject>> instantiate(engine::core::Context& context) const;
+
+        /// @brief Set the components of existing objects to the snapshot's state. The objects
+        /// must be the ones the snapshot (for a delta, its base) was captured from, in the
+        /// same order; only their count is checked.
+        /// @return False if the objects do not match the snapshot.
+        bool apply(std::span<const std::unique_ptr<engine::object::GameObject>> game_objects) const;
+
+        /// @brief Rebuild a UI tree: `root` takes the saved root's geometry and its children
+        /// are replaced by the saved ones. Does nothing without HAS_UI.
+        void restoreUI(engine::ui::UIElement& root, engine::core::Context& context) const;
+
+        bool saveToFile(std::string_view file_path) const;
+        /// @brief Read a snapshot file. Failure will throw an exception.
+        static SceneSnapshot loadFromFile(std::string_view file_path);
+
+        Kind getKind() const { return header_.kind; }
+        bool hasUI() const { return (header_.flags & SceneSnapshotFormat::HAS_UI) != 0; }
+        /// @brief Whether interactive UI elements were left out of the UI tree.
+        bool isUIPartial() const { return (header_.flags & SceneSnapshotFormat::UI_PARTIAL) != 0; }
+        /// @brief Whether every component of the objects was saved.
+        bool hasAllComponents() const { return (header_.flags & SceneSnapshotFormat::COMPONENTS_PARTIAL) == 0; }
+        /// @brief Objects of the snapshot; for a delta, of its base.
+        std::uint32_t getObjectCount() const { return header_.object_count; }
+        /// @brief Records in all columns.
+        std::size_t getRecordCount() const;
+        std::uint64_t getStructureHash() const { return header_.structure_hash; }
+        std::span<const std::byte> getBytes() const { return data_; }
+
+    private:
+        /// @brief Where a column's parts lie in data_.
+        struct ColumnLayout {
+            SceneSnapshotFormat::ColumnHeader header;
+            std::size_t owners_offset;
+            std::size_t offsets_offset;
+            std::size_t records_offset;
+        };
+
+        std::vector<std::byte> data_;
+        SceneSnapshotFormat::Header header_ = {};
+        std::size_t strings_offset_ = 0;
+        std::size_t objects_offset_ = 0;
+        std::size_t ui_offset_ = 0;
+        std::vector<ColumnLayout> columns_;
+
+        /// @brief Validate data_ and locate its sections.
+        void parse();
+
+        SnapshotColumn getColumn(std::size_t index) const;
+        std::vector<std::string_view> readStrings() const;
+        std::span<const std::byte> getUIBytes() const;
+    };
+
+} // namespace engine::scene
+
+#endif // SCENE_SNAPSHOT_HPP_
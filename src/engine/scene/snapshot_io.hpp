@@ -0,0 +1,172 @@
+#ifndef SNAPSHOT_IO_HPP_
+#define SNAPSHOT_IO_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace engine::scene {
+
+    /// @brief Appends little-endian binary data to a snapshot buffer.
+    class SnapshotWriter final {
+    public:
+        explicit SnapshotWriter(std::vector<std::byte>& buffer) : buffer_(buffer) {}
+
+        SnapshotWriter(const SnapshotWriter&) = delete;
+        SnapshotWriter& operator=(const SnapshotWriter&) = delete;
+        SnapshotWriter(SnapshotWriter&&) = delete;
+        SnapshotWriter& operator=(SnapshotWriter&&) = delete;
+
+        template <typename T>
+        void write(const T& value) {
+            static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable values are written as bytes.");
+            writeBytes(&value, sizeof(T));
+        }
+
+        /// @brief A 32-bit length followed by the characters.
+        void writeString(std::string_view value) {
+            write(static_cast<std::uint32_t>(value.size()));
+            writeBytes(value.data(), value.size());
+        }
+
+        void writeBytes(const void* data, std::size_t size) {
+            if (size == 0) {
+                return;
+            }
+            std::memcpy(grow(size), data, size);
+        }
+
+        /// @brief Append `size` uninitialized bytes; the pointer is valid until the next write.
+        std::byte* grow(std::size_t size) {
+            std::size_t offset = buffer_.size();
+            buffer_.resize(offset + size);
+            return buffer_.data() + offset;
+        }
+
+        /// @brief Overwrite bytes written earlier, e.g. a header once its counts are known.
+        void patch(std::size_t offset, const void* data, std::size_t size) {
+            std::memcpy(buffer_.data() + offset, data, size);
+        }
+
+        /// @brief Pad with zeros up to a multiple of `alignment` bytes.
+        void align(std::size_t alignment = 4) {
+            std::size_t padding = (alignment - buffer_.size() % alignment) % alignment;
+            buffer_.resize(buffer_.size() + padding, std::byte{0});
+        }
+
+        std::size_t size() const { return buffer_.size(); }
+
+    private:
+        std::vector<std::byte>& buffer_;
+    };
+
+    /// @brief Reads what a SnapshotWriter wrote. Reading past the end throws
+    /// std::runtime_error, so truncated or corrupt data never reads out of bounds.
+    class SnapshotReader final {
+    public:
+        explicit SnapshotReader(std::span<const std::byte> data) : data_(data) {}
+
+        template <typename T>
+        T read() {
+            static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable values are read as bytes.");
+            T value;
+            std::memcpy(&value, readBytes(sizeof(T)).data(), sizeof(T));
+            return value;
+        }
+
+        /// @brief A string written by SnapshotWriter::writeString(); views the snapshot's bytes.
+        std::string_view readString() {
+            auto size = read<std::uint32_t>();
+            auto bytes = readBytes(size);
+            return {reinterpret_cast<const char*>(bytes.data()), bytes.size()};
+        }
+
+        std::span<const std::byte> readBytes(std::size_t size) {
+            if (size > data_.size() - position_) {
+                throw std::runtime_error("SceneSnapshot: data is truncated.");
+            }
+            auto bytes = data_.subspan(position_, size);
+            position_ += size;
+            return bytes;
+        }
+
+        /// @brief Skip the padding of SnapshotWriter::align().
+        void align(std::size_t alignment = 4) {
+            readBytes((alignment - position_ % alignment) % alignment);
+        }
+
+        std::size_t getPosition() const { return position_; }
+        std::size_t getRemaining() const { return data_.size() - position_; }
+
+    private:
+        std::span<const std::byte> data_;
+        std::size_t position_ = 0;
+    };
+
+    /// @brief The records of one component type in a snapshot: the object each record
+    /// belongs to, and the record's bytes.
+    ///
+    /// Records of a fixed size sit back to back; variable-size records are located by an
+    /// offset table of `count + 1` entries.
+    class SnapshotColumn final {
+    public:
+        SnapshotColumn(
+            std::uint32_t type_id,
+            std::uint32_t record_size,
+            std::uint32_t count,
+            const std::byte* owners,
+            const std::byte* offsets,
+            const std::byte* records
+        )
+            : type_id_(type_id)
+            , record_size_(record_size)
+            , count_(count)
+            , owners_(owners)
+            , offsets_(offsets)
+            , records_(records)
+        {}
+
+        std::uint32_t getTypeId() const { return type_id_; }
+        /// @brief Bytes per record; 0 when records have variable sizes.
+        std::uint32_t getRecordSize() const { return record_size_; }
+        std::uint32_t getCount() const { return count_; }
+
+        /// @brief Index, in the snapshot's object list, of the object owning record `index`.
+        std::uint32_t getOwner(std::uint32_t index) const { return loadU32(owners_, index); }
+
+        std::span<const std::byte> getRecord(std::uint32_t index) const {
+            if (record_size_ > 0) {
+                return {records_ + static_cast<std::size_t>(index) * record_size_, record_size_};
+            }
+            std::uint32_t begin = loadU32(offsets_, index);
+            return {records_ + begin, loadU32(offsets_, index + 1) - begin};
+        }
+
+        /// @brief All records of a fixed-size column, back to back.
+        std::span<const std::byte> getRecords() const {
+            return {records_, static_cast<std::size_t>(count_) * record_size_};
+        }
+
+    private:
+        std::uint32_t type_id_;
+        std::uint32_t record_size_;
+        std::uint32_t count_;
+        const std::byte* owners_;
+        const std::byte* offsets_;
+        const std::byte* records_;
+
+        static std::uint32_t loadU32(const std::byte* array, std::uint32_t index) {
+            std::uint32_t value;
+            std::memcpy(&value, array + static_cast<std::size_t>(index) * sizeof(value), sizeof(value));
+            return value;
+        }
+    };
+
+} // namespace engine::scene
+
+#endif // SNAPSHOT_IO_HPP_
@@ -20,7 +20,7 @@ namespace engine::ui::state {
             return std::make_unique<UINormalState>(owner_);
         }
 
-        if (input_manager.isActionPressed("MouseLeftClick")) {
+        if (input_manager.isActionPressed(engine::input::MOUSE_LEFT_CLICK)) {
             return std::make_unique<UIPressedState>(owner_);
         }
 
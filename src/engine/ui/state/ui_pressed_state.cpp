@@ -16,7 +16,7 @@ namespace engine::ui::state {
         auto& input_manager = context.getInputManager();
         auto mouse_pos = input_manager.getLogicalMousePosition();
 
-        if (input_manager.isActionReleased("MouseLeftClick")) {
+        if (input_manager.isActionReleased(engine::input::MOUSE_LEFT_CLICK)) {
             if (!owner_->isPointInside(mouse_pos)) {
                 return std::make_unique<engine::ui::state::UINormalState>(owner_);
             }
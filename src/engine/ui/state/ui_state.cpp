@@ -0,0 +1,48 @@
+#include "ui_state.hpp"
+#include <new>
+
+namespace engine::ui::state {
+
+    namespace {
+
+        /// @brief Every state fits in a slot; a larger one falls back to the global heap.
+        constexpr std::size_t SLOT_SIZE = 64;
+
+        struct FreeSlot {
+            FreeSlot* next;
+        };
+
+        /// @brief Slots of destroyed states. They are never returned to the heap: the list
+        /// only ever holds as many slots as there were states alive at once.
+        FreeSlot* free_slots = nullptr;
+
+    } // namespace
+
+    void* UIState::operator new(std::size_t size) {
+        if (size > SLOT_SIZE) {
+            return ::operator new(size);
+        }
+
+        if (free_slots) {
+            FreeSlot* slot = free_slots;
+            free_slots = slot->next;
+            return slot;
+        }
+        return ::operator new(SLOT_SIZE);
+    }
+
+    void UIState::operator delete(void* pointer, std::size_t size) {
+        if (!pointer) {
+            return;
+        }
+
+        // The virtual destructor passes the size of the most derived state
+        if (size > SLOT_SIZE) {
+            ::operator delete(pointer, size);
+            return;
+        }
+
+        free_slots = ::new (pointer) FreeSlot{free_slots};
+    }
+
+} // namespace engine::ui::state
@@ -1,6 +1,7 @@
 #ifndef UI_STATE_HPP_
 #define UI_STATE_HPP_
 
+#include <cstddef>
 #include <memory>
 
 namespace engine::core {
@@ -14,7 +15,7 @@ namespace engine::ui {
 namespace engine::ui::state {
 
     class UIState {
-        friend class UIInteractive;
+        friend class engine::ui::UIInteractive;
 
     public:
         UIState(engine::ui::UIInteractive* owner): owner_(owner) {}
@@ -25,6 +26,11 @@ namespace engine::ui::state {
         UIState(UIState&&) = delete;
         UIState& operator=(UIState&&) = delete;
 
+        /// @brief A new state is created on every transition, so states recycle fixed-size
+        /// slots from a free list instead of going to the heap. Main thread only.
+        static void* operator new(std::size_t size);
+        static void operator delete(void* pointer, std::size_t size);
+
     protected:
         engine::ui::UIInteractive* owner_ = nullptr;
         virtual void enter() {}
@@ -3,6 +3,7 @@
 #include "../core/context.hpp"
 #include "../render/renderer.hpp"
 #include "../resource/resource_manager.hpp"
+#include "../audio/sound_event_bus.hpp"
 #include <spdlog/spdlog.h>
 
 namespace engine::ui {
@@ -36,8 +37,9 @@ namespace engine::ui {
     }
 
     void UIInteractive::setSprite(std::string_view name) {
-        if (sprites_.find(std::string(name)) != sprites_.end()) {
-            current_sprite_ = sprites_[std::string(name)].get();
+        auto it = sprites_.find(name);
+        if (it != sprites_.end()) {
+            current_sprite_ = it->second.get();
         }
     }
 
@@ -46,8 +48,9 @@ namespace engine::ui {
     }
 
     void UIInteractive::playSound(std::string_view name) {
-        if (sounds_.find(std::string(name)) != sounds_.end()) {
-            // TODO
+        auto it = sounds_.find(name);
+        if (it != sounds_.end()) {
+            context_.getSoundEventBus().post(it->second);
         }
     }
 
@@ -4,6 +4,7 @@
 #include "ui_element.hpp"
 #include "state/ui_state.hpp"
 #include "../render/sprite.hpp"
+#include "../utils/hash.hpp"
 #include <memory>
 #include <string>
 #include <string_view>
@@ -44,8 +45,8 @@ namespace engine::ui {
     protected:
         engine::core::Context& context_;
         std::unique_ptr<engine::ui::state::UIState> state_;
-        std::unordered_map<std::string, std::unique_ptr<engine::render::Sprite>> sprites_;
-        std::unordered_map<std::string, std::string> sounds_;
+        std::unordered_map<std::string, std::unique_ptr<engine::render::Sprite>, engine::utils::StringHash, std::equal_to<>> sprites_;
+        std::unordered_map<std::string, std::string, engine::utils::StringHash, std::equal_to<>> sounds_;
         engine::render::Sprite* current_sprite_ = nullptr;
         bool interactive_ = true;
     };
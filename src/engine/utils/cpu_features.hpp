@@ -0,0 +1,45 @@
+#ifndef CPU_FEATURES_HPP_
+#define CPU_FEATURES_HPP_
+
+#include <SDL3/SDL_cpuinfo.h>
+#include <string>
+
+namespace engine::utils {
+
+    /// @brief Instruction sets the compiler was allowed to use (SIMULACRUM_ARCH) that this
+    /// CPU lacks, comma separated; empty when the build runs here.
+    ///
+    /// Default builds target the baseline ISA and dispatch wider SIMD at runtime (see
+    /// selectMixKernels()), so this is always empty for them. Builds for x86-64-v3 or
+    /// -march=native call it at startup to fail with a message instead of an illegal
+    /// instruction.
+    inline std::string getMissingCpuFeatures() {
+        std::string missing;
+        auto require = [&missing](bool present, const char* name) {
+            if (!present) {
+                missing += missing.empty() ? name : std::string(", ") + name;
+            }
+        };
+
+#ifdef __SSE4_1__
+        require(SDL_HasSSE41(), "SSE4.1");
+#endif
+#ifdef __SSE4_2__
+        require(SDL_HasSSE42(), "SSE4.2");
+#endif
+#ifdef __AVX__
+        require(SDL_HasAVX(), "AVX");
+#endif
+#ifdef __AVX2__
+        require(SDL_HasAVX2(), "AVX2");
+#endif
+#ifdef __AVX512F__
+        require(SDL_HasAVX512F(), "AVX-512F");
+#endif
+        (void)require;
+        return missing;
+    }
+
+} // namespace engine::utils
+
+#endif // CPU_FEATURES_HPP_
@@ -0,0 +1,77 @@
+#include "frame_arena.hpp"
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <new>
+#include <spdlog/spdlog.h>
+
+namespace engine::utils {
+
+    FrameArena::FrameArena(std::size_t initial_capacity)
+        : buffer_(std::make_unique_for_overwrite<std::byte[]>(initial_capacity))
+        , capacity_(initial_capacity)
+        , current_(buffer_.get())
+        , end_(buffer_.get() + initial_capacity)
+    {}
+
+    FrameArena::~FrameArena() {
+        releaseOverflowBlocks();
+    }
+
+    void FrameArena::reset() {
+        peak_ = std::max(peak_, used_);
+        used_ = 0;
+
+        if (overflow_blocks_) {
+            releaseOverflowBlocks();
+
+            // One heap round-trip now, so that the following frames fit in the buffer
+            if (peak_ > capacity_) {
+                capacity_ = std::bit_ceil(peak_);
+                buffer_ = std::make_unique_for_overwrite<std::byte[]>(capacity_);
+                spdlog::debug("FrameArena grown to {} bytes.", capacity_);
+            }
+        }
+
+        current_ = buffer_.get();
+        end_ = buffer_.get() + capacity_;
+    }
+
+    void* FrameArena::do_allocate(std::size_t bytes, std::size_t alignment) {
+        if (void* pointer = bump(bytes, alignment)) {
+            return pointer;
+        }
+
+        // Overflow: continue in a heap block at least as large as the main buffer
+        std::size_t size = std::max(capacity_, bytes + alignment);
+        void* memory = ::operator new(sizeof(OverflowBlock) + size);
+        auto* block = ::new (memory) OverflowBlock{overflow_blocks_, size};
+        overflow_blocks_ = block;
+        ++overflow_count_;
+
+        current_ = reinterpret_cast<std::byte*>(block + 1);
+        end_ = current_ + size;
+        return bump(bytes, alignment);
+    }
+
+    void* FrameArena::bump(std::size_t bytes, std::size_t alignment) {
+        auto current = reinterpret_cast<std::uintptr_t>(current_);
+        auto aligned = (current + alignment - 1) & ~(static_cast<std::uintptr_t>(alignment) - 1);
+        if (aligned + bytes > reinterpret_cast<std::uintptr_t>(end_)) {
+            return nullptr;
+        }
+
+        used_ += aligned + bytes - current;
+        current_ += aligned + bytes - current;
+        return reinterpret_cast<void*>(aligned);
+    }
+
+    void FrameArena::releaseOverflowBlocks() {
+        while (overflow_blocks_) {
+            OverflowBlock* next = overflow_blocks_->next;
+            ::operator delete(overflow_blocks_);
+            overflow_blocks_ = next;
+        }
+    }
+
+} // namespace engine::utils
@@ -0,0 +1,74 @@
+#ifndef FRAME_ARENA_HPP_
+#define FRAME_ARENA_HPP_
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+
+namespace engine::utils {
+
+    /**
+     * @brief Linear (bump) allocator for data that lives no longer than one frame.
+     *
+     * Allocation moves a pointer forward; deallocation does nothing and reset() releases
+     * everything at once. It is a std::pmr::memory_resource, so transient strings, vectors
+     * and draw lists use it directly:
+     *
+     *     std::pmr::vector<SpriteComponent*> visible(&context.getFrameArena());
+     *
+     * A frame that outgrows the buffer continues in overflow blocks from the heap; the
+     * next reset() grows the buffer to the frame's peak, so steady-state frames never touch
+     * the heap. Anything allocated from the arena is invalid after reset(). Not thread-safe:
+     * only the main loop allocates from it.
+     */
+    class FrameArena final : public std::pmr::memory_resource {
+    public:
+        explicit FrameArena(std::size_t initial_capacity = 64 * 1024);
+        ~FrameArena() override;
+
+        FrameArena(const FrameArena&) = delete;
+        FrameArena& operator=(const FrameArena&) = delete;
+        FrameArena(FrameArena&&) = delete;
+        FrameArena& operator=(FrameArena&&) = delete;
+
+        /// @brief Release every allocation of the frame. Called at the top of each frame.
+        void reset();
+
+        std::size_t getCapacity() const { return capacity_; }
+        /// @brief Bytes handed out since the last reset(), including alignment padding.
+        std::size_t getUsed() const { return used_; }
+        /// @brief Largest getUsed() seen at a reset().
+        std::size_t getPeak() const { return peak_; }
+        /// @brief Number of overflow blocks taken from the heap since construction.
+        std::size_t getOverflowCount() const { return overflow_count_; }
+
+    private:
+        /// @brief Header of an overflow block; the block's memory follows it.
+        struct OverflowBlock {
+            OverflowBlock* next;
+            std::size_t size;
+        };
+
+        std::unique_ptr<std::byte[]> buffer_;
+        std::size_t capacity_ = 0;
+
+        std::byte* current_ = nullptr;                      ///< @brief Next free byte of the active block
+        std::byte* end_ = nullptr;                          ///< @brief End of the active block
+        OverflowBlock* overflow_blocks_ = nullptr;
+
+        std::size_t used_ = 0;
+        std::size_t peak_ = 0;
+        std::size_t overflow_count_ = 0;
+
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+        void do_deallocate(void*, std::size_t, std::size_t) override {}
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+        /// @brief Carve `bytes` from the active block, or return null if it does not fit.
+        void* bump(std::size_t bytes, std::size_t alignment);
+        void releaseOverflowBlocks();
+    };
+
+} // namespace engine::utils
+
+#endif // FRAME_ARENA_HPP_
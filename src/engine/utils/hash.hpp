@@ -0,0 +1,39 @@
+#ifndef HASH_HPP_
+#define HASH_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+
+namespace engine::utils {
+
+    inline constexpr std::uint64_t FNV1A_OFFSET_BASIS = 14695981039346656037ull;
+    inline constexpr std::uint64_t FNV1A_PRIME = 1099511628211ull;
+
+    /// @brief 64-bit FNV-1a over a byte range. Pass a previous result as `seed` to hash
+    /// several ranges as one.
+    inline std::uint64_t fnv1a64(const void* data, std::size_t size, std::uint64_t seed = FNV1A_OFFSET_BASIS) {
+        const auto* bytes = static_cast<const std::uint8_t*>(data);
+        std::uint64_t hash = seed;
+        for (std::size_t i = 0; i < size; ++i) {
+            hash ^= bytes[i];
+            hash *= FNV1A_PRIME;
+        }
+        return hash;
+    }
+
+    /// @brief Transparent string hash, so maps keyed by std::string can be searched with a
+    /// std::string_view without building a temporary string.
+    struct StringHash {
+        using is_transparent = void;
+
+        std::size_t operator()(std::string_view value) const { return std::hash<std::string_view>{}(value); }
+        std::size_t operator()(const std::string& value) const { return std::hash<std::string_view>{}(value); }
+        std::size_t operator()(const char* value) const { return std::hash<std::string_view>{}(value); }
+    };
+
+} // namespace engine::utils
+
+#endif // HASH_HPP_
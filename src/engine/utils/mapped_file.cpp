@@ -0,0 +1,128 @@
+#include "mapped_file.hpp"
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+
+#ifdef _WIN32
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace engine::utils {
+
+#ifdef _WIN32
+
+    MappedFile::MappedFile(std::string_view file_path) {
+        std::filesystem::path path(file_path);
+
+        HANDLE file = CreateFileW(
+            path.c_str(),
+            GENERIC_READ,
+            FILE_SHARE_READ,
+            nullptr,
+            OPEN_EXISTING,
+            FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+            nullptr
+        );
+
+        if (file == INVALID_HANDLE_VALUE) {
+            throw std::runtime_error("Unable to open '" + path.string() + "' for mapping.");
+        }
+
+        LARGE_INTEGER file_size{};
+        if (!GetFileSizeEx(file, &file_size)) {
+            CloseHandle(file);
+            throw std::runtime_error("Unable to query the size of '" + path.string() + "'.");
+        }
+
+        file_handle_ = file;
+        size_ = static_cast<std::size_t>(file_size.QuadPart);
+        if (size_ == 0) {
+            return;
+        }
+
+        HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!mapping) {
+            CloseHandle(file);
+            file_handle_ = nullptr;
+            throw std::runtime_error("Unable to create a mapping of '" + path.string() + "'.");
+        }
+
+        void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if (!view) {
+            CloseHandle(mapping);
+            CloseHandle(file);
+            file_handle_ = nullptr;
+            throw std::runtime_error("Unable to map a view of '" + path.string() + "'.");
+        }
+
+        mapping_handle_ = mapping;
+        data_ = static_cast<const std::byte*>(view);
+    }
+
+    MappedFile::~MappedFile() {
+        if (data_) {
+            UnmapViewOfFile(data_);
+        }
+        if (mapping_handle_) {
+            CloseHandle(static_cast<HANDLE>(mapping_handle_));
+        }
+        if (file_handle_) {
+            CloseHandle(static_cast<HANDLE>(file_handle_));
+        }
+    }
+
+#else
+
+    MappedFile::MappedFile(std::string_view file_path) {
+        std::string path(file_path);
+
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::runtime_error("Unable to open '" + path + "' for mapping.");
+        }
+
+        struct stat info{};
+        if (fstat(fd, &info) != 0) {
+            close(fd);
+            throw std::runtime_error("Unable to query the size of '" + path + "'.");
+        }
+
+        size_ = static_cast<std::size_t>(info.st_size);
+        if (size_ == 0) {
+            close(fd);
+            return;
+        }
+
+        void* view = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+
+        // The mapping keeps its own reference to the file
+        close(fd);
+
+        if (view == MAP_FAILED) {
+            size_ = 0;
+            throw std::runtime_error("Unable to map '" + path + "'.");
+        }
+
+        data_ = static_cast<const std::byte*>(view);
+    }
+
+    MappedFile::~MappedFile() {
+        if (data_) {
+            munmap(const_cast<std::byte*>(data_), size_);
+        }
+    }
+
+#endif
+
+} // namespace engine::utils
@@ -0,0 +1,40 @@
+#ifndef MAPPED_FILE_HPP_
+#define MAPPED_FILE_HPP_
+
+#include <cstddef>
+#include <span>
+#include <string_view>
+
+namespace engine::utils {
+
+    /// @brief Read-only memory mapping of a whole file.
+    ///
+    /// The mapping stays valid for the lifetime of the object. Construction failure will
+    /// throw an exception.
+    class MappedFile final {
+    public:
+        explicit MappedFile(std::string_view file_path);
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+        MappedFile(MappedFile&&) = delete;
+        MappedFile& operator=(MappedFile&&) = delete;
+
+        const std::byte* data() const { return data_; }
+        std::size_t size() const { return size_; }
+        std::span<const std::byte> bytes() const { return {data_, size_}; }
+
+    private:
+        const std::byte* data_ = nullptr;
+        std::size_t size_ = 0;
+
+#ifdef _WIN32
+        void* file_handle_ = nullptr;
+        void* mapping_handle_ = nullptr;
+#endif
+    };
+
+} // namespace engine::utils
+
+#endif // MAPPED_FILE_HPP_
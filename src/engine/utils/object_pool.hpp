@@ -0,0 +1,191 @@
+#ifndef OBJECT_POOL_HPP_
+#define OBJECT_POOL_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace engine::utils {
+
+    /**
+     * @brief Pool of objects of one type, stored in fixed-size chunks (slabs).
+     *
+     * Objects never move once created, so raw pointers to them stay valid until they are
+     * destroyed. Freed slots are reused most-recent first, which keeps churning objects in
+     * warm memory, and a slot's generation is bumped on every free so that handles to a
+     * destroyed object are detected instead of silently pointing at its successor.
+     * Iterating with forEach() walks the chunks in address order.
+     *
+     * Objects are either owned by the pool (create()/destroy()) or by whoever asked for raw
+     * storage (allocate()/deallocate(), used by class-specific operator new/delete). Not
+     * thread-safe: pools are used from the main thread only.
+     */
+    template <typename T, std::size_t ChunkSize = 256>
+    class ObjectPool final {
+        static_assert(ChunkSize > 0, "Chunks must hold at least one object.");
+
+    public:
+        static constexpr std::uint32_t INVALID_INDEX = std::numeric_limits<std::uint32_t>::max();
+
+        /// @brief Refers to one object; stays detectably invalid once the object is destroyed.
+        struct Handle {
+            std::uint32_t index = INVALID_INDEX;
+            std::uint32_t generation = 0;
+
+            bool isValid() const { return index != INVALID_INDEX; }
+            bool operator==(const Handle&) const = default;
+        };
+
+        /// @brief The process-wide pool of T. Never destroyed, since objects it holds may be
+        /// released during static destruction.
+        static ObjectPool& shared() {
+            static auto* pool = new ObjectPool();
+            return *pool;
+        }
+
+        ObjectPool() = default;
+
+        /// @brief Destroys the objects still alive and releases every chunk.
+        ~ObjectPool() {
+            forEach([this](T& object) { destroy(&object); });
+        }
+
+        ObjectPool(const ObjectPool&) = delete;
+        ObjectPool& operator=(const ObjectPool&) = delete;
+        ObjectPool(ObjectPool&&) = delete;
+        ObjectPool& operator=(ObjectPool&&) = delete;
+
+        /// @brief Construct an object in a free slot, growing the pool by one chunk if needed.
+        template <typename... Args>
+        T* create(Args&&... args) {
+            void* storage = allocate();
+            try {
+                return ::new (storage) T(std::forward<Args>(args)...);
+            }
+
+            catch (...) {
+                deallocate(storage);
+                throw;
+            }
+        }
+
+        /// @brief Destroy an object created by create() and free its slot.
+        void destroy(T* object) {
+            if (!object) {
+                return;
+            }
+
+            object->~T();
+            deallocate(object);
+        }
+
+        /// @brief Uninitialized storage for one T; the caller constructs the object in it.
+        void* allocate() {
+            if (free_head_ == INVALID_INDEX) {
+                addChunk();
+            }
+
+            Slot& slot = slotAt(free_head_);
+            free_head_ = slot.next_free;
+            slot.alive = true;
+            ++size_;
+            return slot.storage;
+        }
+
+        /// @brief Return storage obtained from allocate(); the object must already be destroyed.
+        void deallocate(void* pointer) {
+            if (!pointer) {
+                return;
+            }
+
+            Slot& slot = slotOf(pointer);
+            slot.alive = false;
+            ++slot.generation;
+            slot.next_free = free_head_;
+            free_head_ = slot.index;
+            --size_;
+        }
+
+        Handle getHandle(const T* object) const {
+            if (!object) {
+                return {};
+            }
+
+            const Slot& slot = slotOf(object);
+            return Handle{slot.index, slot.generation};
+        }
+
+        /// @brief The object a handle refers to, or null if it has been destroyed since.
+        T* get(Handle handle) const {
+            if (handle.index >= capacity()) {
+                return nullptr;
+            }
+
+            const Slot& slot = slotAt(handle.index);
+            if (!slot.alive || slot.generation != handle.generation) {
+                return nullptr;
+            }
+            return std::launder(reinterpret_cast<T*>(const_cast<std::byte*>(slot.storage)));
+        }
+
+        /// @brief Call `func(T&)` on every live object, in memory order. `func` may destroy
+        /// the object it is given, but must not create objects in this pool.
+        template <typename Func>
+        void forEach(Func&& func) {
+            for (auto& chunk : chunks_) {
+                for (std::size_t i = 0; i < ChunkSize; ++i) {
+                    if (chunk[i].alive) {
+                        func(*std::launder(reinterpret_cast<T*>(chunk[i].storage)));
+                    }
+                }
+            }
+        }
+
+        std::size_t size() const { return size_; }
+        std::size_t capacity() const { return chunks_.size() * ChunkSize; }
+        std::size_t getChunkCount() const { return chunks_.size(); }
+
+    private:
+        struct Slot {
+            alignas(T) std::byte storage[sizeof(T)];
+            std::uint32_t index = 0;
+            std::uint32_t generation = 0;
+            std::uint32_t next_free = INVALID_INDEX;
+            bool alive = false;
+        };
+
+        std::vector<std::unique_ptr<Slot[]>> chunks_;
+        std::uint32_t free_head_ = INVALID_INDEX;
+        std::size_t size_ = 0;
+
+        Slot& slotAt(std::uint32_t index) const {
+            return chunks_[index / ChunkSize][index % ChunkSize];
+        }
+
+        /// @brief The storage is the slot's first member, so the slot starts at the object
+        static Slot& slotOf(const void* pointer) {
+            return *reinterpret_cast<Slot*>(const_cast<void*>(pointer));
+        }
+
+        void addChunk() {
+            auto first = static_cast<std::uint32_t>(capacity());
+            auto chunk = std::make_unique<Slot[]>(ChunkSize);
+
+            // Thread the new slots onto the free list in address order
+            for (std::size_t i = 0; i < ChunkSize; ++i) {
+                chunk[i].index = first + static_cast<std::uint32_t>(i);
+                chunk[i].next_free = i + 1 < ChunkSize ? chunk[i].index + 1 : free_head_;
+            }
+
+            chunks_.push_back(std::move(chunk));
+            free_head_ = first;
+        }
+    };
+
+} // namespace engine::utils
+
+#endif // OBJECT_POOL_HPP_
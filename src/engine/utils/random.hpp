@@ -0,0 +1,93 @@
+#ifndef RANDOM_HPP_
+#define RANDOM_HPP_
+
+#include <cstdint>
+
+namespace engine::utils {
+
+    /**
+     * @brief Seeded random number generator of the engine (PCG32).
+     *
+     * The sequence only depends on the seed: the same seed gives the same numbers on every
+     * platform and build, unlike std::rand or the distributions of <random>, whose output is
+     * implementation-defined. Gameplay code draws from the Context's generator so that a
+     * deterministic run can be reproduced from its seed.
+     */
+    class Random final {
+    public:
+        static constexpr std::uint64_t DEFAULT_SEED = 0x853c49e6748fea9bull;
+
+        explicit Random(std::uint64_t seed = DEFAULT_SEED) { setSeed(seed); }
+
+        Random(const Random&) = delete;
+        Random& operator=(const Random&) = delete;
+        Random(Random&&) = delete;
+        Random& operator=(Random&&) = delete;
+
+        /// @brief Restart the sequence of `seed`.
+        void setSeed(std::uint64_t seed) {
+            seed_ = seed;
+            state_ = 0;
+            nextU32();
+            state_ += seed;
+            nextU32();
+        }
+
+        std::uint64_t getSeed() const { return seed_; }
+
+        /// @brief Uniform over all 32-bit values.
+        std::uint32_t nextU32() {
+            std::uint64_t state = state_;
+            state_ = state * MULTIPLIER + INCREMENT;
+            auto xorshifted = static_cast<std::uint32_t>(((state >> 18u) ^ state) >> 27u);
+            auto rotation = static_cast<std::uint32_t>(state >> 59u);
+            return (xorshifted >> rotation) | (xorshifted << ((32u - rotation) & 31u));
+        }
+
+        /// @brief Uniform in [0, 1).
+        float nextFloat() {
+            // 24 bits fill the float's mantissa exactly
+            return static_cast<float>(nextU32() >> 8) * (1.0f / 16777216.0f);
+        }
+
+        /// @brief Uniform in [min, max).
+        float range(float min, float max) {
+            return min + (max - min) * nextFloat();
+        }
+
+        /// @brief Uniform in [min, max], both included; min when max < min.
+        int rangeInt(int min, int max) {
+            if (max <= min) {
+                return min;
+            }
+
+            // Lemire's multiply-and-reject: unbiased without a division in the common case
+            auto span = static_cast<std::uint64_t>(static_cast<std::int64_t>(max) - min) + 1;
+            std::uint64_t product = static_cast<std::uint64_t>(nextU32()) * span;
+            auto low = static_cast<std::uint32_t>(product);
+            if (low < span) {
+                auto threshold = static_cast<std::uint32_t>((0x100000000ull - span) % span);
+                while (low < threshold) {
+                    product = static_cast<std::uint64_t>(nextU32()) * span;
+                    low = static_cast<std::uint32_t>(product);
+                }
+            }
+            return static_cast<int>(min + static_cast<std::int64_t>(product >> 32));
+        }
+
+        /// @brief True with the given probability.
+        bool chance(float probability) {
+            return nextFloat() < probability;
+        }
+
+    private:
+        static constexpr std::uint64_t MULTIPLIER = 6364136223846793005ull;
+        static constexpr std::uint64_t INCREMENT = 1442695040888963407ull;
+
+        std::uint64_t seed_ = 0;
+        std::uint64_t state_ = 0;
+    };
+
+} // namespace engine::utils
+
+#endif // RANDOM_HPP_
@@ -0,0 +1,134 @@
+#include "spatial_grid.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace engine::utils {
+
+    SpatialGrid::SpatialGrid(float cell_size)
+        : cell_size_(cell_size)
+        , inv_cell_size_(0.0f)
+    {
+        if (cell_size_ <= 0.0f) {
+            throw std::invalid_argument("SpatialGrid cell size must be positive.");
+        }
+        inv_cell_size_ = 1.0f / cell_size_;
+    }
+
+    SpatialGrid::Handle SpatialGrid::insert(const Rect& bounds) {
+        Handle handle;
+        if (!free_handles_.empty()) {
+            handle = free_handles_.back();
+            free_handles_.pop_back();
+        } else {
+            handle = static_cast<Handle>(entries_.size());
+            entries_.emplace_back();
+        }
+
+        Entry& entry = entries_[handle];
+        entry.cells = cellRangeOf(bounds);
+        entry.query_stamp = query_stamp_;
+        entry.alive = true;
+        link(handle, entry.cells);
+        return handle;
+    }
+
+    void SpatialGrid::update(Handle handle, const Rect& bounds) {
+        if (handle >= entries_.size() || !entries_[handle].alive) {
+            return;
+        }
+
+        Entry& entry = entries_[handle];
+        CellRange range = cellRangeOf(bounds);
+        if (range == entry.cells) {
+            return;
+        }
+
+        unlink(handle, entry.cells);
+        entry.cells = range;
+        link(handle, entry.cells);
+    }
+
+    void SpatialGrid::remove(Handle handle) {
+        if (handle >= entries_.size() || !entries_[handle].alive) {
+            return;
+        }
+
+        Entry& entry = entries_[handle];
+        unlink(handle, entry.cells);
+        entry.alive = false;
+        free_handles_.push_back(handle);
+    }
+
+    void SpatialGrid::query(const Rect& area, std::vector<Handle>& out) {
+        CellRange range = cellRangeOf(area);
+
+        if (++query_stamp_ == 0) {
+            // Stamp wrapped around; reset so stale stamps can't alias the new one
+            for (auto& entry : entries_) {
+                entry.query_stamp = 0;
+            }
+            query_stamp_ = 1;
+        }
+
+        for (int y = range.min_y; y <= range.max_y; ++y) {
+            for (int x = range.min_x; x <= range.max_x; ++x) {
+                auto it = cells_.find(cellKey(x, y));
+                if (it == cells_.end()) {
+                    continue;
+                }
+
+                for (Handle handle : it->second) {
+                    Entry& entry = entries_[handle];
+                    if (entry.query_stamp != query_stamp_) {
+                        entry.query_stamp = query_stamp_;
+                        out.push_back(handle);
+                    }
+                }
+            }
+        }
+    }
+
+    void SpatialGrid::clear() {
+        entries_.clear();
+        free_handles_.clear();
+        cells_.clear();
+        query_stamp_ = 0;
+    }
+
+    SpatialGrid::CellRange SpatialGrid::cellRangeOf(const Rect& bounds) const {
+        CellRange range;
+        range.min_x = static_cast<int>(std::floor(bounds.position.x * inv_cell_size_));
+        range.min_y = static_cast<int>(std::floor(bounds.position.y * inv_cell_size_));
+        range.max_x = static_cast<int>(std::floor((bounds.position.x + std::max(bounds.size.x, 0.0f)) * inv_cell_size_));
+        range.max_y = static_cast<int>(std::floor((bounds.position.y + std::max(bounds.size.y, 0.0f)) * inv_cell_size_));
+        return range;
+    }
+
+    void SpatialGrid::link(Handle handle, const CellRange& range) {
+        for (int y = range.min_y; y <= range.max_y; ++y) {
+            for (int x = range.min_x; x <= range.max_x; ++x) {
+                cells_[cellKey(x, y)].push_back(handle);
+            }
+        }
+    }
+
+    void SpatialGrid::unlink(Handle handle, const CellRange& range) {
+        for (int y = range.min_y; y <= range.max_y; ++y) {
+            for (int x = range.min_x; x <= range.max_x; ++x) {
+                auto it = cells_.find(cellKey(x, y));
+                if (it == cells_.end()) {
+                    continue;
+                }
+
+                auto& handles = it->second;
+                auto pos = std::find(handles.begin(), handles.end(), handle);
+                if (pos != handles.end()) {
+                    *pos = handles.back();
+                    handles.pop_back();
+                }
+            }
+        }
+    }
+
+} // namespace engine::utils
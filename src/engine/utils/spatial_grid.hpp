@@ -0,0 +1,94 @@
+#ifndef SPATIAL_GRID_HPP_
+#define SPATIAL_GRID_HPP_
+
+#include "math.hpp"
+#include <cstdint>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+namespace engine::utils {
+
+    /**
+     * @brief Sparse uniform grid over axis-aligned bounds.
+     *
+     * Entries are identified by dense integer handles (freed handles are reused), so
+     * callers can keep per-entry data in parallel arrays indexed by handle. Updating an
+     * entry only touches the grid when the set of cells it overlaps changes, which makes
+     * per-frame updates of slowly moving objects close to free.
+     */
+    class SpatialGrid final {
+    public:
+        using Handle = std::uint32_t;
+        static constexpr Handle INVALID_HANDLE = std::numeric_limits<Handle>::max();
+
+        explicit SpatialGrid(float cell_size = 256.0f);
+
+        SpatialGrid(const SpatialGrid&) = delete;
+        SpatialGrid& operator=(const SpatialGrid&) = delete;
+        SpatialGrid(SpatialGrid&&) = delete;
+        SpatialGrid& operator=(SpatialGrid&&) = delete;
+
+        /// @brief Insert new bounds into the grid.
+        /// @return Handle used to update or remove the entry later.
+        Handle insert(const Rect& bounds);
+
+        /// @brief Move an existing entry to new bounds.
+        void update(Handle handle, const Rect& bounds);
+
+        /// @brief Remove an entry. The handle may be returned by a later insert().
+        void remove(Handle handle);
+
+        /// @brief Append the handles of all entries whose cells overlap the area. Each
+        /// handle is reported once, even if the entry spans several cells. The result is
+        /// conservative: callers doing exact tests must check the bounds themselves.
+        void query(const Rect& area, std::vector<Handle>& out);
+
+        void clear();
+
+        std::size_t size() const { return entries_.size() - free_handles_.size(); }
+        std::size_t getCellCount() const { return cells_.size(); }
+        float getCellSize() const { return cell_size_; }
+
+    private:
+        struct CellRange {
+            int min_x = 0;
+            int min_y = 0;
+            int max_x = -1;
+            int max_y = -1;
+
+            bool operator==(const CellRange&) const = default;
+        };
+
+        struct Entry {
+            CellRange cells;
+            std::uint32_t query_stamp = 0;
+            bool alive = false;
+        };
+
+        float cell_size_;
+        float inv_cell_size_;
+
+        std::vector<Entry> entries_;
+        std::vector<Handle> free_handles_;
+
+        /// @brief Occupied cells, keyed by packed (x, y) cell coordinates. Cells are kept
+        /// after they become empty so that moving entries don't churn allocations.
+        std::unordered_map<std::uint64_t, std::vector<Handle>> cells_;
+
+        /// @brief Incremented per query to deduplicate entries spanning multiple cells.
+        std::uint32_t query_stamp_ = 0;
+
+        CellRange cellRangeOf(const Rect& bounds) const;
+        void link(Handle handle, const CellRange& range);
+        void unlink(Handle handle, const CellRange& range);
+
+        static std::uint64_t cellKey(int x, int y) {
+            return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32) |
+                   static_cast<std::uint32_t>(y);
+        }
+    };
+
+} // namespace engine::utils
+
+#endif // SPATIAL_GRID_HPP_
@@ -0,0 +1,77 @@
+#ifndef SPSC_QUEUE_HPP_
+#define SPSC_QUEUE_HPP_
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <optional>
+#include <type_traits>
+
+namespace engine::utils {
+
+    /// @brief Fixed-capacity, lock-free single-producer/single-consumer ring buffer.
+    ///
+    /// Exactly one thread may call tryPush() and exactly one (other) thread may call
+    /// tryPop(). Neither ever blocks or allocates; a full queue rejects the push.
+    template <typename T, std::size_t Capacity>
+    class SpscQueue final {
+        static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two.");
+        static_assert(std::is_trivially_copyable_v<T>, "Queue elements are copied between threads.");
+
+    public:
+        SpscQueue() = default;
+
+        SpscQueue(const SpscQueue&) = delete;
+        SpscQueue& operator=(const SpscQueue&) = delete;
+        SpscQueue(SpscQueue&&) = delete;
+        SpscQueue& operator=(SpscQueue&&) = delete;
+
+        /// @brief Producer side. Returns false if the queue is full.
+        bool tryPush(const T& value) {
+            std::size_t tail = tail_.load(std::memory_order_relaxed);
+            if (tail - head_cache_ == Capacity) {
+                head_cache_ = head_.load(std::memory_order_acquire);
+                if (tail - head_cache_ == Capacity) {
+                    return false;
+                }
+            }
+
+            slots_[tail & (Capacity - 1)] = value;
+            tail_.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        /// @brief Consumer side. Returns nothing if the queue is empty.
+        std::optional<T> tryPop() {
+            std::size_t head = head_.load(std::memory_order_relaxed);
+            if (head == tail_cache_) {
+                tail_cache_ = tail_.load(std::memory_order_acquire);
+                if (head == tail_cache_) {
+                    return std::nullopt;
+                }
+            }
+
+            T value = slots_[head & (Capacity - 1)];
+            head_.store(head + 1, std::memory_order_release);
+            return value;
+        }
+
+        static constexpr std::size_t capacity() { return Capacity; }
+
+    private:
+        // Producer and consumer indices live on separate cache lines, each next to the
+        // producer's/consumer's cached copy of the other index
+        static constexpr std::size_t CACHE_LINE = 64;
+
+        alignas(CACHE_LINE) std::atomic<std::size_t> tail_{0};
+        std::size_t head_cache_ = 0;
+
+        alignas(CACHE_LINE) std::atomic<std::size_t> head_{0};
+        std::size_t tail_cache_ = 0;
+
+        alignas(CACHE_LINE) std::array<T, Capacity> slots_{};
+    };
+
+} // namespace engine::utils
+
+#endif // SPSC_QUEUE_HPP_
@@ -0,0 +1,32 @@
+#include "string_interner.hpp"
+
+namespace engine::utils {
+
+    StringInterner& StringInterner::shared() {
+        static auto* interner = new StringInterner();
+        return *interner;
+    }
+
+    StringInterner::StringInterner() {
+        // Id 0 is the empty string, the default name and tag of every object
+        intern("");
+    }
+
+    StringId StringInterner::intern(std::string_view value) {
+        auto it = ids_.find(value);
+        if (it != ids_.end()) {
+            return it->second;
+        }
+
+        auto id = static_cast<StringId>(strings_.size());
+        const std::string& stored = strings_.emplace_back(value);
+        ids_.emplace(stored, id);
+        return id;
+    }
+
+    StringId StringInterner::find(std::string_view value) const {
+        auto it = ids_.find(value);
+        return it != ids_.end() ? it->second : INVALID_STRING_ID;
+    }
+
+} // namespace engine::utils
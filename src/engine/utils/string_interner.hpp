@@ -0,0 +1,60 @@
+#ifndef STRING_INTERNER_HPP_
+#define STRING_INTERNER_HPP_
+
+#include "hash.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace engine::utils {
+
+    /// @brief Dense id of an interned string; equal strings have equal ids.
+    using StringId = std::uint32_t;
+
+    inline constexpr StringId EMPTY_STRING_ID = 0;
+    inline constexpr StringId INVALID_STRING_ID = std::numeric_limits<StringId>::max();
+
+    /**
+     * @brief Table of unique strings, so that names and tags can be stored and compared as
+     * integers.
+     *
+     * Interned strings are never released and their views stay valid for the lifetime of
+     * the program. Not thread-safe: strings are interned from the main thread only.
+     */
+    class StringInterner final {
+    public:
+        /// @brief The process-wide table. Never destroyed, like the pools holding its users.
+        static StringInterner& shared();
+
+        StringInterner();
+
+        StringInterner(const StringInterner&) = delete;
+        StringInterner& operator=(const StringInterner&) = delete;
+        StringInterner(StringInterner&&) = delete;
+        StringInterner& operator=(StringInterner&&) = delete;
+
+        /// @brief Id of `value`, adding it to the table the first time it is seen.
+        StringId intern(std::string_view value);
+
+        /// @brief Id of `value` if it was ever interned, otherwise INVALID_STRING_ID. Queries
+        /// use this so that looking a string up never grows the table.
+        StringId find(std::string_view value) const;
+
+        /// @brief The string of an id returned by intern().
+        std::string_view lookup(StringId id) const { return strings_[id]; }
+
+        std::size_t size() const { return strings_.size(); }
+
+    private:
+        /// @brief Deque elements never move, so the views used as keys below stay valid.
+        std::deque<std::string> strings_;
+        std::unordered_map<std::string_view, StringId, StringHash, std::equal_to<>> ids_;
+    };
+
+} // namespace engine::utils
+
+#endif // STRING_INTERNER_HPP_
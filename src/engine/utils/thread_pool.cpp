@@ -0,0 +1,89 @@
+#include "thread_pool.hpp"
+#include <algorithm>
+
+namespace engine::utils {
+
+    ThreadPool::ThreadPool(std::size_t worker_count) {
+        workers_.reserve(worker_count);
+        for (std::size_t i = 0; i < worker_count; ++i) {
+            workers_.emplace_back([this] { workerMain(); });
+        }
+    }
+
+    ThreadPool::~ThreadPool() {
+        {
+            std::lock_guard lock(mutex_);
+            stopping_ = true;
+        }
+        work_ready_.notify_all();
+
+        for (auto& worker : workers_) {
+            worker.join();
+        }
+    }
+
+    void ThreadPool::run(std::size_t count, std::size_t grain, RangeFunction function, void* context) {
+        if (count == 0) {
+            return;
+        }
+
+        grain = std::max<std::size_t>(grain, 1);
+
+        // Not worth waking anyone for a single range
+        if (workers_.empty() || count <= grain) {
+            function(context, 0, count);
+            return;
+        }
+
+        {
+            std::lock_guard lock(mutex_);
+            function_ = function;
+            context_ = context;
+            count_ = count;
+            grain_ = grain;
+            next_index_.store(0, std::memory_order_relaxed);
+            busy_workers_ = workers_.size();
+            ++generation_;
+        }
+        work_ready_.notify_all();
+
+        drain();
+
+        // The loop's state must outlive every worker still inside it
+        std::unique_lock lock(mutex_);
+        work_done_.wait(lock, [this] { return busy_workers_ == 0; });
+    }
+
+    void ThreadPool::drain() {
+        while (true) {
+            std::size_t begin = next_index_.fetch_add(grain_, std::memory_order_relaxed);
+            if (begin >= count_) {
+                return;
+            }
+            function_(context_, begin, std::min(begin + grain_, count_));
+        }
+    }
+
+    void ThreadPool::workerMain() {
+        std::uint64_t seen_generation = 0;
+
+        while (true) {
+            {
+                std::unique_lock lock(mutex_);
+                work_ready_.wait(lock, [this, seen_generation] { return stopping_ || generation_ != seen_generation; });
+                if (stopping_) {
+                    return;
+                }
+                seen_generation = generation_;
+            }
+
+            drain();
+
+            std::lock_guard lock(mutex_);
+            if (--busy_workers_ == 0) {
+                work_done_.notify_one();
+            }
+        }
+    }
+
+} // namespace engine::utils
@@ -0,0 +1,74 @@
+#ifndef THREAD_POOL_HPP_
+#define THREAD_POOL_HPP_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace engine::utils {
+
+    /**
+     * @brief Fixed set of worker threads that split loops with the calling thread.
+     *
+     * parallelFor() hands out ranges of `grain` indices from a shared counter until the
+     * loop is done, so uneven ranges balance themselves, and returns once every range has
+     * run. The calling thread works too: a pool with no workers runs the loop inline. One
+     * loop runs at a time, and only the thread that owns the pool may start one.
+     */
+    class ThreadPool final {
+    public:
+        /// @param worker_count Threads started besides the caller; 0 runs everything inline
+        explicit ThreadPool(std::size_t worker_count);
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+        ThreadPool(ThreadPool&&) = delete;
+        ThreadPool& operator=(ThreadPool&&) = delete;
+
+        /// @brief Threads a loop is spread over, the caller included.
+        std::size_t getThreadCount() const { return workers_.size() + 1; }
+
+        /// @brief Call `func(begin, end)` on consecutive ranges covering [0, count), in
+        /// parallel, and wait for all of them. `func` must be safe to call concurrently.
+        template <typename Func>
+        void parallelFor(std::size_t count, std::size_t grain, Func&& func) {
+            auto invoke = [](void* context, std::size_t begin, std::size_t end) {
+                (*static_cast<std::remove_reference_t<Func>*>(context))(begin, end);
+            };
+            run(count, grain, invoke, &func);
+        }
+
+    private:
+        using RangeFunction = void (*)(void* context, std::size_t begin, std::size_t end);
+
+        std::vector<std::thread> workers_;
+
+        std::mutex mutex_;
+        std::condition_variable work_ready_;
+        std::condition_variable work_done_;
+        std::uint64_t generation_ = 0;          ///< @brief Bumped for every loop; wakes the workers
+        std::size_t busy_workers_ = 0;
+        bool stopping_ = false;
+
+        // --- Current loop; written before generation_ is bumped ---
+        RangeFunction function_ = nullptr;
+        void* context_ = nullptr;
+        std::size_t count_ = 0;
+        std::size_t grain_ = 1;
+        std::atomic<std::size_t> next_index_{0};
+
+        void run(std::size_t count, std::size_t grain, RangeFunction function, void* context);
+        /// @brief Take ranges of the current loop until none are left.
+        void drain();
+        void workerMain();
+    };
+
+} // namespace engine::utils
+
+#endif // THREAD_POOL_HPP_
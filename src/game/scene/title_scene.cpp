@@ -4,6 +4,7 @@
 #include "../../engine/render/renderer.hpp"
 #include "../../engine/core/game_state.hpp"
 #include "../../engine/resource/resource_manager.hpp"
+#include "../../engine/scene/scene_snapshot.hpp"
 #include "../../engine/input/input_manager.hpp"
 #include "../../engine/ui/ui_manager.hpp"
 #include "../../engine/ui/ui_panel.hpp"
@@ -16,7 +17,10 @@ namespace game::scene {
     TitleScene::TitleScene(
         engine::core::Context& context,
         engine::scene::SceneManager& scene_manager
-    ): engine::scene::Scene("TitleScene", context, scene_manager) {}
+    ): engine::scene::Scene("TitleScene", context, scene_manager) {
+        // restore() rebuilds the buttons, the only state init() adds beyond objects
+        setSnapshotCaching(true);
+    }
 
     void TitleScene::init() {
         if (is_initialized_) {
@@ -26,6 +30,19 @@ namespace game::scene {
         Scene::init();
     }
 
+    bool TitleScene::restore(const engine::scene::SceneSnapshot& snapshot) {
+        if (is_initialized_) {
+            return true;
+        }
+        // The buttons call back into this scene: the UI is built anew rather than restored
+        if (!restoreSnapshot(snapshot, false)) {
+            return false;
+        }
+        createUI();
+        Scene::init();
+        return true;
+    }
+
     void TitleScene::update(float delta_time) {
         Scene::update(delta_time);
     }
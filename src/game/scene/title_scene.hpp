@@ -10,6 +10,7 @@ namespace engine::object {
 
 namespace engine::scene {
     class SceneManager;
+    class SceneSnapshot;
 }
 
 namespace game::scene {
@@ -25,6 +26,7 @@ namespace game::scene {
         ~TitleScene() override = default;
 
         void init() override;
+        bool restore(const engine::scene::SceneSnapshot& snapshot) override;
         void update(float delta_time) override;
 
         TitleScene(const TitleScene&) = delete;
@@ -67,6 +67,27 @@ int main(int argc, char* argv[]) {
 
     engine::core::GameApp app;
     app.registerSceneSetup(setupInitialScene);
+
+    // --record <file>: record the session's input
+    // --replay <file>: replay recorded input as a repeatable benchmark
+    // Both need a window and a GPU device; on display-less CI machines, record/replay
+    // is exercised by `simulacrum_bench --scenario input_replay` instead
+    // --deterministic <seed>: fixed tick and seeded randomness, for reproducible runs
+    // --state-hashes <file>:  write the state hash of every tick, to diff two runs
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--record") == 0 && i + 1 < argc) {
+            app.setInputRecording(argv[++i]);
+        } else if (strcmp(argv[i], "--replay") == 0 && i + 1 < argc) {
+            app.setInputReplay(argv[++i]);
+        } else if (strcmp(argv[i], "--deterministic") == 0 && i + 1 < argc) {
+            app.setDeterministic(strtoull(argv[++i], nullptr, 0));
+        } else if (strcmp(argv[i], "--state-hashes") == 0 && i + 1 < argc) {
+            app.setStateHashLog(argv[++i]);
+        } else {
+            spdlog::warn("Ignoring unknown argument '{}'.", argv[i]);
+        }
+    }
+
     app.run();
     return 0;
 }
@@ -0,0 +1,144 @@
+// Asset packer: bundles a directory tree into a single .pak archive readable by
+// engine::resource::AssetPack.
+//
+// Usage: asset_packer <output.pak> <input_dir> [<input_dir> ...]
+//
+// Entry paths are stored relative to the current working directory with forward
+// slashes, so running `asset_packer assets.pak assets` from the project root stores
+// "assets/textures/..." exactly as the game requests them.
+
+#include "engine/resource/asset_pack.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+using engine::resource::AssetPack;
+
+namespace {
+
+    struct PendingEntry {
+        fs::path source;
+        std::string path;
+        AssetPack::EntryRecord record{};
+    };
+
+    void writePadding(std::ofstream& out, std::uint64_t& position, std::uint32_t alignment) {
+        static const char zeros[AssetPack::DEFAULT_ALIGNMENT] = {};
+        std::uint64_t aligned = (position + alignment - 1) / alignment * alignment;
+        out.write(zeros, static_cast<std::streamsize>(aligned - position));
+        position = aligned;
+    }
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    if (argc < 3) {
+        std::cerr << "Usage: " << argv[0] << " <output.pak> <input_dir> [<input_dir> ...]\n";
+        return 1;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    fs::path output_path = argv[1];
+
+    std::vector<PendingEntry> entries;
+    for (int i = 2; i < argc; ++i) {
+        fs::path input = argv[i];
+        if (!fs::is_directory(input)) {
+            std::cerr << "Input '" << input.string() << "' is not a directory.\n";
+            return 1;
+        }
+
+        for (const auto& item : fs::recursive_directory_iterator(input)) {
+            // Skip the output itself when packing into one of the input directories
+            std::error_code ec;
+            if (!item.is_regular_file() || fs::equivalent(item.path(), output_path, ec)) {
+                continue;
+            }
+
+            PendingEntry entry;
+            entry.source = item.path();
+            entry.path = item.path().lexically_normal().generic_string();
+            entries.push_back(std::move(entry));
+        }
+    }
+
+    // Sorted so that identical inputs always produce identical packs
+    std::sort(entries.begin(), entries.end(), [](const PendingEntry& a, const PendingEntry& b) {
+        return a.path < b.path;
+    });
+
+    std::ofstream out(output_path, std::ios::binary | std::ios::trunc);
+    if (!out.is_open()) {
+        std::cerr << "Unable to open '" << output_path.string() << "' for writing.\n";
+        return 1;
+    }
+
+    AssetPack::Header header{};
+    std::memcpy(header.magic, AssetPack::MAGIC, sizeof(header.magic));
+    header.version = AssetPack::VERSION;
+    header.entry_count = static_cast<std::uint32_t>(entries.size());
+    header.alignment = AssetPack::DEFAULT_ALIGNMENT;
+
+    // Placeholder header, rewritten once the table of contents position is known
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    std::uint64_t position = sizeof(header);
+
+    std::vector<char> buffer;
+    std::uint64_t total_bytes = 0;
+
+    for (auto& entry : entries) {
+        std::ifstream in(entry.source, std::ios::binary | std::ios::ate);
+        if (!in.is_open()) {
+            std::cerr << "Unable to read '" << entry.source.string() << "'.\n";
+            return 1;
+        }
+
+        auto size = static_cast<std::uint64_t>(in.tellg());
+        in.seekg(0);
+        buffer.resize(size);
+        in.read(buffer.data(), static_cast<std::streamsize>(size));
+
+        writePadding(out, position, header.alignment);
+
+        // Entries are stored uncompressed so that they can be decoded in place from
+        // the mapping; the compression field is reserved in the format for later use
+        entry.record.offset = position;
+        entry.record.size = size;
+        entry.record.original_size = size;
+        entry.record.compression = static_cast<std::uint32_t>(AssetPack::Compression::NONE);
+        entry.record.path_length = static_cast<std::uint32_t>(entry.path.size());
+
+        out.write(buffer.data(), static_cast<std::streamsize>(size));
+        position += size;
+        total_bytes += size;
+    }
+
+    writePadding(out, position, header.alignment);
+    header.toc_offset = position;
+
+    for (const auto& entry : entries) {
+        out.write(reinterpret_cast<const char*>(&entry.record), sizeof(entry.record));
+        out.write(entry.path.data(), static_cast<std::streamsize>(entry.path.size()));
+        position += sizeof(entry.record) + entry.path.size();
+    }
+
+    header.toc_size = position - header.toc_offset;
+    out.seekp(0);
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    if (!out) {
+        std::cerr << "Error writing '" << output_path.string() << "'.\n";
+        return 1;
+    }
+
+    auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start);
+    std::cout << "Packed " << entries.size() << " assets (" << total_bytes << " bytes) into '"
+              << output_path.string() << "' in " << elapsed.count() << " ms.\n";
+    return 0;
+}
@@ -0,0 +1,80 @@
+#include "alloc_counter.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#ifdef _WIN32
+    #include <malloc.h>
+#endif
+
+// Replacing the global allocation functions counts every heap allocation made by the
+// engine, its dependencies' C++ code and the standard library, without instrumenting them.
+// malloc() calls made directly from C libraries (SDL, decoders) are not seen.
+
+namespace {
+
+    std::atomic<std::uint64_t> allocation_count{0};
+    std::atomic<std::uint64_t> allocation_bytes{0};
+
+    void* allocate(std::size_t size) {
+        allocation_count.fetch_add(1, std::memory_order_relaxed);
+        allocation_bytes.fetch_add(size, std::memory_order_relaxed);
+
+        if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+            return ptr;
+        }
+        throw std::bad_alloc();
+    }
+
+    void* allocateAligned(std::size_t size, std::align_val_t alignment) {
+        allocation_count.fetch_add(1, std::memory_order_relaxed);
+        allocation_bytes.fetch_add(size, std::memory_order_relaxed);
+
+        auto align = static_cast<std::size_t>(alignment);
+#ifdef _WIN32
+        void* ptr = _aligned_malloc(size == 0 ? 1 : size, align);
+#else
+        // aligned_alloc requires the size to be a multiple of the alignment
+        std::size_t rounded = (size + align - 1) / align * align;
+        void* ptr = std::aligned_alloc(align, rounded == 0 ? align : rounded);
+#endif
+        if (ptr) {
+            return ptr;
+        }
+        throw std::bad_alloc();
+    }
+
+    void freeAligned(void* ptr) {
+#ifdef _WIN32
+        _aligned_free(ptr);
+#else
+        std::free(ptr);
+#endif
+    }
+
+} // namespace
+
+namespace bench {
+
+    AllocationCounts getAllocationCounts() {
+        return {
+            allocation_count.load(std::memory_order_relaxed),
+            allocation_bytes.load(std::memory_order_relaxed)
+        };
+    }
+
+} // namespace bench
+
+void* operator new(std::size_t size) { return allocate(size); }
+void* operator new[](std::size_t size) { return allocate(size); }
+void* operator new(std::size_t size, std::align_val_t alignment) { return allocateAligned(size, alignment); }
+void* operator new[](std::size_t size, std::align_val_t alignment) { return allocateAligned(size, alignment); }
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::align_val_t) noexcept { freeAligned(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept { freeAligned(ptr); }
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept { freeAligned(ptr); }
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept { freeAligned(ptr); }
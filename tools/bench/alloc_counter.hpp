@@ -0,0 +1,19 @@
+#ifndef BENCH_ALLOC_COUNTER_HPP_
+#define BENCH_ALLOC_COUNTER_HPP_
+
+#include <cstdint>
+
+namespace bench {
+
+    /// @brief Totals kept by the bench's replacement global operator new, across all threads.
+    struct AllocationCounts {
+        std::uint64_t count = 0;
+        std::uint64_t bytes = 0;
+    };
+
+    /// @brief Allocations made so far; subtract two snapshots to measure a span of code.
+    AllocationCounts getAllocationCounts();
+
+} // namespace bench
+
+#endif // BENCH_ALLOC_COUNTER_HPP_
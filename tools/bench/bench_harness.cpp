@@ -0,0 +1,319 @@
+#include "bench_harness.hpp"
+#include "alloc_counter.hpp"
+#include "scenario.hpp"
+#include "engine/core/config.hpp"
+#include "engine/core/context.hpp"
+#include "engine/core/game_state.hpp"
+#include "engine/resource/resource_manager.hpp"
+#include "engine/audio/audio_player.hpp"
+#include "engine/audio/sound_event_bus.hpp"
+#include "engine/render/renderer.hpp"
+#include "engine/render/camera.hpp"
+#include "engine/render/text_renderer.hpp"
+#include "engine/input/input_manager.hpp"
+#include "engine/physics/physics_engine.hpp"
+#include "engine/scene/scene_manager.hpp"
+#include "engine/ui/ui_manager.hpp"
+#include "engine/utils/frame_arena.hpp"
+#include "engine/utils/random.hpp"
+#include <SDL3/SDL.h>
+#include <algorithm>
+#include <nlohmann/json.hpp>
+#include <spdlog/spdlog.h>
+#include <stdexcept>
+#include <vector>
+
+namespace bench {
+
+    namespace {
+
+        constexpr const char* PHASE_NAMES[] = {"input", "handle_input", "update", "render", "end_frame"};
+
+        /// @brief Summary of per-frame samples in microseconds.
+        nlohmann::ordered_json summarize(std::vector<double> samples_us) {
+            nlohmann::ordered_json summary;
+            if (samples_us.empty()) {
+                return summary;
+            }
+
+            std::sort(samples_us.begin(), samples_us.end());
+            auto percentile = [&samples_us](double p) {
+                auto index = static_cast<std::size_t>(p * static_cast<double>(samples_us.size() - 1) + 0.5);
+                return samples_us[index];
+            };
+
+            double total = 0.0;
+            for (double sample : samples_us) {
+                total += sample;
+            }
+
+            summary["mean_us"] = total / static_cast<double>(samples_us.size());
+            summary["p50_us"] = percentile(0.50);
+            summary["p95_us"] = percentile(0.95);
+            summary["p99_us"] = percentile(0.99);
+            summary["max_us"] = samples_us.back();
+            return summary;
+        }
+
+    } // namespace
+
+    // --- BenchScene ---
+
+    BenchScene::BenchScene(
+        engine::core::Context& context,
+        engine::scene::SceneManager& scene_manager,
+        BenchHarness& harness,
+        Scenario& scenario
+    )
+        : engine::scene::Scene(scenario.getName(), context, scene_manager)
+        , harness_(harness)
+        , scenario_(scenario)
+    {}
+
+    void BenchScene::init() {
+        if (is_initialized_) {
+            return;
+        }
+
+        if (!ui_manager_->init(context_.getGameState().getLogicalSize())) {
+            return;
+        }
+
+        scenario_.populate(harness_, *this);
+        Scene::init();
+    }
+
+    void BenchScene::update(float delta_time) {
+        Scene::update(delta_time);
+        scenario_.update(harness_, delta_time);
+    }
+
+    // --- BenchHarness ---
+
+    BenchHarness::BenchHarness(const Options& options) : delta_time_(options.delta_time) {
+        // No display or sound card on CI machines: everything goes to SDL's dummy drivers
+        SDL_SetHint(SDL_HINT_VIDEO_DRIVER, "dummy");
+        SDL_SetHint(SDL_HINT_AUDIO_DRIVER, "dummy");
+
+        if (!SDL_Init(SDL_INIT_VIDEO | SDL_INIT_AUDIO)) {
+            throw std::runtime_error("BenchHarness: SDL initialization failed: " + std::string(SDL_GetError()));
+        }
+
+        try {
+            config_ = std::make_unique<engine::core::Config>(options.config_path);
+
+            // The software renderer draws into a surface instead of a window
+            surface_ = SDL_CreateSurface(config_->window_width_, config_->window_height_, SDL_PIXELFORMAT_ARGB8888);
+            if (!surface_) {
+                throw std::runtime_error("BenchHarness: unable to create render surface: " + std::string(SDL_GetError()));
+            }
+
+            sdl_renderer_ = SDL_CreateSoftwareRenderer(surface_);
+            if (!sdl_renderer_) {
+                throw std::runtime_error("BenchHarness: unable to create software renderer: " + std::string(SDL_GetError()));
+            }
+
+            SDL_SetRenderLogicalPresentation(
+                sdl_renderer_,
+                config_->window_width_,
+                config_->window_height_,
+                SDL_LOGICAL_PRESENTATION_LETTERBOX
+            );
+
+            resource_manager_ = std::make_unique<engine::resource::ResourceManager>(sdl_renderer_);
+            resource_manager_->setTextureBudget(static_cast<std::size_t>(config_->texture_budget_mb_) * 1024 * 1024);
+
+            audio_player_ = std::make_unique<engine::audio::AudioPlayer>(
+                resource_manager_->getAssetLocator(),
+                config_->music_volume_,
+                config_->sound_volume_,
+                engine::audio::AudioPlayer::DEFAULT_VOICE_COUNT,
+                config_->software_mixer_
+            );
+            sound_event_bus_ = std::make_unique<engine::audio::SoundEventBus>(*audio_player_);
+
+            renderer_ = std::make_unique<engine::render::Renderer>(sdl_renderer_, resource_manager_.get());
+            camera_ = std::make_unique<engine::render::Camera>(
+                glm::vec2(config_->window_width_ / 2, config_->window_height_ / 2)
+            );
+            text_renderer_ = std::make_unique<engine::render::TextRenderer>(sdl_renderer_, resource_manager_.get());
+            input_manager_ = std::make_unique<engine::input::InputManager>(sdl_renderer_, config_.get());
+            game_state_ = std::make_unique<engine::core::GameState>(nullptr, sdl_renderer_);
+            frame_arena_ = std::make_unique<engine::utils::FrameArena>();
+            random_ = std::make_unique<engine::utils::Random>();
+            physics_engine_ = std::make_unique<engine::physics::PhysicsEngine>();
+
+            context_ = std::make_unique<engine::core::Context>(
+                *input_manager_,
+                *renderer_,
+                *camera_,
+                *text_renderer_,
+                *resource_manager_,
+                *physics_engine_,
+                *audio_player_,
+                *sound_event_bus_,
+                *game_state_,
+                *frame_arena_,
+                *random_
+            );
+            scene_manager_ = std::make_unique<engine::scene::SceneManager>(*context_);
+        }
+
+        catch (...) {
+            close();
+            throw;
+        }
+    }
+
+    BenchHarness::~BenchHarness() {
+        close();
+    }
+
+    nlohmann::ordered_json BenchHarness::run(Scenario& scenario, int frames, int warmup_frames) {
+        spdlog::info("Running scenario '{}' ({} frames, {} warm-up).", scenario.getName(), frames, warmup_frames);
+
+        // The push is applied, and the scene populated, at the end of the first frame
+        auto scene = scenario.createScene(*this);
+        if (!scene) {
+            scene = std::make_unique<BenchScene>(*context_, *scene_manager_, *this, scenario);
+        }
+        scene_manager_->requestPushScene(std::move(scene));
+
+        std::uint64_t phase_ns[PHASE_COUNT] = {};
+        frame(phase_ns);
+        scene_ = scene_manager_->getCurrentScene();
+
+        int frame_index = 0;
+        for (int i = 0; i < warmup_frames; ++i) {
+            scenario.beforeFrame(*this, frame_index++);
+            frame(phase_ns);
+        }
+
+        std::vector<double> phase_samples[PHASE_COUNT];
+        std::vector<double> frame_samples;
+        for (auto& samples : phase_samples) {
+            samples.reserve(static_cast<std::size_t>(frames));
+        }
+        frame_samples.reserve(static_cast<std::size_t>(frames));
+
+        AllocationCounts allocations_before = getAllocationCounts();
+        std::uint64_t start_ns = SDL_GetTicksNS();
+
+        for (int i = 0; i < frames; ++i) {
+            scenario.beforeFrame(*this, frame_index++);
+            frame(phase_ns);
+
+            std::uint64_t frame_ns = 0;
+            for (int phase = 0; phase < PHASE_COUNT; ++phase) {
+                phase_samples[phase].push_back(static_cast<double>(phase_ns[phase]) / 1000.0);
+                frame_ns += phase_ns[phase];
+            }
+            frame_samples.push_back(static_cast<double>(frame_ns) / 1000.0);
+        }
+
+        double wall_ms = static_cast<double>(SDL_GetTicksNS() - start_ns) / 1000000.0;
+        AllocationCounts allocations_after = getAllocationCounts();
+
+        nlohmann::ordered_json result;
+        result["name"] = scenario.getName();
+        result["description"] = scenario.getDescription();
+        result["frames"] = frames;
+        result["warmup_frames"] = warmup_frames;
+        result["wall_ms"] = wall_ms;
+        result["frames_per_second"] = wall_ms > 0.0 ? frames * 1000.0 / wall_ms : 0.0;
+
+        result["frame"] = summarize(std::move(frame_samples));
+        for (int phase = 0; phase < PHASE_COUNT; ++phase) {
+            result["phases"][PHASE_NAMES[phase]] = summarize(std::move(phase_samples[phase]));
+        }
+
+        std::uint64_t allocation_count = allocations_after.count - allocations_before.count;
+        std::uint64_t allocation_bytes = allocations_after.bytes - allocations_before.bytes;
+        result["allocations"]["count"] = allocation_count;
+        result["allocations"]["bytes"] = allocation_bytes;
+        result["allocations"]["per_frame"] = frames > 0 ? static_cast<double>(allocation_count) / frames : 0.0;
+        result["allocations"]["expected_zero"] = scenario.expectsZeroAllocations();
+
+        result["frame_arena"]["capacity_bytes"] = frame_arena_->getCapacity();
+        result["frame_arena"]["peak_bytes"] = frame_arena_->getPeak();
+        result["frame_arena"]["overflows"] = frame_arena_->getOverflowCount();
+
+        nlohmann::ordered_json metrics = nlohmann::ordered_json::object();
+        scenario.report(*this, metrics);
+        result["metrics"] = std::move(metrics);
+        return result;
+    }
+
+    void BenchHarness::frame(std::uint64_t (&phase_ns)[PHASE_COUNT]) {
+        std::uint64_t t0 = SDL_GetTicksNS();
+        frame_arena_->reset();
+
+        input_manager_->update();
+
+        std::uint64_t t1 = SDL_GetTicksNS();
+        scene_manager_->handleInput();
+
+        std::uint64_t t2 = SDL_GetTicksNS();
+        scene_manager_->update(delta_time_);
+        sound_event_bus_->flush(delta_time_);
+
+        std::uint64_t t3 = SDL_GetTicksNS();
+        renderer_->clearScreen();
+        scene_manager_->render();
+        renderer_->present();
+
+        std::uint64_t t4 = SDL_GetTicksNS();
+        resource_manager_->endFrame();
+
+        std::uint64_t t5 = SDL_GetTicksNS();
+        phase_ns[INPUT] = t1 - t0;
+        phase_ns[HANDLE_INPUT] = t2 - t1;
+        phase_ns[UPDATE] = t3 - t2;
+        phase_ns[RENDER] = t4 - t3;
+        phase_ns[END_FRAME] = t5 - t4;
+    }
+
+    void BenchHarness::close() {
+        // Same teardown order as GameApp::close()
+        if (scene_manager_) {
+            scene_manager_->close();
+            scene_ = nullptr;
+        }
+
+        if (audio_player_) {
+            audio_player_->close();
+        }
+
+        if (resource_manager_) {
+            resource_manager_->clear();
+        }
+
+        scene_manager_.reset();
+        context_.reset();
+        physics_engine_.reset();
+        random_.reset();
+        frame_arena_.reset();
+        game_state_.reset();
+        input_manager_.reset();
+        text_renderer_.reset();
+        camera_.reset();
+        renderer_.reset();
+        sound_event_bus_.reset();
+        audio_player_.reset();
+        resource_manager_.reset();
+        config_.reset();
+
+        if (sdl_renderer_) {
+            SDL_DestroyRenderer(sdl_renderer_);
+            sdl_renderer_ = nullptr;
+        }
+
+        if (surface_) {
+            SDL_DestroySurface(surface_);
+            surface_ = nullptr;
+        }
+
+        SDL_Quit();
+    }
+
+} // namespace bench
@@ -0,0 +1,146 @@
+#ifndef BENCH_HARNESS_HPP_
+#define BENCH_HARNESS_HPP_
+
+#include "engine/scene/scene.hpp"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <nlohmann/json_fwd.hpp>
+
+struct SDL_Surface;
+struct SDL_Renderer;
+
+namespace engine::core {
+    class Config;
+    class Context;
+    class GameState;
+}
+
+namespace engine::resource {
+    class ResourceManager;
+}
+
+namespace engine::render {
+    class Renderer;
+    class Camera;
+    class TextRenderer;
+}
+
+namespace engine::input {
+    class InputManager;
+}
+
+namespace engine::audio {
+    class AudioPlayer;
+    class SoundEventBus;
+}
+
+namespace engine::ui {
+    class UIManager;
+}
+
+namespace engine::physics {
+    class PhysicsEngine;
+}
+
+namespace engine::utils {
+    class FrameArena;
+    class Random;
+}
+
+namespace bench {
+    class Scenario;
+
+    class BenchHarness;
+
+    /// @brief Scene run by the bench; forwards init and update to its scenario.
+    class BenchScene final : public engine::scene::Scene {
+    public:
+        BenchScene(
+            engine::core::Context& context,
+            engine::scene::SceneManager& scene_manager,
+            BenchHarness& harness,
+            Scenario& scenario
+        );
+
+        void init() override;
+        void update(float delta_time) override;
+
+        engine::ui::UIManager& getUIManager() const { return *ui_manager_; }
+
+    private:
+        BenchHarness& harness_;
+        Scenario& scenario_;
+    };
+
+    /// @brief Boots the engine modules against SDL's dummy video and audio drivers and an
+    /// offscreen software renderer, so scenarios run without a window, display or GPU.
+    ///
+    /// Each harness runs one scenario on a fresh engine; frames use a fixed delta time
+    /// so runs are comparable across machines. Construction failure will throw an exception.
+    class BenchHarness final {
+    public:
+        struct Options {
+            std::string config_path = "assets/config.json";
+            float delta_time = 1.0f / 60.0f;
+        };
+
+        explicit BenchHarness(const Options& options);
+        ~BenchHarness();
+
+        BenchHarness(const BenchHarness&) = delete;
+        BenchHarness& operator=(const BenchHarness&) = delete;
+        BenchHarness(BenchHarness&&) = delete;
+        BenchHarness& operator=(BenchHarness&&) = delete;
+
+        /// @brief Set the scenario up, run `warmup_frames` untimed frames, then time
+        /// `frames` frames. Returns the scenario's results as JSON.
+        nlohmann::ordered_json run(Scenario& scenario, int frames, int warmup_frames);
+
+        float getDeltaTime() const { return delta_time_; }
+        engine::core::Context& getContext() const { return *context_; }
+        engine::core::Config& getConfig() const { return *config_; }
+        engine::scene::SceneManager& getSceneManager() const { return *scene_manager_; }
+        /// @brief The scenario's scene; null before run() has initialized it.
+        engine::scene::Scene* getScene() const { return scene_; }
+
+    private:
+        enum Phase {
+            INPUT,
+            HANDLE_INPUT,
+            UPDATE,
+            RENDER,
+            END_FRAME,
+            PHASE_COUNT,
+        };
+
+        float delta_time_;
+
+        SDL_Surface* surface_ = nullptr;
+        SDL_Renderer* sdl_renderer_ = nullptr;
+
+        std::unique_ptr<engine::core::Config> config_;
+        std::unique_ptr<engine::resource::ResourceManager> resource_manager_;
+        std::unique_ptr<engine::audio::AudioPlayer> audio_player_;
+        std::unique_ptr<engine::audio::SoundEventBus> sound_event_bus_;
+        std::unique_ptr<engine::render::Renderer> renderer_;
+        std::unique_ptr<engine::render::Camera> camera_;
+        std::unique_ptr<engine::render::TextRenderer> text_renderer_;
+        std::unique_ptr<engine::input::InputManager> input_manager_;
+        std::unique_ptr<engine::core::GameState> game_state_;
+        std::unique_ptr<engine::utils::FrameArena> frame_arena_;
+        std::unique_ptr<engine::utils::Random> random_;
+        std::unique_ptr<engine::physics::PhysicsEngine> physics_engine_;
+        std::unique_ptr<engine::core::Context> context_;
+        std::unique_ptr<engine::scene::SceneManager> scene_manager_;
+
+        engine::scene::Scene* scene_ = nullptr;
+
+        /// @brief Run one frame in the order GameApp does, timing each phase in ns.
+        void frame(std::uint64_t (&phase_ns)[PHASE_COUNT]);
+        void close();
+    };
+
+} // namespace bench
+
+#endif // BENCH_HARNESS_HPP_
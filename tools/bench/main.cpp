@@ -0,0 +1,125 @@
+// Headless benchmark runner: boots the engine against SDL's dummy drivers and an
+// offscreen software renderer, runs scripted scenarios and writes the results as JSON.
+//
+// Usage: simulacrum_bench [--frames N] [--warmup N] [--scenario name]... [--output file.json] [--list]
+//
+// Run from the directory holding assets/ (the build copies it next to the executable).
+// Without --output the JSON goes to stdout; engine logging goes to stderr and is
+// limited to warnings. Exits non-zero if a scenario fails, including a scenario
+// expected to run without heap allocations (title_scene) that allocates and one whose
+// own checks fail (e.g. physics_scaling or lockstep diverging from their reference run,
+// tilemap rebuilding chunks that did not change).
+
+#include "bench_harness.hpp"
+#include "scenario.hpp"
+#include "engine/utils/cpu_features.hpp"
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <nlohmann/json.hpp>
+#include <spdlog/spdlog.h>
+#include <spdlog/sinks/stdout_color_sinks.h>
+#include <string>
+#include <vector>
+
+int main(int argc, char* argv[]) {
+    int frames = 600;
+    int warmup_frames = 60;
+    std::vector<std::string> selected;
+    std::string output_path;
+
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc) {
+            frames = std::atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--warmup") == 0 && i + 1 < argc) {
+            warmup_frames = std::atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--scenario") == 0 && i + 1 < argc) {
+            selected.emplace_back(argv[++i]);
+        } else if (strcmp(argv[i], "--output") == 0 && i + 1 < argc) {
+            output_path = argv[++i];
+        } else if (strcmp(argv[i], "--list") == 0) {
+            for (const auto& scenario : bench::createScenarios()) {
+                std::cout << scenario->getName() << "\t" << scenario->getDescription() << "\n";
+            }
+            return 0;
+        } else {
+            std::cerr << "Unknown argument '" << argv[i] << "'.\n";
+            return 1;
+        }
+    }
+
+    if (frames <= 0 || warmup_frames < 0) {
+        std::cerr << "--frames must be positive and --warmup non-negative.\n";
+        return 1;
+    }
+
+    // Logs go to stderr so that stdout carries nothing but the JSON
+    spdlog::set_default_logger(spdlog::stderr_color_mt("bench"));
+    spdlog::set_level(spdlog::level::warn);
+
+    if (auto missing = engine::utils::getMissingCpuFeatures(); !missing.empty()) {
+        spdlog::error("This build requires CPU features this machine lacks: {}.", missing);
+        return 1;
+    }
+
+    nlohmann::ordered_json report;
+    report["engine"] = "Simulacrum";
+    report["platform"] = SDL_GetPlatform();
+    report["cpu_cores"] = SDL_GetNumLogicalCPUCores();
+    report["frames"] = frames;
+    report["warmup_frames"] = warmup_frames;
+    report["scenarios"] = nlohmann::ordered_json::array();
+
+    bool failed = false;
+    for (const auto& scenario : bench::createScenarios()) {
+        if (!selected.empty() && std::find(selected.begin(), selected.end(), scenario->getName()) == selected.end()) {
+            continue;
+        }
+
+        // Every scenario gets a fresh engine, so none inherits another's caches
+        try {
+            bench::BenchHarness harness(bench::BenchHarness::Options{});
+            auto result = harness.run(*scenario, frames, warmup_frames);
+
+            std::uint64_t allocations = result["allocations"]["count"];
+            if (scenario->expectsZeroAllocations() && allocations != 0) {
+                spdlog::error("Scenario '{}' made {} heap allocations in steady state; expected none.", scenario->getName(), allocations);
+                failed = true;
+            }
+
+            if (std::string problem = scenario->check(harness); !problem.empty()) {
+                spdlog::error("Scenario '{}' failed its check: {}", scenario->getName(), problem);
+                failed = true;
+            }
+            report["scenarios"].push_back(std::move(result));
+        }
+
+        catch (const std::exception& exc) {
+            spdlog::error("Scenario '{}' failed: {}", scenario->getName(), exc.what());
+            failed = true;
+        }
+    }
+
+    if (report["scenarios"].empty() && !failed) {
+        std::cerr << "No scenario matched; use --list to see them.\n";
+        return 1;
+    }
+
+    if (output_path.empty()) {
+        std::cout << report.dump(2) << "\n";
+    } else {
+        std::ofstream out(output_path, std::ios::trunc);
+        if (!out.is_open()) {
+            std::cerr << "Unable to open '" << output_path << "' for writing.\n";
+            return 1;
+        }
+        out << report.dump(2) << "\n";
+    }
+
+    return failed ? 1 : 0;
+}
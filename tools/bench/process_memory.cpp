@@ -0,0 +1,47 @@
+#include "process_memory.hpp"
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#include <psapi.h>
+#elif defined(__APPLE__)
+#include <mach/mach.h>
+#elif defined(__linux__)
+#include <cstdio>
+#include <unistd.h>
+#endif
+
+namespace bench {
+
+    std::uint64_t getResidentBytes() {
+#if defined(_WIN32)
+        PROCESS_MEMORY_COUNTERS counters{};
+        if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+            return counters.WorkingSetSize;
+        }
+        return 0;
+#elif defined(__APPLE__)
+        mach_task_basic_info_data_t info{};
+        mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+        if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, reinterpret_cast<task_info_t>(&info), &count) == KERN_SUCCESS) {
+            return info.resident_size;
+        }
+        return 0;
+#elif defined(__linux__)
+        // Second field of statm: resident pages
+        std::FILE* statm = std::fopen("/proc/self/statm", "r");
+        if (!statm) {
+            return 0;
+        }
+
+        unsigned long long total_pages = 0;
+        unsigned long long resident_pages = 0;
+        int fields = std::fscanf(statm, "%llu %llu", &total_pages, &resident_pages);
+        std::fclose(statm);
+        return fields == 2 ? resident_pages * static_cast<std::uint64_t>(sysconf(_SC_PAGESIZE)) : 0;
+#else
+        return 0;
+#endif
+    }
+
+} // namespace bench
@@ -0,0 +1,13 @@
+#ifndef BENCH_PROCESS_MEMORY_HPP_
+#define BENCH_PROCESS_MEMORY_HPP_
+
+#include <cstdint>
+
+namespace bench {
+
+    /// @brief Resident set size of the bench process in bytes; 0 where it cannot be read.
+    std::uint64_t getResidentBytes();
+
+} // namespace bench
+
+#endif // BENCH_PROCESS_MEMORY_HPP_
@@ -0,0 +1,50 @@
+#ifndef BENCH_SCENARIO_HPP_
+#define BENCH_SCENARIO_HPP_
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <nlohmann/json_fwd.hpp>
+
+namespace engine::scene {
+    class Scene;
+}
+
+namespace bench {
+    class BenchHarness;
+    class BenchScene;
+
+    /// @brief A scripted workload run by the bench for a number of frames.
+    class Scenario {
+    public:
+        virtual ~Scenario() = default;
+
+        virtual std::string_view getName() const = 0;
+        virtual std::string_view getDescription() const = 0;
+
+        /// @brief Scene to run instead of a BenchScene, e.g. one of the game's own scenes.
+        virtual std::unique_ptr<engine::scene::Scene> createScene(BenchHarness& /*harness*/) { return nullptr; }
+        /// @brief Fill a BenchScene in. Called from its init(), with its resource scope active.
+        virtual void populate(BenchHarness& /*harness*/, BenchScene& /*scene*/) {}
+        /// @brief Script the frame (queue events, move the camera...). Not timed.
+        virtual void beforeFrame(BenchHarness& /*harness*/, int /*frame*/) {}
+        /// @brief Work of the frame that is not done by the scene's objects. Timed as
+        /// part of the update phase.
+        virtual void update(BenchHarness& /*harness*/, float /*delta_time*/) {}
+        /// @brief Whether steady-state frames must not touch the global heap. The bench
+        /// fails when such a scenario allocates after its warm-up.
+        virtual bool expectsZeroAllocations() const { return false; }
+        /// @brief Add the scenario's own counters and throughput figures.
+        virtual void report(BenchHarness& /*harness*/, nlohmann::ordered_json& /*metrics*/) {}
+        /// @brief What the scenario's own checks found wrong during the run; anything but
+        /// an empty string fails the bench.
+        virtual std::string check(BenchHarness& /*harness*/) { return {}; }
+    };
+
+    /// @brief All scenarios, in the order they run by default.
+    std::vector<std::unique_ptr<Scenario>> createScenarios();
+
+} // namespace bench
+
+#endif // BENCH_SCENARIO_HPP_
@@ -0,0 +1,2648 @@
+#include "scenario.hpp"
+#include "bench_harness.hpp"
+#include "process_memory.hpp"
+#include "engine/core/config.hpp"
+#include "engine/core/context.hpp"
+#include "engine/resource/asset_pack.hpp"
+#include "engine/resource/resource_manager.hpp"
+#include "engine/audio/audio_player.hpp"
+#include "engine/audio/mixer.hpp"
+#include "engine/audio/sound_event_bus.hpp"
+#include "engine/render/camera.hpp"
+#include "engine/render/renderer.hpp"
+#include "engine/render/tilemap.hpp"
+#include "engine/render/upload_ring_allocator.hpp"
+#include "engine/input/input_manager.hpp"
+#include "engine/input/input_recording.hpp"
+#include "engine/object/game_object.hpp"
+#include "engine/object/components/transform_component.hpp"
+#include "engine/object/components/parallax_component.hpp"
+#include "engine/object/components/sprite_component.hpp"
+#include "engine/object/components/tilemap_component.hpp"
+#include "engine/object/components/physics_component.hpp"
+#include "engine/physics/broadphase.hpp"
+#include "engine/physics/physics_engine.hpp"
+#include "engine/scene/scene_manager.hpp"
+#include "engine/scene/scene_snapshot.hpp"
+#include "engine/ui/ui_manager.hpp"
+#include "engine/ui/ui_button.hpp"
+#include "engine/utils/frame_arena.hpp"
+#include "engine/utils/hash.hpp"
+#include "engine/utils/random.hpp"
+#include "game/scene/title_scene.hpp"
+#include <SDL3/SDL.h>
+#include <SDL3_image/SDL_image.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <memory_resource>
+#include <nlohmann/json.hpp>
+#include <numbers>
+#include <unordered_set>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace bench {
+
+    namespace {
+
+        constexpr const char* BUTTON_NORMAL = "assets/textures/ui/Start1.png";
+        constexpr const char* BUTTON_HOVER = "assets/textures/ui/Start2.png";
+        constexpr const char* BUTTON_PRESSED = "assets/textures/ui/Start3.png";
+
+        /// @brief Small deterministic generator, so every run scripts the same frames.
+        class Lcg final {
+        public:
+            explicit Lcg(std::uint32_t seed) : state_(seed) {}
+
+            std::uint32_t next() {
+                state_ = state_ * 1664525u + 1013904223u;
+                return state_ >> 8;
+            }
+
+            float nextFloat(float max) {
+                return static_cast<float>(next() & 0xFFFF) / 65535.0f * max;
+            }
+
+        private:
+            std::uint32_t state_;
+        };
+
+        /// @brief Directory for assets generated by the scenarios.
+        fs::path generatedAssetDir() {
+            fs::path dir = fs::temp_directory_path() / "simulacrum_bench";
+            fs::create_directories(dir);
+            return dir;
+        }
+
+        /// @brief Write a solid-colour BMP that the texture manager can load.
+        std::string writeTexture(const fs::path& dir, int index, int size) {
+            std::string path = (dir / ("texture_" + std::to_string(index) + ".bmp")).generic_string();
+            if (fs::exists(path)) {
+                return path;
+            }
+
+            SDL_Surface* surface = SDL_CreateSurface(size, size, SDL_PIXELFORMAT_ARGB8888);
+            if (surface) {
+                SDL_FillSurfaceRect(surface, nullptr, SDL_MapSurfaceRGB(surface, index * 37, index * 91, index * 13));
+                SDL_SaveBMP(surface, path.c_str());
+                SDL_DestroySurface(surface);
+            }
+            return path;
+        }
+
+        /// @brief Write a mono 16-bit PCM sine tone as a WAV file.
+        std::string writeTone(const fs::path& dir, int index, float frequency, float seconds) {
+            std::string path = (dir / ("tone_" + std::to_string(index) + ".wav")).generic_string();
+            if (fs::exists(path)) {
+                return path;
+            }
+
+            constexpr std::uint32_t SAMPLE_RATE = 22050;
+            auto frames = static_cast<std::uint32_t>(seconds * SAMPLE_RATE);
+            std::vector<std::int16_t> samples(frames);
+            for (std::uint32_t i = 0; i < frames; ++i) {
+                float phase = 2.0f * std::numbers::pi_v<float> * frequency * static_cast<float>(i) / SAMPLE_RATE;
+                samples[i] = static_cast<std::int16_t>(std::sin(phase) * 8000.0f);
+            }
+
+            auto put32 = [](std::ofstream& out, std::uint32_t value) { out.write(reinterpret_cast<const char*>(&value), 4); };
+            auto put16 = [](std::ofstream& out, std::uint16_t value) { out.write(reinterpret_cast<const char*>(&value), 2); };
+            std::uint32_t data_size = frames * sizeof(std::int16_t);
+
+            std::ofstream out(path, std::ios::binary | std::ios::trunc);
+            out.write("RIFF", 4);
+            put32(out, 36 + data_size);
+            out.write("WAVEfmt ", 8);
+            put32(out, 16);
+            put16(out, 1);                      // PCM
+            put16(out, 1);                      // Mono
+            put32(out, SAMPLE_RATE);
+            put32(out, SAMPLE_RATE * sizeof(std::int16_t));
+            put16(out, sizeof(std::int16_t));
+            put16(out, 16);
+            out.write("data", 4);
+            put32(out, data_size);
+            out.write(reinterpret_cast<const char*>(samples.data()), data_size);
+            return path;
+        }
+
+        void addSprite(BenchScene& scene, engine::resource::ResourceManager& resource_manager, std::string_view texture_id, glm::vec2 position) {
+            auto object = std::make_unique<engine::object::GameObject>("sprite");
+            object->addComponent<engine::object::components::TransformComponent>(position);
+            object->addComponent<engine::object::components::SpriteComponent>(texture_id, resource_manager);
+            scene.addGameObject(std::move(object));
+        }
+
+        void pushMouseMotion(float x, float y) {
+            SDL_Event event{};
+            event.type = SDL_EVENT_MOUSE_MOTION;
+            event.motion.x = x;
+            event.motion.y = y;
+            SDL_PushEvent(&event);
+        }
+
+        void pushMouseButton(float x, float y, bool down) {
+            SDL_Event event{};
+            event.type = down ? SDL_EVENT_MOUSE_BUTTON_DOWN : SDL_EVENT_MOUSE_BUTTON_UP;
+            event.button.button = SDL_BUTTON_LEFT;
+            event.button.down = down;
+            event.button.x = x;
+            event.button.y = y;
+            SDL_PushEvent(&event);
+        }
+
+        // --- Scenarios ---
+
+        class EmptyScenario final : public Scenario {
+        public:
+            std::string_view getName() const override { return "empty"; }
+            std::string_view getDescription() const override { return "Empty scene; the cost of the frame loop itself."; }
+        };
+
+        /// @brief The game's title scene, with the start button hovered and clicked. Also the
+        /// training workload of profile-guided builds.
+        class TitleSceneScenario final : public Scenario {
+        public:
+            std::string_view getName() const override { return "title_scene"; }
+            std::string_view getDescription() const override { return "The game's title scene with its start button hovered and clicked."; }
+
+            std::unique_ptr<engine::scene::Scene> createScene(BenchHarness& harness) override {
+                return std::make_unique<game::scene::TitleScene>(harness.getContext(), harness.getSceneManager());
+            }
+
+            bool expectsZeroAllocations() const override { return true; }
+
+            void beforeFrame(BenchHarness& harness, int frame) override {
+                // The start button is the first of four centred at 65% of the screen height
+                auto& config = harness.getConfig();
+                float panel_width = 4 * 96.0f + 3 * 20.0f;
+                float x = (static_cast<float>(config.window_width_) - panel_width) / 2.0f + 48.0f;
+                float y = static_cast<float>(config.window_height_) * 0.65f + 16.0f;
+
+                // Cycle: move away, hover, press, release
+                switch (frame % 4) {
+                    case 0:
+                        pushMouseMotion(8.0f, 8.0f);
+                        break;
+                    case 1:
+                        pushMouseMotion(x, y);
+                        break;
+                    case 2:
+                        pushMouseButton(x, y, true);
+                        break;
+                    default:
+                        pushMouseButton(x, y, false);
+                        break;
+                }
+            }
+        };
+
+        /// @brief World sprites spread over several screens while the camera pans across them.
+        /// The world grows with the sprite count, so every variant sees the same density.
+        class SpritesScenario final : public Scenario {
+        public:
+            SpritesScenario(std::string name, int sprite_count)
+                : name_(std::move(name))
+                , description_("World sprites (" + std::to_string(sprite_count) + ") culled and drawn while the camera pans.")
+                , sprite_count_(sprite_count)
+                , world_size_(BASE_WORLD_SIZE * std::sqrt(static_cast<float>(sprite_count) / BASE_SPRITE_COUNT))
+            {}
+
+            std::string_view getName() const override { return name_; }
+            std::string_view getDescription() const override { return description_; }
+
+            void populate(BenchHarness& harness, BenchScene& scene) override {
+                auto& resource_manager = harness.getContext().getResourceManager();
+                Lcg random(1);
+                std::uint64_t start_ns = SDL_GetTicksNS();
+                for (int i = 0; i < sprite_count_; ++i) {
+                    addSprite(scene, resource_manager, BUTTON_NORMAL, {random.nextFloat(world_size_), random.nextFloat(world_size_)});
+                }
+                populate_ns_ = SDL_GetTicksNS() - start_ns;
+            }
+
+            void beforeFrame(BenchHarness& harness, int frame) override {
+                float angle = static_cast<float>(frame) * 0.01f;
+                glm::vec2 center(world_size_ * 0.5f);
+                harness.getContext().getCamera().setPosition(center + glm::vec2(std::cos(angle), std::sin(angle)) * (world_size_ * 0.35f));
+            }
+
+            void report(BenchHarness& /*harness*/, nlohmann::ordered_json& metrics) override {
+                metrics["sprites"] = sprite_count_;
+                metrics["world_size"] = world_size_;
+                metrics["populate_ms"] = static_cast<double>(populate_ns_) / 1.0e6;
+            }
+
+        private:
+            static constexpr int BASE_SPRITE_COUNT = 4000;
+            static constexpr float BASE_WORLD_SIZE = 6000.0f;
+
+            std::string name_;
+            std::string description_;
+            int sprite_count_;
+            float world_size_;
+            std::uint64_t populate_ns_ = 0;
+        };
+
+        /// @brief A 4096x4096 tilemap scrolled across, with pauses during which visible tiles
+        /// are edited. Checks that chunks are rebuilt only when they come into view or change.
+        class TilemapScenario final : public Scenario {
+        public:
+            std::string_view getName() const override { return "tilemap"; }
+            std::string_view getDescription() const override { return "4096x4096 chunked tilemap scrolled and edited; one draw call per frame."; }
+
+            void populate(BenchHarness& harness, BenchScene& scene) override {
+                // A 64x64 texture holds the 16 tiles of 16x16 pixels
+                std::string tileset = writeTexture(generatedAssetDir(), 900, 64);
+                auto tilemap = std::make_unique<engine::render::Tilemap>(
+                    glm::ivec2(MAP_SIZE, MAP_SIZE),
+                    engine::render::Tileset{tileset, {TILE_SIZE, TILE_SIZE}},
+                    harness.getContext().getResourceManager()
+                );
+
+                Lcg random(27);
+                std::vector<engine::render::Tilemap::TileId> tiles(static_cast<std::size_t>(MAP_SIZE) * MAP_SIZE);
+                for (auto& tile : tiles) {
+                    tile = static_cast<engine::render::Tilemap::TileId>(1 + random.next() % TILE_KINDS);
+                }
+                tilemap->setTiles(tiles);
+                tilemap_ = tilemap.get();
+
+                auto object = std::make_unique<engine::object::GameObject>("tilemap");
+                object->addComponent<engine::object::components::TilemapComponent>(std::move(tilemap));
+                scene.addGameObject(std::move(object));
+            }
+
+            void beforeFrame(BenchHarness& harness, int frame) override {
+                if (!tilemap_) {
+                    return;
+                }
+
+                // What the previous frame rebuilt: nothing but its edits when the camera held still
+                const auto& stats = tilemap_->getStats();
+                std::size_t rebuilt = stats.chunk_rebuilds - last_rebuilds_;
+                last_rebuilds_ = stats.chunk_rebuilds;
+                if (frame > 0) {
+                    if (held_still_ && rebuilt != edited_chunks_) {
+                        ++unexpected_rebuilds_;
+                    } else if (!held_still_ && rebuilt > stats.visible_chunks) {
+                        ++unexpected_rebuilds_;
+                    }
+                    max_quads_ = std::max(max_quads_, stats.submitted_quads);
+                }
+
+                // Scroll diagonally for a second, hold for a second while editing, repeat
+                auto& camera = harness.getContext().getCamera();
+                held_still_ = frame > 0 && (frame / 60) % 2 == 1;
+                edited_chunks_ = 0;
+                if (!held_still_) {
+                    // Long runs start over from the corner, revisiting chunks that may have been trimmed
+                    scroll_ += SCROLL_SPEED;
+                    if (scroll_ + camera.getViewportSize().x >= static_cast<float>(MAP_SIZE * TILE_SIZE)) {
+                        scroll_ = 0.0f;
+                        restarted_ = true;
+                    }
+                    camera.setPosition(glm::vec2(scroll_, scroll_ * 0.5f));
+                    visitChunks(camera);
+                    return;
+                }
+
+                if (frame % EDIT_INTERVAL == 0) {
+                    glm::ivec2 first_tile = glm::ivec2(camera.getPosition()) / TILE_SIZE;
+                    glm::ivec2 view_tiles = glm::ivec2(camera.getViewportSize()) / TILE_SIZE;
+                    int x = first_tile.x + static_cast<int>(random_.next() % static_cast<std::uint32_t>(std::max(1, view_tiles.x)));
+                    int y = first_tile.y + static_cast<int>(random_.next() % static_cast<std::uint32_t>(std::max(1, view_tiles.y)));
+                    auto tile = tilemap_->getTile(x, y);
+                    tilemap_->setTile(x, y, static_cast<engine::render::Tilemap::TileId>(tile % TILE_KINDS + 1));
+                    edited_chunks_ = 1;
+                    ++edits_;
+                }
+            }
+
+            void report(BenchHarness& /*harness*/, nlohmann::ordered_json& metrics) override {
+                metrics["map_tiles"] = MAP_SIZE * MAP_SIZE;
+                metrics["chunks_visited"] = visited_chunks_.size();
+                metrics["tile_edits"] = edits_;
+                if (tilemap_) {
+                    const auto& stats = tilemap_->getStats();
+                    metrics["chunk_rebuilds"] = stats.chunk_rebuilds;
+                    metrics["cached_chunks"] = stats.cached_chunks;
+                    metrics["max_quads_per_frame"] = max_quads_;
+                }
+                metrics["unexpected_rebuild_frames"] = unexpected_rebuilds_;
+            }
+
+            std::string check(BenchHarness& /*harness*/) override {
+                if (!tilemap_) {
+                    return "no tilemap was created.";
+                }
+                if (unexpected_rebuilds_ > 0) {
+                    return std::to_string(unexpected_rebuilds_) + " frames rebuilt chunks that neither came into view nor changed.";
+                }
+
+                // Until the scroll starts over, each chunk is built once plus once per edit
+                std::size_t rebuilds = tilemap_->getStats().chunk_rebuilds;
+                if (!restarted_ && rebuilds > visited_chunks_.size() + edits_) {
+                    return std::to_string(rebuilds) + " chunk rebuilds for " + std::to_string(visited_chunks_.size()) +
+                           " chunks visited and " + std::to_string(edits_) + " edits.";
+                }
+                return {};
+            }
+
+        private:
+            static constexpr int MAP_SIZE = 4096;
+            static constexpr int TILE_SIZE = 16;
+            static constexpr std::uint32_t TILE_KINDS = 16;
+            static constexpr float SCROLL_SPEED = 24.0f;
+            static constexpr int EDIT_INTERVAL = 6;
+
+            engine::render::Tilemap* tilemap_ = nullptr;
+            Lcg random_{28};
+            float scroll_ = 0.0f;
+            bool held_still_ = false;
+            bool restarted_ = false;
+            std::size_t edited_chunks_ = 0;
+            std::size_t last_rebuilds_ = 0;
+            std::size_t max_quads_ = 0;
+            std::uint64_t edits_ = 0;
+            std::uint64_t unexpected_rebuilds_ = 0;
+            std::unordered_set<std::uint64_t> visited_chunks_;
+
+            /// @brief Record the chunks the camera overlaps, as Tilemap::render() finds them.
+            void visitChunks(const engine::render::Camera& camera) {
+                constexpr float CHUNK_PIXELS = static_cast<float>(engine::render::Tilemap::CHUNK_SIZE * TILE_SIZE);
+                constexpr int CHUNKS = MAP_SIZE / engine::render::Tilemap::CHUNK_SIZE;
+                glm::vec2 view_min = camera.getPosition();
+                glm::vec2 view_max = view_min + camera.getViewportSize();
+                int first_x = std::max(0, static_cast<int>(std::floor(view_min.x / CHUNK_PIXELS)));
+                int first_y = std::max(0, static_cast<int>(std::floor(view_min.y / CHUNK_PIXELS)));
+                int last_x = std::min(CHUNKS - 1, static_cast<int>(std::floor(view_max.x / CHUNK_PIXELS)));
+                int last_y = std::min(CHUNKS - 1, static_cast<int>(std::floor(view_max.y / CHUNK_PIXELS)));
+                for (int y = first_y; y <= last_y; ++y) {
+                    for (int x = first_x; x <= last_x; ++x) {
+                        visited_chunks_.insert(static_cast<std::uint64_t>(y) * CHUNKS + x);
+                    }
+                }
+            }
+        };
+
+        /// @brief Repeating background layers with the camera a million pixels out, so the
+        /// wrapped tile range is all that keeps the per-layer quad count small.
+        class ParallaxScenario final : public Scenario {
+        public:
+            std::string_view getName() const override { return "parallax"; }
+            std::string_view getDescription() const override { return "Parallax layers scrolled around 1e6 px; one geometry draw per layer."; }
+
+            void populate(BenchHarness& /*harness*/, BenchScene& scene) override {
+                fs::path dir = generatedAssetDir();
+                for (int i = 0; i < LAYER_COUNT; ++i) {
+                    int size = 64 + 32 * i;
+                    tile_sizes_[i] = static_cast<float>(size);
+
+                    auto object = std::make_unique<engine::object::GameObject>("parallax_" + std::to_string(i));
+                    object->addComponent<engine::object::components::TransformComponent>();
+                    object->addComponent<engine::object::components::ParallaxComponent>(
+                        writeTexture(dir, 910 + i, size),
+                        glm::vec2(static_cast<float>(i + 1) / LAYER_COUNT, 0.5f * static_cast<float>(i + 1) / LAYER_COUNT)
+                    );
+                    scene.addGameObject(std::move(object));
+                }
+            }
+
+            void beforeFrame(BenchHarness& harness, int frame) override {
+                // What the previous frame submitted
+                const auto& stats = harness.getContext().getRenderer().getStats();
+                std::uint64_t draws = stats.geometry_draws - last_draws_;
+                std::uint64_t vertices = stats.geometry_vertices - last_vertices_;
+                last_draws_ = stats.geometry_draws;
+                last_vertices_ = stats.geometry_vertices;
+
+                auto& camera = harness.getContext().getCamera();
+                if (frame > 0) {
+                    if (draws != LAYER_COUNT) {
+                        ++bad_draw_frames_;
+                    }
+                    if (vertices > maxVertices(camera.getViewportSize())) {
+                        ++bad_quad_frames_;
+                    }
+                    max_vertices_ = std::max(max_vertices_, vertices);
+                }
+
+                // Far from the origin, swinging back and forth over it
+                float swing = std::sin(static_cast<float>(frame) * 0.05f) * 5000.0f;
+                camera.setPosition(glm::vec2(OFFSET + swing, -OFFSET + swing * 0.5f));
+            }
+
+            void report(BenchHarness& harness, nlohmann::ordered_json& metrics) override {
+                metrics["layers"] = LAYER_COUNT;
+                metrics["camera_offset"] = OFFSET;
+                metrics["max_vertices_per_frame"] = max_vertices_;
+                metrics["vertex_bound"] = maxVertices(harness.getContext().getCamera().getViewportSize());
+                metrics["frames_without_one_draw_per_layer"] = bad_draw_frames_;
+                metrics["frames_over_vertex_bound"] = bad_quad_frames_;
+            }
+
+            std::string check(BenchHarness& /*harness*/) override {
+                if (bad_draw_frames_ > 0) {
+                    return std::to_string(bad_draw_frames_) + " frames did not submit one geometry draw per layer.";
+                }
+                if (bad_quad_frames_ > 0) {
+                    return std::to_string(bad_quad_frames_) + " frames emitted more tiles than cover the viewport.";
+                }
+                return {};
+            }
+
+        private:
+            static constexpr int LAYER_COUNT = 6;
+            static constexpr float OFFSET = 1.0e6f;
+
+            std::array<float, LAYER_COUNT> tile_sizes_{};
+            std::uint64_t last_draws_ = 0;
+            std::uint64_t last_vertices_ = 0;
+            std::uint64_t max_vertices_ = 0;
+            std::uint64_t bad_draw_frames_ = 0;
+            std::uint64_t bad_quad_frames_ = 0;
+
+            /// @brief The most a frame may emit: per layer, the tiles covering the viewport
+            /// plus a partial one on each axis.
+            std::uint64_t maxVertices(glm::vec2 viewport) const {
+                std::uint64_t vertices = 0;
+                for (float tile : tile_sizes_) {
+                    auto columns = static_cast<std::uint64_t>(viewport.x / tile) + 2;
+                    auto rows = static_cast<std::uint64_t>(viewport.y / tile) + 2;
+                    vertices += columns * rows * 4;
+                }
+                return vertices;
+            }
+        };
+
+        /// @brief A grid of buttons hovered and clicked by scripted mouse events.
+        class UIButtonsScenario final : public Scenario {
+        public:
+            std::string_view getName() const override { return "ui_buttons"; }
+            std::string_view getDescription() const override { return "Button grid driven by synthetic mouse motion and clicks."; }
+
+            void populate(BenchHarness& harness, BenchScene& scene) override {
+                for (int row = 0; row < ROWS; ++row) {
+                    for (int column = 0; column < COLUMNS; ++column) {
+                        scene.getUIManager().addElement(std::make_unique<engine::ui::UIButton>(
+                            harness.getContext(),
+                            BUTTON_NORMAL,
+                            BUTTON_HOVER,
+                            BUTTON_PRESSED,
+                            glm::vec2(column * 72.0f + 16.0f, row * 40.0f + 16.0f),
+                            glm::vec2(64.0f, 32.0f),
+                            [this]() { ++clicks_; }
+                        ));
+                    }
+                }
+            }
+
+            void beforeFrame(BenchHarness& /*harness*/, int frame) override {
+                // Press on one frame and release on the next, over a button chosen at random
+                if (frame % 2 == 0) {
+                    x_ = static_cast<float>(random_.next() % COLUMNS) * 72.0f + 48.0f;
+                    y_ = static_cast<float>(random_.next() % ROWS) * 40.0f + 32.0f;
+                    pushMouseMotion(x_, y_);
+                }
+                pushMouseButton(x_, y_, frame % 2 == 0);
+            }
+
+            void report(BenchHarness& /*harness*/, nlohmann::ordered_json& metrics) override {
+                metrics["buttons"] = ROWS * COLUMNS;
+                metrics["clicks"] = clicks_;
+            }
+
+        private:
+            static constexpr int ROWS = 16;
+            static constexpr int COLUMNS = 16;
+
+            Lcg random_{2};
+            float x_ = 0.0f;
+            float y_ = 0.0f;
+            std::uint64_t clicks_ = 0;
+        };
+
+        /// @brief Bursts of key events resolved through the binding tables, then every
+        /// action queried by id.
+        class InputScenario final : public Scenario {
+        public:
+            std::string_view getName() const override { return "input_events"; }
+            std::string_view getDescription() const override { return "Key event bursts and action queries by id."; }
+
+            void beforeFrame(BenchHarness& /*harness*/, int frame) override {
+                static constexpr SDL_Scancode KEYS[] = {
+                    SDL_SCANCODE_W, SDL_SCANCODE_A, SDL_SCANCODE_S, SDL_SCANCODE_D,
+                    SDL_SCANCODE_UP, SDL_SCANCODE_LEFT, SDL_SCANCODE_DOWN, SDL_SCANCODE_RIGHT,
+                };
+
+                for (int i = 0; i < EVENTS_PER_FRAME; ++i) {
+                    SDL_Event event{};
+                    bool down = (frame + i) % 2 == 0;
+                    event.type = down ? SDL_EVENT_KEY_DOWN : SDL_EVENT_KEY_UP;
+                    event.key.scancode = KEYS[i % std::size(KEYS)];
+                    event.key.down = down;
+                    SDL_PushEvent(&event);
+                }
+            }
+
+            void update(BenchHarness& harness, float /*delta_time*/) override {
+                auto& input = harness.getContext().getInputManager();
+                auto action_count = static_cast<engine::input::ActionId>(input.getActionCount());
+
+                for (int pass = 0; pass < QUERY_PASSES; ++pass) {
+                    for (engine::input::ActionId action = 0; action < action_count; ++action) {
+                        active_ += input.isActionDown(action) ? 1 : 0;
+                        ++queries_;
+                    }
+                }
+            }
+
+            void report(BenchHarness& /*harness*/, nlohmann::ordered_json& metrics) override {
+                metrics["events_per_frame"] = EVENTS_PER_FRAME;
+                metrics["action_queries"] = queries_;
+                metrics["active_results"] = active_;
+            }
+
+        private:
+            static constexpr int EVENTS_PER_FRAME = 64;
+            static constexpr int QUERY_PASSES = 256;
+
+            std::uint64_t queries_ = 0;
+            std::uint64_t active_ = 0;
+        };
+
+        /// @brief Clicks on a button grid recorded to a `.sinp` file, then replayed from it:
+        /// the replay must click the same buttons and reproduce every frame's action states.
+        class InputReplayScenario final : public Scenario {
+        public:
+            std::string_view getName() const override { return "input_replay"; }
+            std::string_view getDescription() const override { return "UI clicks recorded, replayed and compared; corrupt recordings rejected."; }
+
+            void populate(BenchHarness& harness, BenchScene& scene) override {
+                for (int row = 0; row < ROWS; ++row) {
+                    for (int column = 0; column < COLUMNS; ++column) {
+                        int index = row * COLUMNS + column;
+                        scene.getUIManager().addElement(std::make_unique<engine::ui::UIButton>(
+                            harness.getContext(),
+                            BUTTON_NORMAL,
+                            BUTTON_HOVER,
+                            BUTTON_PRESSED,
+                            glm::vec2(column * 72.0f + 16.0f, row * 40.0f + 16.0f),
+                            glm::vec2(64.0f, 32.0f),
+                            [this, index]() { clicks_[phase_ == Phase::RECORDING ? 0 : 1].push_back(index); }
+                        ));
+                    }
+                }
+
+                path_ = (generatedAssetDir() / "ui_clicks.sinp").generic_string();
+                recorder_ = std::make_unique<engine::input::InputRecorder>(path_);
+                harness.getContext().getInputManager().setRecorder(recorder_.get());
+            }
+
+            void beforeFrame(BenchHarness& harness, int frame) override {
+                if (phase_ == Phase::RECORDING && frame < RECORD_FRAMES) {
+                    recorder_->beginFrame(harness.getDeltaTime());
+
+                    // Press on one frame and release on the next, over a button chosen at random
+                    if (frame % 2 == 0) {
+                        x_ = static_cast<float>(random_.next() % COLUMNS) * 72.0f + 48.0f;
+                        y_ = static_cast<float>(random_.next() % ROWS) * 40.0f + 32.0f;
+                        pushMouseMotion(x_, y_);
+                    }
+                    pushMouseButton(x_, y_, frame % 2 == 0);
+                    return;
+                }
+
+                auto& input = harness.getContext().getInputManager();
+                if (phase_ == Phase::RECORDING) {
+                    input.setRecorder(nullptr);
+                    recorder_->finish();
+                    recorded_bytes_ = fs::file_size(path_);
+                    checkCorruptRecordings();
+                    try {
+                        replay_ = std::make_unique<engine::input::InputReplay>(path_);
+                    } catch (const std::exception& e) {
+                        failures_.push_back(std::string("the recording could not be replayed: ") + e.what());
+                        phase_ = Phase::DONE;
+                        return;
+                    }
+                    input.setReplay(replay_.get());
+                    phase_ = Phase::REPLAYING;
+                }
+
+                if (phase_ == Phase::REPLAYING && !replay_->nextFrame()) {
+                    input.setReplay(nullptr);
+                    phase_ = Phase::DONE;
+                }
+            }
+
+            void update(BenchHarness& harness, float /*delta_time*/) override {
+                // After the frame's input, as GameApp does
+                std::uint64_t state_hash = harness.getContext().getInputManager().getStateHash();
+                if (phase_ == Phase::RECORDING) {
+                    recorder_->endFrame(state_hash);
+                } else if (phase_ == Phase::REPLAYING) {
+                    replay_->endFrame(state_hash);
+                }
+            }
+
+            void report(BenchHarness& harness, nlohmann::ordered_json& metrics) override {
+                auto& input = harness.getContext().getInputManager();
+                input.setRecorder(nullptr);
+                input.setReplay(nullptr);
+
+                metrics["recorded_frames"] = RECORD_FRAMES;
+                metrics["recording_bytes"] = recorded_bytes_;
+                metrics["recorded_clicks"] = clicks_[0].size();
+                metrics["replayed_clicks"] = clicks_[1].size();
+                metrics["first_divergent_frame"] = replay_ ? replay_->getFirstDivergentFrame() : -1;
+            }
+
+            std::string check(BenchHarness& /*harness*/) override {
+                if (phase_ != Phase::DONE) {
+                    failures_.push_back("the replay did not finish; run at least " + std::to_string(2 * RECORD_FRAMES + 1) + " frames");
+                } else if (replay_) {
+                    if (clicks_[0].empty()) {
+                        failures_.push_back("the recording clicked no button");
+                    } else if (clicks_[1] != clicks_[0]) {
+                        failures_.push_back("the replay clicked " + std::to_string(clicks_[1].size()) + " buttons, the recording " +
+                                            std::to_string(clicks_[0].size()) + " (or others)");
+                    }
+                    if (!replay_->matchesRecording()) {
+                        failures_.push_back("the replay diverged at frame " + std::to_string(replay_->getFirstDivergentFrame()));
+                    }
+                }
+
+                std::string result;
+                for (const auto& failure : failures_) {
+                    result += (result.empty() ? "" : "; ") + failure;
+                }
+                return result.empty() ? result : result + ".";
+            }
+
+        private:
+            enum class Phase { RECORDING, REPLAYING, DONE };
+
+            static constexpr int ROWS = 4;
+            static constexpr int COLUMNS = 4;
+            static constexpr int RECORD_FRAMES = 120;
+
+            std::string path_;
+            std::unique_ptr<engine::input::InputRecorder> recorder_;
+            std::unique_ptr<engine::input::InputReplay> replay_;
+            Phase phase_ = Phase::RECORDING;
+            Lcg random_{39};
+            float x_ = 0.0f;
+            float y_ = 0.0f;
+            std::array<std::vector<int>, 2> clicks_;
+            std::uintmax_t recorded_bytes_ = 0;
+            std::vector<std::string> failures_;
+
+            /// @brief Copies of the recording with counts that do not match its contents
+            /// must fail to load, not size buffers from them.
+            void checkCorruptRecordings() {
+                using Format = engine::input::InputRecordingFormat;
+                std::ifstream in(path_, std::ios::binary);
+                std::vector<char> bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+                if (bytes.size() < sizeof(Format::Header) + sizeof(Format::FrameRecord)) {
+                    failures_.push_back("the recording is too short to corrupt");
+                    return;
+                }
+
+                auto expectRejected = [&](std::vector<char> corrupt, const char* what) {
+                    std::string corrupt_path = (generatedAssetDir() / "ui_clicks_corrupt.sinp").generic_string();
+                    std::ofstream(corrupt_path, std::ios::binary | std::ios::trunc).write(corrupt.data(), static_cast<std::streamsize>(corrupt.size()));
+                    try {
+                        engine::input::InputReplay replay(corrupt_path);
+                        failures_.push_back(std::string("a recording with ") + what + " was accepted");
+                    } catch (const std::runtime_error&) {
+                    }
+                };
+
+                auto header_with = [&](std::size_t offset, std::uint32_t value) {
+                    std::vector<char> corrupt = bytes;
+                    std::memcpy(corrupt.data() + offset, &value, sizeof(value));
+                    return corrupt;
+                };
+                expectRejected(header_with(offsetof(Format::Header, frame_count), UINT32_MAX), "a huge frame count");
+                expectRejected(header_with(offsetof(Format::Header, event_count), UINT32_MAX), "a huge event count");
+                expectRejected(header_with(sizeof(Format::Header) + offsetof(Format::FrameRecord, event_count), UINT32_MAX - 1), "a huge frame event count");
+                expectRejected(std::vector<char>(bytes.begin(), bytes.end() - 1), "a truncated frame");
+            }
+        };
+
+        /// @brief More textures than the budget holds, looked up through a sliding window so
+        /// the LRU keeps evicting and reloading. The window is looked up outside any scene,
+        /// as unreferenced textures; one texture held by the scene must survive throughout.
+        class TextureBudgetScenario final : public Scenario {
+        public:
+            std::string_view getName() const override { return "texture_budget"; }
+            std::string_view getDescription() const override { return "Sliding working set over a texture budget smaller than the set."; }
+
+            void populate(BenchHarness& harness, BenchScene& scene) override {
+                auto& resource_manager = harness.getContext().getResourceManager();
+                resource_manager.setTextureBudget(BUDGET_BYTES);
+
+                fs::path dir = generatedAssetDir();
+                for (int i = 0; i < TEXTURE_COUNT; ++i) {
+                    paths_.push_back(writeTexture(dir, i, TEXTURE_SIZE));
+                }
+
+                // Referenced by the scene's scope, and never looked up again
+                pinned_path_ = writeTexture(dir, TEXTURE_COUNT, TEXTURE_SIZE);
+                addSprite(scene, resource_manager, pinned_path_, {0.0f, 0.0f});
+                if (auto* sprite = scene.getGameObjects().back()->getComponent<engine::object::components::SpriteComponent>()) {
+                    sprite->setHidden(true);
+                }
+            }
+
+            void beforeFrame(BenchHarness& harness, int frame) override {
+                // Outside the scene's callbacks no scope is active: these lookups hold no reference
+                auto& resource_manager = harness.getContext().getResourceManager();
+                int first = (frame * STEP) % TEXTURE_COUNT;
+                for (int i = 0; i < WINDOW; ++i) {
+                    resource_manager.getTexture(paths_[(first + i) % TEXTURE_COUNT]);
+                }
+            }
+
+            void report(BenchHarness& harness, nlohmann::ordered_json& metrics) override {
+                auto& resource_manager = harness.getContext().getResourceManager();
+                auto stats = resource_manager.getTextureStats();
+                metrics["textures"] = TEXTURE_COUNT;
+                metrics["hits"] = stats.hits;
+                metrics["misses"] = stats.misses;
+                metrics["evictions"] = stats.evictions;
+                metrics["resident_bytes"] = stats.resident_bytes;
+                metrics["budget_bytes"] = stats.budget_bytes;
+
+                // A miss here means the scene's texture was evicted while it held it
+                evictions_ = stats.evictions;
+                resource_manager.getTexture(pinned_path_);
+                pinned_evicted_ = resource_manager.getTextureStats().misses != stats.misses;
+            }
+
+            std::string check(BenchHarness& /*harness*/) override {
+                if (pinned_evicted_) {
+                    return "a texture referenced by the scene was evicted for the budget.";
+                }
+                if (evictions_ == 0) {
+                    return "the working set never exceeded the budget.";
+                }
+                return {};
+            }
+
+        private:
+            static constexpr int TEXTURE_COUNT = 64;
+            static constexpr int TEXTURE_SIZE = 128;
+            static constexpr int WINDOW = 12;
+            static constexpr int STEP = 2;
+            /// @brief Room for 16 of the 64 KiB textures.
+            static constexpr std::size_t BUDGET_BYTES = 16 * TEXTURE_SIZE * TEXTURE_SIZE * 4;
+
+            std::vector<std::string> paths_;
+            std::string pinned_path_;
+            std::uint64_t evictions_ = 0;
+            bool pinned_evicted_ = false;
+        };
+
+        /// @brief The software mixer mixing a full voice pool in real time, headless.
+        class MixerScenario final : public Scenario {
+        public:
+            std::string_view getName() const override { return "audio_mixer"; }
+            std::string_view getDescription() const override { return "Software mixer summing a full voice pool each frame."; }
+
+            void populate(BenchHarness& /*harness*/, BenchScene& /*scene*/) override {
+                mixer_ = std::make_unique<engine::audio::Mixer>(SAMPLE_RATE, VOICES);
+
+                // One second of stereo noise per buffer; half of the voices are pitched
+                Lcg random(3);
+                std::vector<const engine::audio::SoundBuffer*> buffers;
+                for (int i = 0; i < 8; ++i) {
+                    std::vector<float> samples(static_cast<std::size_t>(SAMPLE_RATE) * engine::audio::Mixer::CHANNELS);
+                    for (auto& sample : samples) {
+                        sample = random.nextFloat(0.2f) - 0.1f;
+                    }
+                    buffers.push_back(mixer_->createBuffer(std::move(samples)));
+                }
+
+                for (int i = 0; i < static_cast<int>(VOICES); ++i) {
+                    float pitch = i % 2 == 0 ? 1.0f : 0.5f + random.nextFloat(1.5f);
+                    float pan = random.nextFloat(2.0f) - 1.0f;
+                    mixer_->play(buffers[i % buffers.size()], 0.05f, pan, pitch, true);
+                }
+                output_.resize(static_cast<std::size_t>(SAMPLE_RATE) * engine::audio::Mixer::CHANNELS);
+            }
+
+            void update(BenchHarness& /*harness*/, float delta_time) override {
+                auto frames = static_cast<std::size_t>(delta_time * SAMPLE_RATE);
+                std::uint64_t start_ns = SDL_GetTicksNS();
+                mixer_->mix(output_.data(), frames);
+                mix_ns_ += SDL_GetTicksNS() - start_ns;
+            }
+
+            void report(BenchHarness& /*harness*/, nlohmann::ordered_json& metrics) override {
+                auto stats = mixer_->getStats();
+                double mix_ms = static_cast<double>(mix_ns_) / 1000000.0;
+                metrics["kernels"] = mixer_->getKernelName();
+                metrics["voices"] = stats.active_voices;
+                metrics["voice_frames_mixed"] = stats.voice_frames_mixed;
+                metrics["mix_ms"] = mix_ms;
+                metrics["voice_frames_per_ms"] = mix_ms > 0.0 ? static_cast<double>(stats.voice_frames_mixed) / mix_ms : 0.0;
+            }
+
+        private:
+            static constexpr int SAMPLE_RATE = 48000;
+            static constexpr std::uint32_t VOICES = 256;
+
+            std::unique_ptr<engine::audio::Mixer> mixer_;
+            std::vector<float> output_;
+            std::uint64_t mix_ns_ = 0;
+        };
+
+        /// @brief Many sound requests per frame, coalesced by the event bus before they
+        /// reach the audio thread.
+        class SoundBusScenario final : public Scenario {
+        public:
+            std::string_view getName() const override { return "sound_bus"; }
+            std::string_view getDescription() const override { return "Sound requests coalesced by the event bus and played by the audio thread."; }
+
+            void populate(BenchHarness& harness, BenchScene& /*scene*/) override {
+                fs::path dir = generatedAssetDir();
+                for (int i = 0; i < SOUND_COUNT; ++i) {
+                    sounds_.push_back(writeTone(dir, i, 220.0f * static_cast<float>(i + 1), 0.25f));
+                    harness.getContext().getAudioPlayer().preloadSound(sounds_.back());
+                }
+            }
+
+            void update(BenchHarness& harness, float /*delta_time*/) override {
+                auto& bus = harness.getContext().getSoundEventBus();
+                for (int i = 0; i < POSTS_PER_FRAME; ++i) {
+                    bus.post(sounds_[random_.next() % sounds_.size()], 0.5f);
+                }
+            }
+
+            void report(BenchHarness& harness, nlohmann::ordered_json& metrics) override {
+                const auto& bus_stats = harness.getContext().getSoundEventBus().getStats();
+                auto player_stats = harness.getContext().getAudioPlayer().getStats();
+                metrics["posts_per_frame"] = POSTS_PER_FRAME;
+                metrics["requests"] = bus_stats.requests;
+                metrics["coalesced"] = bus_stats.coalesced;
+                metrics["played"] = bus_stats.played;
+                metrics["dropped_commands"] = player_stats.dropped_commands;
+                metrics["voices_recycled"] = player_stats.voices_recycled;
+                metrics["peak_voices"] = player_stats.peak_voices;
+            }
+
+        private:
+            static constexpr int SOUND_COUNT = 8;
+            static constexpr int POSTS_PER_FRAME = 256;
+
+            std::vector<std::string> sounds_;
+            Lcg random_{4};
+        };
+
+        /// @brief Sound effects requested straight from the AudioPlayer: what a playSound()
+        /// costs the game thread, and what decoding and playing cost the audio thread.
+        class AudioPlayerScenario final : public Scenario {
+        public:
+            std::string_view getName() const override { return "audio_player"; }
+            std::string_view getDescription() const override { return "playSound() cost on the game thread; decode and busy time on the audio thread."; }
+
+            void populate(BenchHarness& harness, BenchScene& /*scene*/) override {
+                // Half preloaded, half decoded by their first playSound()
+                fs::path dir = generatedAssetDir();
+                auto& audio_player = harness.getContext().getAudioPlayer();
+                for (int i = 0; i < SOUND_COUNT; ++i) {
+                    sounds_.push_back(writeTone(dir, 100 + i, 110.0f * static_cast<float>(i + 2), 0.5f));
+                    if (i % 2 == 0) {
+                        audio_player.preloadSound(sounds_.back());
+                    }
+                }
+                start_ns_ = SDL_GetTicksNS();
+            }
+
+            void update(BenchHarness& harness, float /*delta_time*/) override {
+                auto& audio_player = harness.getContext().getAudioPlayer();
+                std::uint64_t start_ns = SDL_GetTicksNS();
+                for (int i = 0; i < PLAYS_PER_FRAME; ++i) {
+                    std::uint32_t pick = random_.next();
+                    audio_player.playSound(sounds_[pick % sounds_.size()], static_cast<int>(pick % 4), 0.5f, (pick & 8) != 0 ? 4 : 0);
+                }
+                play_ns_ += SDL_GetTicksNS() - start_ns;
+                plays_ += PLAYS_PER_FRAME;
+            }
+
+            void report(BenchHarness& harness, nlohmann::ordered_json& metrics) override {
+                auto stats = harness.getContext().getAudioPlayer().getStats();
+                std::uint64_t elapsed_ns = SDL_GetTicksNS() - start_ns_;
+                metrics["sounds"] = SOUND_COUNT;
+                metrics["plays_per_frame"] = PLAYS_PER_FRAME;
+                metrics["ns_per_play_sound"] = plays_ > 0 ? static_cast<double>(play_ns_) / static_cast<double>(plays_) : 0.0;
+                metrics["decode_ms"] = static_cast<double>(stats.decode_ns) / 1.0e6;
+                metrics["audio_thread_busy_ms"] = static_cast<double>(stats.busy_ns) / 1.0e6;
+                metrics["audio_thread_busy_share"] = elapsed_ns > 0 ? static_cast<double>(stats.busy_ns) / static_cast<double>(elapsed_ns) : 0.0;
+                metrics["commands"] = stats.commands;
+                metrics["dropped_commands"] = stats.dropped_commands;
+                metrics["sounds_played"] = stats.sounds_played;
+                metrics["sounds_dropped"] = stats.sounds_dropped;
+                metrics["voices_stolen"] = stats.voices_stolen;
+                metrics["voices_recycled"] = stats.voices_recycled;
+                metrics["peak_voices"] = stats.peak_voices;
+            }
+
+        private:
+            static constexpr int SOUND_COUNT = 16;
+            static constexpr int PLAYS_PER_FRAME = 64;
+
+            std::vector<std::string> sounds_;
+            Lcg random_{35};
+            std::uint64_t start_ns_ = 0;
+            std::uint64_t play_ns_ = 0;
+            std::uint64_t plays_ = 0;
+        };
+
+        /// @brief Transient per-frame lists and strings built from the frame arena and, for
+        /// comparison, from the global heap.
+        class FrameArenaScenario final : public Scenario {
+        public:
+            std::string_view getName() const override { return "frame_arena"; }
+            std::string_view getDescription() const override { return "Transient per-frame lists and strings from the frame arena versus the heap."; }
+
+            void update(BenchHarness& harness, float /*delta_time*/) override {
+                std::uint64_t start_ns = SDL_GetTicksNS();
+                checksum_ += buildTransients(&harness.getContext().getFrameArena());
+                std::uint64_t middle_ns = SDL_GetTicksNS();
+                checksum_ += buildTransients(std::pmr::new_delete_resource());
+
+                arena_ns_ += middle_ns - start_ns;
+                heap_ns_ += SDL_GetTicksNS() - middle_ns;
+                ++frames_;
+            }
+
+            void report(BenchHarness& /*harness*/, nlohmann::ordered_json& metrics) override {
+                double frames = frames_ > 0 ? static_cast<double>(frames_) : 1.0;
+                metrics["lists_per_frame"] = LISTS_PER_FRAME;
+                metrics["arena_us_per_frame"] = static_cast<double>(arena_ns_) / 1000.0 / frames;
+                metrics["heap_us_per_frame"] = static_cast<double>(heap_ns_) / 1000.0 / frames;
+                metrics["heap_to_arena_ratio"] = arena_ns_ > 0 ? static_cast<double>(heap_ns_) / static_cast<double>(arena_ns_) : 0.0;
+                metrics["checksum"] = checksum_;
+            }
+
+        private:
+            static constexpr int LISTS_PER_FRAME = 256;
+            static constexpr int LIST_SIZE = 64;
+
+            /// @brief Grow a list and build a lookup key per iteration, the way per-frame
+            /// engine code does.
+            static std::uint64_t buildTransients(std::pmr::memory_resource* resource) {
+                std::uint64_t checksum = 0;
+                for (int i = 0; i < LISTS_PER_FRAME; ++i) {
+                    std::pmr::vector<int> list(resource);
+                    for (int j = 0; j < LIST_SIZE; ++j) {
+                        list.push_back(i + j);
+                    }
+
+                    std::pmr::string key("assets/textures/transient/", resource);
+                    key.push_back(static_cast<char>('a' + i % 26));
+                    checksum += static_cast<std::uint64_t>(list.back()) + key.size();
+                }
+                return checksum;
+            }
+
+            std::uint64_t arena_ns_ = 0;
+            std::uint64_t heap_ns_ = 0;
+            std::uint64_t frames_ = 0;
+            std::uint64_t checksum_ = 0;
+        };
+
+        /// @brief Entities spawned and destroyed every frame, the way bullets and particles
+        /// churn, around a steady population.
+        class ObjectChurnScenario final : public Scenario {
+        public:
+            std::string_view getName() const override { return "object_churn"; }
+            std::string_view getDescription() const override { return "GameObjects and their components spawned and destroyed every frame."; }
+
+            void populate(BenchHarness& /*harness*/, BenchScene& /*scene*/) override {
+                live_.resize(LIVE_OBJECTS);
+                for (int i = 0; i < LIVE_OBJECTS; ++i) {
+                    live_[i] = spawn(static_cast<float>(i));
+                }
+                rss_samples_.reserve(256);
+            }
+
+            void update(BenchHarness& /*harness*/, float /*delta_time*/) override {
+                // The oldest objects make way for new ones
+                std::uint64_t start_ns = SDL_GetTicksNS();
+                for (int i = 0; i < CHURN_PER_FRAME; ++i) {
+                    live_[(cursor_ + i) % LIVE_OBJECTS].reset();
+                }
+
+                std::uint64_t middle_ns = SDL_GetTicksNS();
+                for (int i = 0; i < CHURN_PER_FRAME; ++i) {
+                    live_[(cursor_ + i) % LIVE_OBJECTS] = spawn(static_cast<float>(i));
+                }
+
+                std::uint64_t end_ns = SDL_GetTicksNS();
+                destroy_ns_ += middle_ns - start_ns;
+                spawn_ns_ += end_ns - middle_ns;
+                spawned_ += CHURN_PER_FRAME;
+                cursor_ = (cursor_ + CHURN_PER_FRAME) % LIVE_OBJECTS;
+
+                // The resident set should plateau once the pools hold the steady population
+                if (frame_++ % 60 == 0 && rss_samples_.size() < rss_samples_.capacity()) {
+                    rss_samples_.push_back(getResidentBytes());
+                }
+            }
+
+            void report(BenchHarness& /*harness*/, nlohmann::ordered_json& metrics) override {
+                double spawned = spawned_ > 0 ? static_cast<double>(spawned_) : 1.0;
+                metrics["live_objects"] = LIVE_OBJECTS;
+                metrics["churn_per_frame"] = CHURN_PER_FRAME;
+                metrics["ns_per_spawn"] = static_cast<double>(spawn_ns_) / spawned;
+                metrics["ns_per_destroy"] = static_cast<double>(destroy_ns_) / spawned;
+
+                auto& object_pool = engine::object::GameObject::Pool::shared();
+                auto& transform_pool = engine::utils::ObjectPool<engine::object::components::TransformComponent>::shared();
+                metrics["game_object_pool"] = {{"live", object_pool.size()}, {"capacity", object_pool.capacity()}};
+                metrics["transform_pool"] = {{"live", transform_pool.size()}, {"capacity", transform_pool.capacity()}};
+
+                auto rss_mb = nlohmann::ordered_json::array();
+                for (auto bytes : rss_samples_) {
+                    rss_mb.push_back(static_cast<double>(bytes) / (1024.0 * 1024.0));
+                }
+                metrics["rss_mb_every_60_frames"] = std::move(rss_mb);
+            }
+
+        private:
+            static constexpr int LIVE_OBJECTS = 20000;
+            static constexpr int CHURN_PER_FRAME = 2000;
+
+            std::vector<std::unique_ptr<engine::object::GameObject>> live_;
+            int cursor_ = 0;
+            std::uint64_t frame_ = 0;
+            std::uint64_t spawn_ns_ = 0;
+            std::uint64_t destroy_ns_ = 0;
+            std::uint64_t spawned_ = 0;
+            std::vector<std::uint64_t> rss_samples_;
+
+            static std::unique_ptr<engine::object::GameObject> spawn(float x) {
+                auto object = std::make_unique<engine::object::GameObject>("churn", "bullet");
+                object->addComponent<engine::object::components::TransformComponent>(glm::vec2(x, 0.0f));
+                return object;
+            }
+        };
+
+        /// @brief Half of a large scene despawned and as many objects spawned every frame,
+        /// through the scene's deferred removal and addition.
+        class SceneChurnScenario final : public Scenario {
+        public:
+            std::string_view getName() const override { return "scene_churn"; }
+            std::string_view getDescription() const override { return "100k GameObjects removed from and added to a scene every frame."; }
+
+            void populate(BenchHarness& /*harness*/, BenchScene& scene) override {
+                names_.reserve(NAME_COUNT);
+                for (int i = 0; i < NAME_COUNT; ++i) {
+                    names_.push_back("enemy_" + std::to_string(i));
+                }
+
+                for (int i = 0; i < 2 * CHURN_PER_FRAME; ++i) {
+                    scene.addGameObject(spawn(i));
+                }
+            }
+
+            void update(BenchHarness& harness, float /*delta_time*/) override {
+                engine::scene::Scene* scene = harness.getScene();
+                if (!scene) {
+                    return;
+                }
+
+                // Every other object leaves; the scene applies both at the end of next update
+                std::uint64_t start_ns = SDL_GetTicksNS();
+                const auto& objects = scene->getGameObjects();
+                for (std::size_t i = parity_; i < objects.size(); i += 2) {
+                    scene->safeRemoveGameObject(objects[i].get());
+                }
+
+                std::uint64_t middle_ns = SDL_GetTicksNS();
+                for (int i = 0; i < CHURN_PER_FRAME; ++i) {
+                    scene->safeAddGameObject(spawn(next_name_++));
+                }
+
+                remove_ns_ += middle_ns - start_ns;
+                spawn_ns_ += SDL_GetTicksNS() - middle_ns;
+                churned_ += CHURN_PER_FRAME;
+                parity_ ^= 1;
+            }
+
+            void report(BenchHarness& harness, nlohmann::ordered_json& metrics) override {
+                double churned = churned_ > 0 ? static_cast<double>(churned_) : 1.0;
+                metrics["objects"] = harness.getScene() ? harness.getScene()->getGameObjects().size() : 0;
+                metrics["churn_per_frame"] = CHURN_PER_FRAME;
+                metrics["names"] = NAME_COUNT;
+                metrics["ns_per_mark_removed"] = static_cast<double>(remove_ns_) / churned;
+                metrics["ns_per_spawn_queued"] = static_cast<double>(spawn_ns_) / churned;
+            }
+
+        private:
+            static constexpr int CHURN_PER_FRAME = 100000;
+            static constexpr int NAME_COUNT = 1024;
+
+            std::vector<std::string> names_;
+            int next_name_ = 0;
+            std::size_t parity_ = 0;
+            std::uint64_t remove_ns_ = 0;
+            std::uint64_t spawn_ns_ = 0;
+            std::uint64_t churned_ = 0;
+
+            std::unique_ptr<engine::object::GameObject> spawn(int index) const {
+                auto object = std::make_unique<engine::object::GameObject>(names_[index % NAME_COUNT], "enemy");
+                object->addComponent<engine::object::components::TransformComponent>(
+                    glm::vec2(static_cast<float>(index % 1000), static_cast<float>(index / 1000))
+                );
+                return object;
+            }
+        };
+
+        /// @brief One of the scenes swapped by SceneCyclingScenario: sprites over the
+        /// textures every such scene shares.
+        class CycledScene final : public engine::scene::Scene {
+        public:
+            CycledScene(
+                std::string_view name,
+                engine::core::Context& context,
+                engine::scene::SceneManager& scene_manager,
+                const std::vector<std::string>& textures
+            )
+                : engine::scene::Scene(name, context, scene_manager)
+                , textures_(textures)
+            {}
+
+            void init() override {
+                auto& resource_manager = context_.getResourceManager();
+                for (std::size_t i = 0; i < textures_.size(); ++i) {
+                    auto object = std::make_unique<engine::object::GameObject>("cycled");
+                    object->addComponent<engine::object::components::TransformComponent>(glm::vec2(static_cast<float>(i) * 32.0f, 0.0f));
+                    object->addComponent<engine::object::components::SpriteComponent>(textures_[i], resource_manager);
+                    addGameObject(std::move(object));
+                }
+                Scene::init();
+            }
+
+        private:
+            const std::vector<std::string>& textures_;
+        };
+
+        /// @brief Two scenes sharing their textures replaced by one another, with an overlay
+        /// pushed and popped over each, thousands of times. The shared textures must never
+        /// be reloaded and the tracked resources must not grow.
+        class SceneCyclingScenario final : public Scenario {
+        public:
+            std::string_view getName() const override { return "scene_cycling"; }
+            std::string_view getDescription() const override { return "Scenes sharing textures replaced and overlaid thousands of times; no reloads."; }
+
+            void populate(BenchHarness& harness, BenchScene& /*scene*/) override {
+                fs::path dir = generatedAssetDir();
+                for (int i = 0; i < TEXTURE_COUNT; ++i) {
+                    textures_.push_back(writeTexture(dir, 920 + i, 32));
+                }
+
+                // A scene manager of its own: replacing the bench's scene would end the run
+                scene_manager_ = std::make_unique<engine::scene::SceneManager>(harness.getContext());
+            }
+
+            void update(BenchHarness& harness, float delta_time) override {
+                if (!scene_manager_) {
+                    return;
+                }
+
+                auto& context = harness.getContext();
+                auto& resource_manager = context.getResourceManager();
+                std::uint64_t start_ns = SDL_GetTicksNS();
+                for (int i = 0; i < CYCLES_PER_FRAME; ++i) {
+                    const char* name = cycles_ % 2 == 0 ? "cycled_a" : "cycled_b";
+                    scene_manager_->requestReplaceScene(std::make_unique<CycledScene>(name, context, *scene_manager_, textures_));
+                    scene_manager_->update(delta_time);
+                    scene_manager_->requestPushScene(std::make_unique<CycledScene>("cycled_overlay", context, *scene_manager_, textures_));
+                    scene_manager_->update(delta_time);
+                    scene_manager_->requestPopScene();
+                    scene_manager_->update(delta_time);
+
+                    // What the replaced and popped scenes released is unloaded here, unless
+                    // the scene now on the stack acquired it again
+                    resource_manager.endFrame();
+                    ++cycles_;
+
+                    if (cycles_ == 1) {
+                        baseline_loads_ = resource_manager.getTextureStats().misses;
+                        baseline_tracked_ = resource_manager.getTrackedResourceCount();
+                    }
+                }
+                cycle_ns_ += SDL_GetTicksNS() - start_ns;
+
+                max_tracked_ = std::max(max_tracked_, resource_manager.getTrackedResourceCount());
+                if (rss_samples_.size() < RSS_SAMPLES && cycles_ % (60 * CYCLES_PER_FRAME) == 0) {
+                    rss_samples_.push_back(getResidentBytes());
+                }
+            }
+
+            void report(BenchHarness& harness, nlohmann::ordered_json& metrics) override {
+                auto& resource_manager = harness.getContext().getResourceManager();
+                loads_after_first_cycle_ = resource_manager.getTextureStats().misses - baseline_loads_;
+                final_tracked_ = resource_manager.getTrackedResourceCount();
+
+                metrics["cycles"] = cycles_;
+                metrics["textures_shared"] = TEXTURE_COUNT;
+                metrics["ns_per_cycle"] = cycles_ > 0 ? static_cast<double>(cycle_ns_) / static_cast<double>(cycles_) : 0.0;
+                metrics["texture_loads_after_first_cycle"] = loads_after_first_cycle_;
+                metrics["tracked_resources"] = {{"after_first_cycle", baseline_tracked_}, {"max", max_tracked_}, {"final", final_tracked_}};
+                auto rss_mb = nlohmann::ordered_json::array();
+                for (auto bytes : rss_samples_) {
+                    rss_mb.push_back(static_cast<double>(bytes) / (1024.0 * 1024.0));
+                }
+                metrics["rss_mb_every_60_frames"] = std::move(rss_mb);
+
+                if (scene_manager_) {
+                    scene_manager_->close();
+                    scene_manager_.reset();
+                    resource_manager.endFrame();
+                }
+            }
+
+            std::string check(BenchHarness& /*harness*/) override {
+                if (cycles_ == 0) {
+                    return "no scene was cycled.";
+                }
+                if (loads_after_first_cycle_ > 0) {
+                    return std::to_string(loads_after_first_cycle_) + " shared textures were reloaded while cycling scenes.";
+                }
+                if (max_tracked_ != baseline_tracked_ || final_tracked_ != baseline_tracked_) {
+                    return "tracked resources went from " + std::to_string(baseline_tracked_) + " to " +
+                           std::to_string(max_tracked_) + " while cycling scenes.";
+                }
+                return {};
+            }
+
+        private:
+            static constexpr int TEXTURE_COUNT = 16;
+            static constexpr int CYCLES_PER_FRAME = 8;
+            static constexpr std::size_t RSS_SAMPLES = 32;
+
+            std::vector<std::string> textures_;
+            std::unique_ptr<engine::scene::SceneManager> scene_manager_;
+            std::uint64_t cycles_ = 0;
+            std::uint64_t cycle_ns_ = 0;
+            std::uint64_t baseline_loads_ = 0;
+            std::uint64_t loads_after_first_cycle_ = 0;
+            std::size_t baseline_tracked_ = 0;
+            std::size_t max_tracked_ = 0;
+            std::size_t final_tracked_ = 0;
+            std::vector<std::uint64_t> rss_samples_;
+        };
+
+        /// @brief PNG textures loaded again and again, decoded and uploaded with the texture
+        /// cache off, then from their `.stex` cache entries with it on.
+        class TextureCacheScenario final : public Scenario {
+        public:
+            std::string_view getName() const override { return "texture_cache"; }
+            std::string_view getDescription() const override { return "PNG decode and upload against .stex texture cache hits."; }
+
+            void populate(BenchHarness& harness, BenchScene& /*scene*/) override {
+                fs::path dir = generatedAssetDir();
+                for (int i = 0; i < TEXTURE_COUNT; ++i) {
+                    std::string path = (dir / ("cached_texture_" + std::to_string(i) + ".png")).generic_string();
+                    if (!fs::exists(path) && !writePattern(path, i)) {
+                        failures_.push_back("'" + path + "' could not be written");
+                        continue;
+                    }
+                    png_bytes_ += fs::file_size(path);
+                    paths_.push_back(std::move(path));
+                }
+
+                // Make sure every texture has its cache entry before anything is timed
+                auto& resource_manager = harness.getContext().getResourceManager();
+                resource_manager.setTextureCacheEnabled(true);
+                for (const auto& path : paths_) {
+                    resource_manager.loadTexture(path);
+                    resource_manager.unloadTexture(path);
+                }
+            }
+
+            void update(BenchHarness& harness, float /*delta_time*/) override {
+                if (paths_.empty()) {
+                    return;
+                }
+
+                auto& resource_manager = harness.getContext().getResourceManager();
+                auto before = resource_manager.getTextureStats();
+                const std::string& path = paths_[next_++ % paths_.size()];
+
+                resource_manager.setTextureCacheEnabled(false);
+                decode_ns_ += timeLoad(resource_manager, path);
+                resource_manager.setTextureCacheEnabled(true);
+                hit_ns_ += timeLoad(resource_manager, path);
+                ++loads_;
+
+                // One of each, or the timings above are not what they claim to be
+                auto after = resource_manager.getTextureStats();
+                if (after.decodes - before.decodes != 1 || after.cache_hits - before.cache_hits != 1) {
+                    ++mislabelled_loads_;
+                }
+            }
+
+            void report(BenchHarness& harness, nlohmann::ordered_json& metrics) override {
+                double loads = loads_ > 0 ? static_cast<double>(loads_) : 1.0;
+                double decode_us = static_cast<double>(decode_ns_) / 1000.0 / loads;
+                double hit_us = static_cast<double>(hit_ns_) / 1000.0 / loads;
+                metrics["textures"] = paths_.size();
+                metrics["texture_size"] = TEXTURE_SIZE;
+                metrics["png_bytes"] = png_bytes_;
+                metrics["us_per_png_decode_and_upload"] = decode_us;
+                metrics["us_per_cache_hit"] = hit_us;
+                metrics["cache_speedup"] = hit_us > 0.0 ? decode_us / hit_us : 0.0;
+
+                auto& resource_manager = harness.getContext().getResourceManager();
+                for (const auto& path : paths_) {
+                    resource_manager.unloadTexture(path);
+                }
+            }
+
+            std::string check(BenchHarness& /*harness*/) override {
+                if (mislabelled_loads_ > 0) {
+                    failures_.push_back(std::to_string(mislabelled_loads_) + " frames did not decode once and hit the cache once");
+                }
+                if (bad_sizes_ > 0) {
+                    failures_.push_back(std::to_string(bad_sizes_) + " loads produced a texture of the wrong size");
+                }
+                std::string result;
+                for (const auto& failure : failures_) {
+                    result += (result.empty() ? "" : "; ") + failure;
+                }
+                return result.empty() ? result : result + ".";
+            }
+
+        private:
+            static constexpr int TEXTURE_COUNT = 8;
+            static constexpr int TEXTURE_SIZE = 512;
+
+            std::vector<std::string> paths_;
+            std::vector<std::string> failures_;
+            std::uintmax_t png_bytes_ = 0;
+            std::size_t next_ = 0;
+            std::uint64_t loads_ = 0;
+            std::uint64_t decode_ns_ = 0;
+            std::uint64_t hit_ns_ = 0;
+            std::uint64_t mislabelled_loads_ = 0;
+            std::uint64_t bad_sizes_ = 0;
+
+            /// @brief Unload `path`, then time loading it back; untimed, check its size.
+            std::uint64_t timeLoad(engine::resource::ResourceManager& resource_manager, const std::string& path) {
+                resource_manager.unloadTexture(path);
+                std::uint64_t start_ns = SDL_GetTicksNS();
+                SDL_Texture* texture = resource_manager.loadTexture(path);
+                std::uint64_t elapsed_ns = SDL_GetTicksNS() - start_ns;
+
+                float width = 0.0f;
+                float height = 0.0f;
+                if (!texture || !SDL_GetTextureSize(texture, &width, &height) || width != TEXTURE_SIZE || height != TEXTURE_SIZE) {
+                    ++bad_sizes_;
+                }
+                return elapsed_ns;
+            }
+
+            /// @brief A PNG that does not compress to nothing, so decoding it costs something.
+            static bool writePattern(const std::string& path, int index) {
+                SDL_Surface* surface = SDL_CreateSurface(TEXTURE_SIZE, TEXTURE_SIZE, SDL_PIXELFORMAT_RGBA32);
+                if (!surface) {
+                    return false;
+                }
+
+                Lcg random(static_cast<std::uint32_t>(320 + index));
+                for (int y = 0; y < TEXTURE_SIZE; ++y) {
+                    auto* row = static_cast<std::uint8_t*>(surface->pixels) + static_cast<std::ptrdiff_t>(y) * surface->pitch;
+                    for (int x = 0; x < TEXTURE_SIZE; ++x) {
+                        std::uint32_t noise = random.next();
+                        row[x * 4 + 0] = static_cast<std::uint8_t>(x ^ y ^ index);
+                        row[x * 4 + 1] = static_cast<std::uint8_t>((x * y) >> 4);
+                        row[x * 4 + 2] = static_cast<std::uint8_t>(noise & 0x3F);
+                        row[x * 4 + 3] = 255;
+                    }
+                }
+
+                bool saved = IMG_SavePNG(surface, path.c_str());
+                SDL_DestroySurface(surface);
+                return saved;
+            }
+        };
+
+        /// @brief Thousands of small assets read from a memory-mapped pack and, for
+        /// comparison, opened one by one as loose files.
+        class AssetPackScenario final : public Scenario {
+        public:
+            std::string_view getName() const override { return "asset_pack"; }
+            std::string_view getDescription() const override { return "Pack mount and lookups against loose-file opens, cold and warm."; }
+
+            void populate(BenchHarness& /*harness*/, BenchScene& /*scene*/) override {
+                fs::path dir = generatedAssetDir() / "pack_assets";
+                fs::create_directories(dir);
+
+                Lcg random(31);
+                std::vector<std::byte> bytes;
+                for (int i = 0; i < ASSET_COUNT; ++i) {
+                    std::string path = (dir / ("asset_" + std::to_string(i) + ".bin")).generic_string();
+                    bytes.resize(512 + random.next() % 3584);
+                    for (auto& byte : bytes) {
+                        byte = static_cast<std::byte>(random.next());
+                    }
+                    std::ofstream(path, std::ios::binary | std::ios::trunc).write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+                    paths_.push_back(std::move(path));
+                }
+
+                std::string pack_path = (generatedAssetDir() / "bench_assets.pak").generic_string();
+                if (!writePack(pack_path)) {
+                    failures_.push_back("the pack could not be written");
+                    return;
+                }
+
+                // Cold: the first mount and the first read of each asset, pack then loose
+                std::uint64_t start_ns = SDL_GetTicksNS();
+                if (!locator_.mount(pack_path)) {
+                    failures_.push_back("the pack could not be mounted");
+                    return;
+                }
+                mount_cold_ns_ = SDL_GetTicksNS() - start_ns;
+
+                std::uint64_t loose_hash = engine::utils::FNV1A_OFFSET_BASIS;
+                std::uint64_t pack_hash = engine::utils::FNV1A_OFFSET_BASIS;
+                start_ns = SDL_GetTicksNS();
+                for (const auto& path : paths_) {
+                    pack_hash = readPacked(path, pack_hash);
+                }
+                std::uint64_t middle_ns = SDL_GetTicksNS();
+                for (const auto& path : paths_) {
+                    loose_hash = readLoose(path, loose_hash);
+                }
+                pack_cold_ns_ = middle_ns - start_ns;
+                loose_cold_ns_ = SDL_GetTicksNS() - middle_ns;
+
+                if (pack_hash != loose_hash) {
+                    failures_.push_back("packed assets differ from the loose files");
+                }
+
+                // Warm: the OS has the pack's pages and the files' metadata cached by now
+                engine::resource::AssetLocator remount;
+                start_ns = SDL_GetTicksNS();
+                remount.mount(pack_path);
+                mount_warm_ns_ = SDL_GetTicksNS() - start_ns;
+            }
+
+            void update(BenchHarness& /*harness*/, float /*delta_time*/) override {
+                if (locator_.getPackCount() == 0) {
+                    return;
+                }
+
+                std::uint64_t pack_hash = engine::utils::FNV1A_OFFSET_BASIS;
+                std::uint64_t loose_hash = engine::utils::FNV1A_OFFSET_BASIS;
+                std::uint64_t start_ns = SDL_GetTicksNS();
+                std::uint32_t first = random_.next();
+                for (int i = 0; i < LOOKUPS_PER_FRAME; ++i) {
+                    pack_hash = readPacked(paths_[(first + i * 7919u) % paths_.size()], pack_hash);
+                }
+                std::uint64_t middle_ns = SDL_GetTicksNS();
+                for (int i = 0; i < LOOKUPS_PER_FRAME; ++i) {
+                    loose_hash = readLoose(paths_[(first + i * 7919u) % paths_.size()], loose_hash);
+                }
+                pack_warm_ns_ += middle_ns - start_ns;
+                loose_warm_ns_ += SDL_GetTicksNS() - middle_ns;
+                warm_reads_ += LOOKUPS_PER_FRAME;
+                mismatched_frames_ += pack_hash != loose_hash ? 1 : 0;
+            }
+
+            void report(BenchHarness& /*harness*/, nlohmann::ordered_json& metrics) override {
+                auto per_asset_us = [](std::uint64_t ns, std::uint64_t count) {
+                    return count > 0 ? static_cast<double>(ns) / 1000.0 / static_cast<double>(count) : 0.0;
+                };
+                metrics["assets"] = ASSET_COUNT;
+                metrics["lookups_per_frame"] = LOOKUPS_PER_FRAME;
+                metrics["mount_ms"] = {
+                    {"cold", static_cast<double>(mount_cold_ns_) / 1.0e6},
+                    {"warm", static_cast<double>(mount_warm_ns_) / 1.0e6},
+                };
+                metrics["us_per_asset"] = {
+                    {"pack_cold", per_asset_us(pack_cold_ns_, ASSET_COUNT)},
+                    {"loose_cold", per_asset_us(loose_cold_ns_, ASSET_COUNT)},
+                    {"pack_warm", per_asset_us(pack_warm_ns_, warm_reads_)},
+                    {"loose_warm", per_asset_us(loose_warm_ns_, warm_reads_)},
+                };
+            }
+
+            std::string check(BenchHarness& /*harness*/) override {
+                if (mismatched_frames_ > 0) {
+                    failures_.push_back(std::to_string(mismatched_frames_) + " frames read different bytes from the pack");
+                }
+                std::string result;
+                for (const auto& failure : failures_) {
+                    result += (result.empty() ? "" : "; ") + failure;
+                }
+                return result.empty() ? result : result + ".";
+            }
+
+        private:
+            static constexpr int ASSET_COUNT = 3000;
+            static constexpr int LOOKUPS_PER_FRAME = 256;
+
+            std::vector<std::string> paths_;
+            engine::resource::AssetLocator locator_;
+            std::vector<std::byte> buffer_;
+            Lcg random_{32};
+            std::vector<std::string> failures_;
+            std::uint64_t mount_cold_ns_ = 0;
+            std::uint64_t mount_warm_ns_ = 0;
+            std::uint64_t pack_cold_ns_ = 0;
+            std::uint64_t loose_cold_ns_ = 0;
+            std::uint64_t pack_warm_ns_ = 0;
+            std::uint64_t loose_warm_ns_ = 0;
+            std::uint64_t warm_reads_ = 0;
+            std::uint64_t mismatched_frames_ = 0;
+
+            /// @brief Read a whole asset the way the decoders do, through an SDL_IOStream.
+            std::uint64_t readStream(SDL_IOStream* stream, std::uint64_t hash) {
+                if (!stream) {
+                    return hash + 1;
+                }
+                buffer_.resize(static_cast<std::size_t>(std::max<Sint64>(0, SDL_GetIOSize(stream))));
+                std::size_t read = SDL_ReadIO(stream, buffer_.data(), buffer_.size());
+                SDL_CloseIO(stream);
+                return engine::utils::fnv1a64(buffer_.data(), read, hash);
+            }
+
+            std::uint64_t readPacked(const std::string& path, std::uint64_t hash) {
+                return readStream(locator_.openStream(path), hash);
+            }
+
+            std::uint64_t readLoose(const std::string& path, std::uint64_t hash) {
+                return readStream(SDL_IOFromFile(path.c_str(), "rb"), hash);
+            }
+
+            /// @brief Pack the generated assets in the layout asset_packer writes.
+            bool writePack(const std::string& pack_path) const {
+                using engine::resource::AssetPack;
+                std::ofstream out(pack_path, std::ios::binary | std::ios::trunc);
+                AssetPack::Header header{};
+                std::memcpy(header.magic, AssetPack::MAGIC, sizeof(header.magic));
+                header.version = AssetPack::VERSION;
+                header.entry_count = static_cast<std::uint32_t>(paths_.size());
+                header.alignment = AssetPack::DEFAULT_ALIGNMENT;
+                out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+                static const char zeros[AssetPack::DEFAULT_ALIGNMENT] = {};
+                std::uint64_t position = sizeof(header);
+                auto pad = [&]() {
+                    std::uint64_t aligned = AssetPack::DEFAULT_ALIGNMENT * ((position + AssetPack::DEFAULT_ALIGNMENT - 1) / AssetPack::DEFAULT_ALIGNMENT);
+                    out.write(zeros, static_cast<std::streamsize>(aligned - position));
+                    position = aligned;
+                };
+
+                std::vector<AssetPack::EntryRecord> records;
+                std::vector<char> bytes;
+                for (const auto& path : paths_) {
+                    std::ifstream in(path, std::ios::binary | std::ios::ate);
+                    bytes.resize(static_cast<std::size_t>(in.tellg()));
+                    in.seekg(0);
+                    in.read(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+
+                    pad();
+                    records.push_back({position, bytes.size(), bytes.size(), static_cast<std::uint32_t>(AssetPack::Compression::NONE), static_cast<std::uint32_t>(path.size())});
+                    out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+                    position += bytes.size();
+                }
+
+                pad();
+                header.toc_offset = position;
+                for (std::size_t i = 0; i < paths_.size(); ++i) {
+                    out.write(reinterpret_cast<const char*>(&records[i]), sizeof(records[i]));
+                    out.write(paths_[i].data(), static_cast<std::streamsize>(paths_[i].size()));
+                    position += sizeof(records[i]) + paths_[i].size();
+                }
+                header.toc_size = position - header.toc_offset;
+                out.seekp(0);
+                out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+                return static_cast<bool>(out);
+            }
+        };
+
+        /// @brief Name and tag queries on a large scene, through the scene's index and, for
+        /// comparison, by scanning its objects.
+        class ObjectQueriesScenario final : public Scenario {
+        public:
+            std::string_view getName() const override { return "object_queries"; }
+            std::string_view getDescription() const override { return "Name and tag lookups in a 100k-object scene: index versus linear scan."; }
+
+            void populate(BenchHarness& /*harness*/, BenchScene& scene) override {
+                names_.reserve(OBJECT_COUNT);
+                for (int i = 0; i < TAG_COUNT; ++i) {
+                    tags_.push_back("team_" + std::to_string(i));
+                }
+
+                for (int i = 0; i < OBJECT_COUNT; ++i) {
+                    names_.push_back("object_" + std::to_string(i));
+                    scene.addGameObject(std::make_unique<engine::object::GameObject>(names_.back(), tags_[i % TAG_COUNT]));
+                }
+            }
+
+            void update(BenchHarness& harness, float /*delta_time*/) override {
+                engine::scene::Scene* scene = harness.getScene();
+                if (!scene) {
+                    return;
+                }
+
+                // Same kind of queries both ways; the checksum keeps either from being optimized out
+                std::uint64_t t0 = SDL_GetTicksNS();
+                for (int i = 0; i < INDEXED_LOOKUPS; ++i) {
+                    checksum_ += scene->findGameObjectByName(names_[random_.next() % OBJECT_COUNT]) != nullptr;
+                }
+
+                std::uint64_t t1 = SDL_GetTicksNS();
+                for (int i = 0; i < TAG_QUERIES; ++i) {
+                    checksum_ += scene->findGameObjectsByTag(tags_[random_.next() % TAG_COUNT]).size();
+                }
+
+                std::uint64_t t2 = SDL_GetTicksNS();
+                const auto& objects = scene->getGameObjects();
+                for (int i = 0; i < SCANNED_LOOKUPS; ++i) {
+                    std::string_view name = names_[random_.next() % OBJECT_COUNT];
+                    auto it = std::find_if(objects.begin(), objects.end(), [name](const auto& obj) {
+                        return obj->getName() == name;
+                    });
+                    checksum_ += it != objects.end();
+                }
+
+                std::uint64_t t3 = SDL_GetTicksNS();
+                for (int i = 0; i < TAG_QUERIES; ++i) {
+                    std::string_view tag = tags_[random_.next() % TAG_COUNT];
+                    checksum_ += std::count_if(objects.begin(), objects.end(), [tag](const auto& obj) {
+                        return obj->getTag() == tag;
+                    });
+                }
+
+                std::uint64_t t4 = SDL_GetTicksNS();
+                indexed_name_ns_ += t1 - t0;
+                indexed_tag_ns_ += t2 - t1;
+                scanned_name_ns_ += t3 - t2;
+                scanned_tag_ns_ += t4 - t3;
+                ++frames_;
+            }
+
+            void report(BenchHarness& /*harness*/, nlohmann::ordered_json& metrics) override {
+                double frames = frames_ > 0 ? static_cast<double>(frames_) : 1.0;
+                metrics["objects"] = OBJECT_COUNT;
+                metrics["tags"] = TAG_COUNT;
+                metrics["name_lookup_ns"] = {
+                    {"indexed", static_cast<double>(indexed_name_ns_) / (frames * INDEXED_LOOKUPS)},
+                    {"scanned", static_cast<double>(scanned_name_ns_) / (frames * SCANNED_LOOKUPS)},
+                };
+                metrics["tag_query_ns"] = {
+                    {"indexed", static_cast<double>(indexed_tag_ns_) / (frames * TAG_QUERIES)},
+                    {"scanned", static_cast<double>(scanned_tag_ns_) / (frames * TAG_QUERIES)},
+                };
+                metrics["checksum"] = checksum_;
+            }
+
+        private:
+            static constexpr int OBJECT_COUNT = 100000;
+            static constexpr int TAG_COUNT = 16;
+            static constexpr int INDEXED_LOOKUPS = 1024;
+            static constexpr int SCANNED_LOOKUPS = 16;
+            static constexpr int TAG_QUERIES = 4;
+
+            std::vector<std::string> names_;
+            std::vector<std::string> tags_;
+            Lcg random_{5};
+            std::uint64_t indexed_name_ns_ = 0;
+            std::uint64_t indexed_tag_ns_ = 0;
+            std::uint64_t scanned_name_ns_ = 0;
+            std::uint64_t scanned_tag_ns_ = 0;
+            std::uint64_t frames_ = 0;
+            std::uint64_t checksum_ = 0;
+        };
+
+        /// @brief The physics broadphase on populations of 10k to 100k moving boxes, at the
+        /// same density, so the pair throughput shows how it scales with the body count.
+        class PhysicsBroadphaseScenario final : public Scenario {
+        public:
+            std::string_view getName() const override { return "physics_broadphase"; }
+            std::string_view getDescription() const override { return "Spatial-hash broadphase over 10k-100k moving bodies."; }
+
+            void populate(BenchHarness& /*harness*/, BenchScene& /*scene*/) override {
+                Lcg random(11);
+                for (std::size_t i = 0; i < BODY_COUNTS.size(); ++i) {
+                    auto& population = populations_[i];
+                    auto count = BODY_COUNTS[i];
+
+                    // Same area per body in every world
+                    population.world_size = std::sqrt(static_cast<float>(count)) * AREA_PER_BODY_SIDE;
+                    population.x.resize(count);
+                    population.y.resize(count);
+                    population.vx.resize(count);
+                    population.vy.resize(count);
+                    population.size.resize(count);
+                    for (std::size_t body = 0; body < count; ++body) {
+                        population.x[body] = random.nextFloat(population.world_size);
+                        population.y[body] = random.nextFloat(population.world_size);
+                        population.vx[body] = random.nextFloat(2.0f * MAX_SPEED) - MAX_SPEED;
+                        population.vy[body] = random.nextFloat(2.0f * MAX_SPEED) - MAX_SPEED;
+                        population.size[body] = 8.0f + random.nextFloat(16.0f);
+                    }
+                    population.aabbs.reserve(count);
+                }
+            }
+
+            void update(BenchHarness& /*harness*/, float delta_time) override {
+                for (auto& population : populations_) {
+                    population.move(delta_time);
+
+                    std::uint64_t start_ns = SDL_GetTicksNS();
+                    population.broadphase.findPairs(population.aabbs, population.pairs);
+                    population.broadphase_ns += SDL_GetTicksNS() - start_ns;
+
+                    population.pair_total += population.pairs.size();
+                    population.test_total += population.broadphase.getTestCount();
+                }
+                ++frames_;
+            }
+
+            void report(BenchHarness& /*harness*/, nlohmann::ordered_json& metrics) override {
+                double frames = frames_ > 0 ? static_cast<double>(frames_) : 1.0;
+                metrics["cell_size"] = CELL_SIZE;
+
+                auto populations = nlohmann::ordered_json::array();
+                for (std::size_t i = 0; i < BODY_COUNTS.size(); ++i) {
+                    const auto& population = populations_[i];
+                    double broadphase_ms = static_cast<double>(population.broadphase_ns) / 1000000.0;
+                    populations.push_back({
+                        {"bodies", BODY_COUNTS[i]},
+                        {"world_size", population.world_size},
+                        {"pairs_per_frame", static_cast<double>(population.pair_total) / frames},
+                        {"tests_per_frame", static_cast<double>(population.test_total) / frames},
+                        {"broadphase_us", broadphase_ms * 1000.0 / frames},
+                        {"pairs_per_ms", broadphase_ms > 0.0 ? static_cast<double>(population.pair_total) / broadphase_ms : 0.0},
+                        {"bodies_per_ms", broadphase_ms > 0.0 ? static_cast<double>(BODY_COUNTS[i]) * frames / broadphase_ms : 0.0},
+                    });
+                }
+                metrics["populations"] = std::move(populations);
+            }
+
+        private:
+            static constexpr std::array<std::size_t, 4> BODY_COUNTS = {10000, 25000, 50000, 100000};
+            static constexpr float AREA_PER_BODY_SIDE = 48.0f;
+            static constexpr float MAX_SPEED = 120.0f;
+            static constexpr float CELL_SIZE = 32.0f;
+
+            /// @brief Bodies bouncing inside a square world.
+            struct Population {
+                std::vector<float> x;
+                std::vector<float> y;
+                std::vector<float> vx;
+                std::vector<float> vy;
+                std::vector<float> size;
+                float world_size = 0.0f;
+
+                engine::physics::AabbArrays aabbs;
+                engine::physics::SpatialHashBroadphase broadphase{CELL_SIZE};
+                std::vector<engine::physics::BodyPair> pairs;
+
+                std::uint64_t broadphase_ns = 0;
+                std::uint64_t pair_total = 0;
+                std::uint64_t test_total = 0;
+
+                void move(float delta_time) {
+                    aabbs.clear();
+                    for (std::size_t i = 0; i < x.size(); ++i) {
+                        x[i] += vx[i] * delta_time;
+                        y[i] += vy[i] * delta_time;
+                        if (x[i] < 0.0f || x[i] > world_size) {
+                            vx[i] = -vx[i];
+                        }
+                        if (y[i] < 0.0f || y[i] > world_size) {
+                            vy[i] = -vy[i];
+                        }
+                        aabbs.push(x[i], y[i], x[i] + size[i], y[i] + size[i]);
+                    }
+                }
+            };
+
+            std::array<Population, BODY_COUNTS.size()> populations_;
+            std::uint64_t frames_ = 0;
+        };
+
+        /// @brief The same rigid-body world stepped with 1 to 8 physics threads: how the
+        /// step scales, and whether every thread count gives bit-identical positions.
+        class PhysicsScalingScenario final : public Scenario {
+        public:
+            std::string_view getName() const override { return "physics_scaling"; }
+            std::string_view getDescription() const override { return "32k colliding bodies stepped with 1, 2, 4 and 8 physics threads."; }
+
+            void populate(BenchHarness& /*harness*/, BenchScene& /*scene*/) override {
+                for (std::size_t i = 0; i < THREAD_COUNTS.size(); ++i) {
+                    worlds_[i].engine = std::make_unique<engine::physics::PhysicsEngine>(CELL_SIZE, THREAD_COUNTS[i]);
+                    buildWorld(worlds_[i]);
+                }
+            }
+
+            void update(BenchHarness& /*harness*/, float delta_time) override {
+                for (std::size_t i = 0; i < THREAD_COUNTS.size(); ++i) {
+                    auto& world = worlds_[i];
+
+                    std::uint64_t start_ns = SDL_GetTicksNS();
+                    world.engine->update(delta_time);
+                    world.step_ns += SDL_GetTicksNS() - start_ns;
+                    world.contact_total += world.engine->getContacts().size();
+                    world.island_total += world.engine->getIslandCount();
+
+                    // Every world must match the single-threaded one exactly
+                    std::uint64_t hash = hashPositions(world);
+                    if (i == 0) {
+                        reference_hash_ = hash;
+                    } else if (hash != reference_hash_ && diverged_threads_ == 0) {
+                        diverged_threads_ = THREAD_COUNTS[i];
+                        diverged_frame_ = frames_;
+                    }
+                }
+                ++frames_;
+            }
+
+            void report(BenchHarness& /*harness*/, nlohmann::ordered_json& metrics) override {
+                double frames = frames_ > 0 ? static_cast<double>(frames_) : 1.0;
+                metrics["bodies"] = BODY_COUNT;
+                metrics["kernels"] = worlds_[0].engine ? worlds_[0].engine->getKernelName() : "";
+                metrics["deterministic"] = diverged_threads_ == 0;
+
+                auto runs = nlohmann::ordered_json::array();
+                double single_thread_us = 0.0;
+                for (std::size_t i = 0; i < THREAD_COUNTS.size(); ++i) {
+                    const auto& world = worlds_[i];
+                    double step_us = static_cast<double>(world.step_ns) / 1000.0 / frames;
+                    if (i == 0) {
+                        single_thread_us = step_us;
+                    }
+
+                    runs.push_back({
+                        {"threads", THREAD_COUNTS[i]},
+                        {"step_us", step_us},
+                        {"speedup", step_us > 0.0 ? single_thread_us / step_us : 0.0},
+                        {"contacts_per_step", static_cast<double>(world.contact_total) / frames},
+                        {"islands_per_step", static_cast<double>(world.island_total) / frames},
+                    });
+                }
+                metrics["runs"] = std::move(runs);
+            }
+
+            std::string check(BenchHarness& /*harness*/) override {
+                if (diverged_threads_ == 0) {
+                    return {};
+                }
+                return "positions with " + std::to_string(diverged_threads_) + " threads diverged from the single-threaded run at frame " + std::to_string(diverged_frame_) + ".";
+            }
+
+        private:
+            static constexpr std::array<std::size_t, 4> THREAD_COUNTS = {1, 2, 4, 8};
+            static constexpr int BODY_COUNT = 32000;
+            static constexpr float WORLD_SIZE = 5760.0f;
+            static constexpr float WALL_THICKNESS = 64.0f;
+            static constexpr float MAX_SPEED = 200.0f;
+            static constexpr float CELL_SIZE = 32.0f;
+
+            struct World {
+                // Declared first so that it outlives the bodies unregistering from it
+                std::unique_ptr<engine::physics::PhysicsEngine> engine;
+                std::vector<std::unique_ptr<engine::object::GameObject>> objects;
+                std::uint64_t step_ns = 0;
+                std::uint64_t contact_total = 0;
+                std::uint64_t island_total = 0;
+            };
+
+            std::array<World, THREAD_COUNTS.size()> worlds_;
+            std::uint64_t reference_hash_ = 0;
+            std::size_t diverged_threads_ = 0;
+            std::uint64_t diverged_frame_ = 0;
+            std::uint64_t frames_ = 0;
+
+            /// @brief A gas of bouncing boxes in a closed square: many small, short-lived islands.
+            static void buildWorld(World& world) {
+                world.engine->setGravity({0.0f, 0.0f});
+                world.engine->setRestitution(1.0f);
+
+                auto add_body = [&world](glm::vec2 position, glm::vec2 size, bool is_static) {
+                    auto object = std::make_unique<engine::object::GameObject>("body");
+                    object->addComponent<engine::object::components::TransformComponent>(position);
+                    auto* body = object->addComponent<engine::object::components::PhysicsComponent>(*world.engine, false);
+                    body->setCollider(size);
+                    body->setStatic(is_static);
+                    world.objects.push_back(std::move(object));
+                    return body;
+                };
+
+                add_body({-WALL_THICKNESS, -WALL_THICKNESS}, {WORLD_SIZE + 2.0f * WALL_THICKNESS, WALL_THICKNESS}, true);
+                add_body({-WALL_THICKNESS, WORLD_SIZE}, {WORLD_SIZE + 2.0f * WALL_THICKNESS, WALL_THICKNESS}, true);
+                add_body({-WALL_THICKNESS, 0.0f}, {WALL_THICKNESS, WORLD_SIZE}, true);
+                add_body({WORLD_SIZE, 0.0f}, {WALL_THICKNESS, WORLD_SIZE}, true);
+
+                // Same seed in every world, so they all start identical
+                Lcg random(23);
+                world.objects.reserve(world.objects.size() + BODY_COUNT);
+                for (int i = 0; i < BODY_COUNT; ++i) {
+                    float size = 8.0f + random.nextFloat(8.0f);
+                    glm::vec2 position = {random.nextFloat(WORLD_SIZE - size), random.nextFloat(WORLD_SIZE - size)};
+                    auto* body = add_body(position, {size, size}, false);
+                    body->setMass(size * size / 64.0f);
+                    body->setVelocity({random.nextFloat(2.0f * MAX_SPEED) - MAX_SPEED, random.nextFloat(2.0f * MAX_SPEED) - MAX_SPEED});
+                }
+            }
+
+            static std::uint64_t hashPositions(const World& world) {
+                std::uint64_t hash = engine::utils::FNV1A_OFFSET_BASIS;
+                for (const auto& object : world.objects) {
+                    const glm::vec2& position = object->getComponent<engine::object::components::TransformComponent>()->getPosition();
+                    hash = engine::utils::fnv1a64(&position, sizeof(position), hash);
+                }
+                return hash;
+            }
+        };
+
+        /// @brief A scene stepped in lockstep next to a replica built from the same seed, with
+        /// a different physics thread count; their per-tick state hashes must agree.
+        class LockstepScenario final : public Scenario {
+        public:
+            std::string_view getName() const override { return "lockstep"; }
+            std::string_view getDescription() const override { return "8k bodies kicked by the seeded engine RNG, hashed every tick against a 4-thread replica."; }
+
+            void populate(BenchHarness& harness, BenchScene& scene) override {
+                auto& random = harness.getContext().getRandom();
+                random.setSeed(SEED);
+                buildWorld(harness.getContext().getPhysicsEngine(), random, [&scene](auto object) {
+                    scene.addGameObject(std::move(object));
+                });
+
+                replica_engine_ = std::make_unique<engine::physics::PhysicsEngine>(CELL_SIZE, REPLICA_THREADS);
+                buildWorld(*replica_engine_, replica_random_, [this](auto object) {
+                    replica_objects_.push_back(std::move(object));
+                });
+            }
+
+            void update(BenchHarness& harness, float delta_time) override {
+                engine::scene::Scene* scene = harness.getScene();
+                if (!scene) {
+                    return;
+                }
+
+                // The scene has stepped its bodies already; the replica follows in the same order
+                kick(scene->getGameObjects(), harness.getContext().getRandom());
+                replica_engine_->update(delta_time);
+                kick(replica_objects_, replica_random_);
+
+                std::uint64_t start_ns = SDL_GetTicksNS();
+                std::uint64_t hash = harness.getSceneManager().computeStateHash();
+                hash_ns_ += SDL_GetTicksNS() - start_ns;
+
+                if (hash != engine::scene::Scene::hashTransforms(replica_objects_) && diverged_tick_ < 0) {
+                    diverged_tick_ = static_cast<std::int64_t>(ticks_);
+                }
+                last_hash_ = hash;
+                ++ticks_;
+            }
+
+            void report(BenchHarness& harness, nlohmann::ordered_json& metrics) override {
+                double ticks = ticks_ > 0 ? static_cast<double>(ticks_) : 1.0;
+                metrics["bodies"] = BODY_COUNT;
+                metrics["seed"] = SEED;
+                metrics["threads"] = harness.getContext().getPhysicsEngine().getThreadCount();
+                metrics["replica_threads"] = REPLICA_THREADS;
+                metrics["ticks"] = ticks_;
+                metrics["hash_us"] = static_cast<double>(hash_ns_) / 1000.0 / ticks;
+
+                char hash[17];
+                std::snprintf(hash, sizeof(hash), "%016llx", static_cast<unsigned long long>(last_hash_));
+                metrics["final_hash"] = hash;
+                metrics["deterministic"] = diverged_tick_ < 0;
+            }
+
+            std::string check(BenchHarness& /*harness*/) override {
+                if (diverged_tick_ < 0) {
+                    return {};
+                }
+                return "scene state diverged from its replica at tick " + std::to_string(diverged_tick_) + ".";
+            }
+
+        private:
+            static constexpr std::uint64_t SEED = 0x5eed;
+            static constexpr std::size_t REPLICA_THREADS = 4;
+            static constexpr int BODY_COUNT = 8000;
+            static constexpr int KICKS_PER_TICK = 64;
+            static constexpr float WORLD_SIZE = 2880.0f;
+            static constexpr float WALL_THICKNESS = 64.0f;
+            static constexpr float CELL_SIZE = 32.0f;
+
+            // Declared first so that it outlives the bodies unregistering from it
+            std::unique_ptr<engine::physics::PhysicsEngine> replica_engine_;
+            std::vector<std::unique_ptr<engine::object::GameObject>> replica_objects_;
+            engine::utils::Random replica_random_{SEED};
+
+            std::uint64_t ticks_ = 0;
+            std::uint64_t hash_ns_ = 0;
+            std::uint64_t last_hash_ = 0;
+            std::int64_t diverged_tick_ = -1;
+
+            /// @brief Boxes falling into a walled pit, sized and placed by `random`.
+            template <typename AddObject>
+            static void buildWorld(engine::physics::PhysicsEngine& physics_engine, engine::utils::Random& random, AddObject&& add_object) {
+                physics_engine.getBroadphase().setCellSize(CELL_SIZE);
+                physics_engine.setRestitution(0.3f);
+
+                auto add_body = [&](glm::vec2 position, glm::vec2 size, bool is_static) {
+                    auto object = std::make_unique<engine::object::GameObject>("body");
+                    object->addComponent<engine::object::components::TransformComponent>(position);
+                    auto* body = object->addComponent<engine::object::components::PhysicsComponent>(physics_engine);
+                    body->setCollider(size);
+                    body->setStatic(is_static);
+                    add_object(std::move(object));
+                    return body;
+                };
+
+                add_body({-WALL_THICKNESS, WORLD_SIZE}, {WORLD_SIZE + 2.0f * WALL_THICKNESS, WALL_THICKNESS}, true);
+                add_body({-WALL_THICKNESS, 0.0f}, {WALL_THICKNESS, WORLD_SIZE}, true);
+                add_body({WORLD_SIZE, 0.0f}, {WALL_THICKNESS, WORLD_SIZE}, true);
+
+                for (int i = 0; i < BODY_COUNT; ++i) {
+                    float size = random.range(8.0f, 16.0f);
+                    glm::vec2 position = {random.range(0.0f, WORLD_SIZE - size), random.range(0.0f, WORLD_SIZE - size)};
+                    auto* body = add_body(position, {size, size}, false);
+                    body->setMass(size * size / 64.0f);
+                }
+            }
+
+            /// @brief Throw a few random bodies upwards, so the run depends on the RNG too.
+            static void kick(const std::vector<std::unique_ptr<engine::object::GameObject>>& objects, engine::utils::Random& random) {
+                for (int i = 0; i < KICKS_PER_TICK; ++i) {
+                    auto& object = objects[static_cast<std::size_t>(random.rangeInt(0, static_cast<int>(objects.size()) - 1))];
+                    auto* body = object->getComponent<engine::object::components::PhysicsComponent>();
+                    if (body && !body->isStatic()) {
+                        body->setVelocity({random.range(-200.0f, 200.0f), random.range(-500.0f, -200.0f)});
+                    }
+                }
+            }
+        };
+
+        /// @brief A large scene snapshotted every frame and mirrored into a second scene:
+        /// by deltas in place, and every few frames from a full snapshot.
+        class SceneSnapshotScenario final : public Scenario {
+        public:
+            std::string_view getName() const override { return "scene_snapshot"; }
+            std::string_view getDescription() const override { return "100k GameObjects captured, diffed and restored into a mirror scene."; }
+
+            void populate(BenchHarness& harness, BenchScene& scene) override {
+                fs::path dir = generatedAssetDir();
+                std::vector<std::string> textures;
+                for (int i = 0; i < TEXTURE_COUNT; ++i) {
+                    textures.push_back(writeTexture(dir, i, 16));
+                }
+
+                auto& context = harness.getContext();
+                std::uint64_t start_ns = SDL_GetTicksNS();
+                for (int i = 0; i < OBJECT_COUNT; ++i) {
+                    auto object = std::make_unique<engine::object::GameObject>("entity_" + std::to_string(i % 1024), i % 2 ? "odd" : "even");
+                    object->addComponent<engine::object::components::TransformComponent>(
+                        glm::vec2(static_cast<float>(i % 1000) * 16.0f, static_cast<float>(i / 1000) * 16.0f)
+                    );
+                    if (i % PHYSICS_EVERY == 0) {
+                        object->addComponent<engine::object::components::PhysicsComponent>(context.getPhysicsEngine(), false);
+                    }
+                    if (i % SPRITE_EVERY == 0) {
+                        object->addComponent<engine::object::components::SpriteComponent>(textures[i % TEXTURE_COUNT], context.getResourceManager());
+                    }
+                    scene.addGameObject(std::move(object));
+                }
+                build_ns_ = SDL_GetTicksNS() - start_ns;
+            }
+
+            void update(BenchHarness& harness, float /*delta_time*/) override {
+                engine::scene::Scene* scene = harness.getScene();
+                if (!scene) {
+                    return;
+                }
+
+                // A few objects move each frame, as in a level where most things stand still
+                const auto& objects = scene->getGameObjects();
+                for (int i = 0; i < MOVED_PER_FRAME; ++i) {
+                    auto* transform = objects[random_.next() % objects.size()]->getComponent<engine::object::components::TransformComponent>();
+                    transform->translate({random_.nextFloat(2.0f) - 1.0f, random_.nextFloat(2.0f) - 1.0f});
+                }
+
+                std::uint64_t start_ns = SDL_GetTicksNS();
+                engine::scene::SceneSnapshot current = scene->saveSnapshot();
+                capture_ns_ += SDL_GetTicksNS() - start_ns;
+                snapshot_bytes_ = current.getBytes().size();
+                ++captures_;
+
+                if (!mirror_ || frames_ % FULL_RESTORE_EVERY == 0) {
+                    if (!mirror_) {
+                        mirror_ = std::make_unique<engine::scene::Scene>("snapshot_mirror", harness.getContext(), harness.getSceneManager());
+                    }
+
+                    start_ns = SDL_GetTicksNS();
+                    mirror_->restoreSnapshot(current);
+                    full_restore_ns_ += SDL_GetTicksNS() - start_ns;
+                    ++full_restores_;
+                } else {
+                    start_ns = SDL_GetTicksNS();
+                    engine::scene::SceneSnapshot delta = engine::scene::SceneSnapshot::diff(previous_, current);
+                    std::uint64_t middle_ns = SDL_GetTicksNS();
+                    if (delta.getKind() != engine::scene::SceneSnapshot::Kind::DELTA || !mirror_->restoreSnapshot(delta)) {
+                        ++delta_failures_;
+                    }
+
+                    diff_ns_ += middle_ns - start_ns;
+                    delta_restore_ns_ += SDL_GetTicksNS() - middle_ns;
+                    delta_bytes_ += delta.getBytes().size();
+                    delta_records_ += delta.getRecordCount();
+                    ++delta_restores_;
+                }
+
+                if (mirror_->computeStateHash() != scene->computeStateHash() && mismatch_frame_ < 0) {
+                    mismatch_frame_ = static_cast<std::int64_t>(frames_);
+                }
+
+                previous_ = std::move(current);
+                ++frames_;
+            }
+
+            void report(BenchHarness& /*harness*/, nlohmann::ordered_json& metrics) override {
+                auto per = [](std::uint64_t total, std::uint64_t count) {
+                    return count > 0 ? static_cast<double>(total) / static_cast<double>(count) : 0.0;
+                };
+
+                double full_restore_ms = per(full_restore_ns_, full_restores_) / 1000000.0;
+                metrics["objects"] = OBJECT_COUNT;
+                metrics["moved_per_frame"] = MOVED_PER_FRAME;
+                metrics["snapshot_bytes"] = snapshot_bytes_;
+                metrics["capture_ms"] = per(capture_ns_, captures_) / 1000000.0;
+                metrics["full_restore_ms"] = full_restore_ms;
+                metrics["build_ms"] = static_cast<double>(build_ns_) / 1000000.0;
+                metrics["restore_vs_build"] = build_ns_ > 0 ? full_restore_ms * 1000000.0 / static_cast<double>(build_ns_) : 0.0;
+                metrics["diff_us"] = per(diff_ns_, delta_restores_) / 1000.0;
+                metrics["delta_restore_us"] = per(delta_restore_ns_, delta_restores_) / 1000.0;
+                metrics["delta_bytes"] = per(delta_bytes_, delta_restores_);
+                metrics["delta_records"] = per(delta_records_, delta_restores_);
+                metrics["delta_failures"] = delta_failures_;
+
+                // Its bodies are registered with the harness's physics engine
+                if (mirror_) {
+                    mirror_->clean();
+                    mirror_.reset();
+                }
+            }
+
+            std::string check(BenchHarness& /*harness*/) override {
+                if (delta_failures_ > 0) {
+                    return std::to_string(delta_failures_) + " deltas could not be taken or applied.";
+                }
+                if (mismatch_frame_ >= 0) {
+                    return "restored scene differs from the original at frame " + std::to_string(mismatch_frame_) + ".";
+                }
+                return {};
+            }
+
+        private:
+            static constexpr int OBJECT_COUNT = 100000;
+            static constexpr int PHYSICS_EVERY = 4;
+            static constexpr int SPRITE_EVERY = 16;
+            static constexpr int TEXTURE_COUNT = 8;
+            static constexpr int MOVED_PER_FRAME = 1000;
+            static constexpr std::uint64_t FULL_RESTORE_EVERY = 16;
+
+            Lcg random_{31};
+            std::unique_ptr<engine::scene::Scene> mirror_;
+            engine::scene::SceneSnapshot previous_;
+
+            std::uint64_t frames_ = 0;
+            std::uint64_t build_ns_ = 0;
+            std::uint64_t capture_ns_ = 0;
+            std::uint64_t captures_ = 0;
+            std::size_t snapshot_bytes_ = 0;
+            std::uint64_t full_restore_ns_ = 0;
+            std::uint64_t full_restores_ = 0;
+            std::uint64_t diff_ns_ = 0;
+            std::uint64_t delta_restore_ns_ = 0;
+            std::uint64_t delta_bytes_ = 0;
+            std::uint64_t delta_records_ = 0;
+            std::uint64_t delta_restores_ = 0;
+            std::uint64_t delta_failures_ = 0;
+            std::int64_t mismatch_frame_ = -1;
+        };
+
+        /// @brief The upload ring's offset arithmetic: scripted wrap, grow and overflow
+        /// cases, then a stream of mixed-size uploads whose placements are validated.
+        class UploadRingScenario final : public Scenario {
+        public:
+            std::string_view getName() const override { return "upload_ring"; }
+            std::string_view getDescription() const override { return "Upload ring sub-allocation: wrap, growth and overflow under mixed upload sizes."; }
+
+            void populate(BenchHarness& /*harness*/, BenchScene& /*scene*/) override {
+                checkScriptedCases();
+                allocator_.setCapacity(INITIAL_CAPACITY);
+            }
+
+            void update(BenchHarness& /*harness*/, float /*delta_time*/) override {
+                // Mostly small vertex and uniform uploads, with now and then a texture
+                std::uint64_t start_ns = SDL_GetTicksNS();
+                std::uint32_t head = 0;
+                for (int i = 0; i < UPLOADS_PER_FRAME; ++i) {
+                    std::uint32_t size = random_.next() % 64 == 0 ? 64u * 1024u + random_.next() % (256u * 1024u) : 16u + random_.next() % 4096u;
+                    std::uint32_t alignment = ALIGNMENTS[random_.next() % ALIGNMENTS.size()];
+
+                    auto placement = allocator_.place(size, alignment);
+                    if (placement.grow_to > 0) {
+                        allocator_.setCapacity(placement.grow_to);
+                        ++grows_;
+                    } else if (placement.wraps) {
+                        ++wraps_;
+                    }
+
+                    // Aligned, inside the ring, and past the previous upload unless the ring wrapped
+                    if (placement.offset % alignment != 0 || size > allocator_.getCapacity() - placement.offset ||
+                        (!placement.wraps && placement.offset < head)) {
+                        ++bad_placements_;
+                    }
+
+                    allocator_.commit(placement, size);
+                    head = allocator_.getHead();
+                }
+
+                if (std::uint32_t grow_to = allocator_.endFrame(); grow_to > 0) {
+                    allocator_.setCapacity(grow_to);
+                    ++grows_;
+                }
+                place_ns_ += SDL_GetTicksNS() - start_ns;
+                uploads_ += UPLOADS_PER_FRAME;
+            }
+
+            void report(BenchHarness& /*harness*/, nlohmann::ordered_json& metrics) override {
+                metrics["uploads_per_frame"] = UPLOADS_PER_FRAME;
+                metrics["ns_per_upload"] = uploads_ > 0 ? static_cast<double>(place_ns_) / static_cast<double>(uploads_) : 0.0;
+                metrics["initial_capacity"] = INITIAL_CAPACITY;
+                metrics["final_capacity"] = allocator_.getCapacity();
+                metrics["wraps"] = wraps_;
+                metrics["grows"] = grows_;
+                metrics["bad_placements"] = bad_placements_;
+            }
+
+            std::string check(BenchHarness& /*harness*/) override {
+                std::string result;
+                for (const auto& failure : failures_) {
+                    result += (result.empty() ? "" : "; ") + failure;
+                }
+                if (bad_placements_ > 0) {
+                    result += (result.empty() ? "" : "; ") + std::to_string(bad_placements_) + " uploads were misplaced";
+                }
+                return result.empty() ? result : result + ".";
+            }
+
+        private:
+            static constexpr std::uint32_t INITIAL_CAPACITY = 64u * 1024u;
+            static constexpr int UPLOADS_PER_FRAME = 2000;
+            static constexpr std::array<std::uint32_t, 4> ALIGNMENTS = {1, 4, 16, 256};
+
+            engine::render::UploadRingAllocator allocator_;
+            Lcg random_{47};
+            std::vector<std::string> failures_;
+            std::uint64_t place_ns_ = 0;
+            std::uint64_t uploads_ = 0;
+            std::uint64_t wraps_ = 0;
+            std::uint64_t grows_ = 0;
+            std::uint64_t bad_placements_ = 0;
+
+            void expect(bool condition, const char* failure) {
+                if (!condition) {
+                    failures_.push_back(failure);
+                }
+            }
+
+            void checkScriptedCases() {
+                using engine::render::UploadRingAllocator;
+
+                // Wrap: what does not fit behind the last upload restarts at 0
+                UploadRingAllocator ring(1024);
+                auto first = ring.place(600, 16);
+                ring.commit(first, 600);
+                auto second = ring.place(600, 16);
+                expect(first.offset == 0 && !first.wraps, "first upload not placed at 0");
+                expect(second.wraps && second.offset == 0 && second.grow_to == 0, "full ring did not wrap");
+
+                // Alignment pads the offset
+                ring.endFrame();
+                ring.commit(ring.place(10, 1), 10);
+                expect(ring.place(8, 256).offset == 256, "upload not aligned");
+
+                // Grow: an upload larger than the ring
+                auto big = ring.place(5000, 16);
+                expect(big.wraps && big.grow_to == 8192, "oversized upload did not grow the ring");
+
+                // A frame that wrapped grows the ring so that it fits next time
+                ring.endFrame();
+                for (int i = 0; i < 3; ++i) {
+                    ring.commit(ring.place(600, 16), 600);
+                }
+                std::uint32_t grow_to = ring.endFrame();
+                expect(grow_to == 2048, "wrapped frame did not grow the ring to fit");
+                ring.setCapacity(grow_to);
+                bool wrapped = false;
+                for (int i = 0; i < 3; ++i) {
+                    auto placement = ring.place(600, 16);
+                    wrapped = wrapped || placement.wraps;
+                    ring.commit(placement, 600);
+                }
+                expect(!wrapped, "grown ring still wrapped");
+
+                // Overflow: aligning near the 32-bit limit must wrap, not come around to a low offset
+                UploadRingAllocator full(UINT32_MAX);
+                full.commit(full.place(UINT32_MAX - 8, 1), UINT32_MAX - 8);
+                auto past_end = full.place(16, 256);
+                expect(past_end.wraps && past_end.offset == 0, "aligned offset overflowed");
+
+                // Past 2 GiB the ring grows to the exact size: the next power of two does not fit
+                UploadRingAllocator small(1024);
+                expect(small.place(0x90000000u, 16).grow_to == 0x90000000u, "huge upload growth overflowed");
+            }
+        };
+
+        /// @brief Pipeline keys and shader deduplication checked; when a GPU device can be
+        /// created, a few hundred pipeline variants are precompiled and looked up each frame.
+        class PipelineCacheScenario final : public Scenario {
+        public:
+            std::string_view getName() const override { return "pipeline_cache"; }
+            std::string_view getDescription() const override { return "Pipeline keys, shader content dedup and a 200-variant precompile."; }
+
+            void populate(BenchHarness& harness, BenchScene& /*scene*/) override {
+                checkDescriptorKeys();
+                checkShaderContentIndex();
+
+                // Machines without a GPU (or a SPIR-V driver) still run the checks above
+                gpu_device_ = SDL_CreateGPUDevice(SDL_GPU_SHADERFORMAT_SPIRV, false, nullptr);
+                if (!gpu_device_) {
+                    return;
+                }
+
+                resource_manager_ = std::make_unique<engine::resource::ResourceManager>(
+                    harness.getContext().getRenderer().getSDLRenderer(),
+                    gpu_device_
+                );
+                auto vertex_shader = resource_manager_->loadShader(VERTEX_SHADER, SDL_GPU_SHADERSTAGE_VERTEX);
+                auto fragment_shader = resource_manager_->loadShader(FRAGMENT_SHADER, SDL_GPU_SHADERSTAGE_FRAGMENT);
+
+                // The same program under another path must come back as the same shader
+                std::string copy_path = (generatedAssetDir() / "vertex_copy.spv").generic_string();
+                std::error_code error;
+                fs::copy_file(VERTEX_SHADER, copy_path, fs::copy_options::overwrite_existing, error);
+                if (resource_manager_->loadShader(copy_path, SDL_GPU_SHADERSTAGE_VERTEX) != vertex_shader) {
+                    failures_.push_back("a copy of the vertex shader was not deduplicated");
+                }
+
+                variants_ = buildVariants(vertex_shader, fragment_shader);
+                std::uint64_t start_ns = SDL_GetTicksNS();
+                precompiled_ = resource_manager_->precompilePipelines(variants_);
+                precompile_ns_ = SDL_GetTicksNS() - start_ns;
+            }
+
+            void update(BenchHarness& /*harness*/, float /*delta_time*/) override {
+                if (!resource_manager_) {
+                    return;
+                }
+
+                std::uint64_t start_ns = SDL_GetTicksNS();
+                for (const auto& variant : variants_) {
+                    if (!resource_manager_->getPipeline(variant)) {
+                        ++missing_pipelines_;
+                    }
+                }
+                lookup_ns_ += SDL_GetTicksNS() - start_ns;
+                lookups_ += variants_.size();
+            }
+
+            void report(BenchHarness& /*harness*/, nlohmann::ordered_json& metrics) override {
+                metrics["descriptor_keys_checked"] = keys_checked_;
+                metrics["gpu"] = gpu_device_ != nullptr;
+                metrics["variants"] = variants_.size();
+                metrics["precompiled"] = precompiled_;
+                metrics["precompile_ms"] = static_cast<double>(precompile_ns_) / 1000000.0;
+                metrics["us_per_variant"] = precompiled_ > 0 ? static_cast<double>(precompile_ns_) / 1000.0 / static_cast<double>(precompiled_) : 0.0;
+                metrics["ns_per_lookup"] = lookups_ > 0 ? static_cast<double>(lookup_ns_) / static_cast<double>(lookups_) : 0.0;
+
+                // The pipelines and shaders go before the device they were created on
+                resource_manager_.reset();
+                if (gpu_device_) {
+                    SDL_DestroyGPUDevice(gpu_device_);
+                    gpu_device_ = nullptr;
+                }
+            }
+
+            std::string check(BenchHarness& /*harness*/) override {
+                if (missing_pipelines_ > 0) {
+                    failures_.push_back(std::to_string(missing_pipelines_) + " pipeline lookups failed");
+                }
+
+                std::string result;
+                for (const auto& failure : failures_) {
+                    result += (result.empty() ? "" : "; ") + failure;
+                }
+                return result.empty() ? result : result + ".";
+            }
+
+        private:
+            static constexpr const char* VERTEX_SHADER = "assets/shaders/vertex.spv";
+            static constexpr const char* FRAGMENT_SHADER = "assets/shaders/fragment.spv";
+
+            static constexpr std::array COLOR_FORMATS = {
+                SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UNORM,
+                SDL_GPU_TEXTUREFORMAT_B8G8R8A8_UNORM,
+                SDL_GPU_TEXTUREFORMAT_R16G16B16A16_FLOAT,
+                SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UNORM_SRGB,
+                SDL_GPU_TEXTUREFORMAT_B8G8R8A8_UNORM_SRGB,
+            };
+            static constexpr std::array BLEND_MODES = {
+                engine::resource::BlendMode::NONE,
+                engine::resource::BlendMode::ALPHA,
+                engine::resource::BlendMode::ADDITIVE,
+                engine::resource::BlendMode::PREMULTIPLIED,
+            };
+            static constexpr std::array VERTEX_LAYOUTS = {
+                engine::resource::VertexLayout::POSITION_COLOR,
+                engine::resource::VertexLayout::POSITION_COLOR_UV,
+            };
+            static constexpr std::array PRIMITIVE_TYPES = {
+                SDL_GPU_PRIMITIVETYPE_TRIANGLELIST,
+                SDL_GPU_PRIMITIVETYPE_TRIANGLESTRIP,
+                SDL_GPU_PRIMITIVETYPE_LINELIST,
+                SDL_GPU_PRIMITIVETYPE_LINESTRIP,
+                SDL_GPU_PRIMITIVETYPE_POINTLIST,
+            };
+
+            SDL_GPUDevice* gpu_device_ = nullptr;
+            std::unique_ptr<engine::resource::ResourceManager> resource_manager_;
+            std::vector<engine::resource::PipelineDescriptor> variants_;
+            std::vector<std::string> failures_;
+
+            std::size_t keys_checked_ = 0;
+            std::size_t precompiled_ = 0;
+            std::uint64_t precompile_ns_ = 0;
+            std::uint64_t lookup_ns_ = 0;
+            std::uint64_t lookups_ = 0;
+            std::uint64_t missing_pipelines_ = 0;
+
+            static std::vector<engine::resource::PipelineDescriptor> buildVariants(
+                engine::resource::ShaderId vertex_shader,
+                engine::resource::ShaderId fragment_shader
+            ) {
+                std::vector<engine::resource::PipelineDescriptor> variants;
+                for (auto color_format : COLOR_FORMATS) {
+                    for (auto blend_mode : BLEND_MODES) {
+                        for (auto vertex_layout : VERTEX_LAYOUTS) {
+                            for (auto primitive_type : PRIMITIVE_TYPES) {
+                                engine::resource::PipelineDescriptor variant;
+                                variant.vertex_shader = vertex_shader;
+                                variant.fragment_shader = fragment_shader;
+                                variant.color_format = color_format;
+                                variant.blend_mode = blend_mode;
+                                variant.vertex_layout = vertex_layout;
+                                variant.primitive_type = primitive_type;
+                                variants.push_back(variant);
+                            }
+                        }
+                    }
+                }
+                return variants;
+            }
+
+            /// @brief Every variant over a spread of shader ids must pack to its own key, and
+            /// unpack to the same fields.
+            void checkDescriptorKeys() {
+                constexpr std::array<engine::resource::ShaderId, 5> SHADER_IDS = {1, 2, 255, 0x1234, 0xFFFF};
+
+                std::unordered_set<std::uint64_t> keys;
+                std::size_t mismatches = 0;
+                for (auto vertex_shader : SHADER_IDS) {
+                    for (auto fragment_shader : SHADER_IDS) {
+                        for (const auto& variant : buildVariants(vertex_shader, fragment_shader)) {
+                            std::uint64_t key = variant.pack();
+                            keys.insert(key);
+                            ++keys_checked_;
+
+                            auto unpacked = engine::resource::PipelineDescriptor::unpack(key);
+                            if (unpacked.vertex_shader != variant.vertex_shader ||
+                                unpacked.fragment_shader != variant.fragment_shader ||
+                                unpacked.color_format != variant.color_format ||
+                                unpacked.blend_mode != variant.blend_mode ||
+                                unpacked.vertex_layout != variant.vertex_layout ||
+                                unpacked.primitive_type != variant.primitive_type) {
+                                ++mismatches;
+                            }
+                        }
+                    }
+                }
+
+                if (keys.size() != keys_checked_) {
+                    failures_.push_back(std::to_string(keys_checked_ - keys.size()) + " pipeline descriptors share a key");
+                }
+                if (mismatches > 0) {
+                    failures_.push_back(std::to_string(mismatches) + " pipeline keys do not unpack to their descriptor");
+                }
+            }
+
+            /// @brief Identical content is found again; any difference in bytes, stage or
+            /// resources is not, even under the same hash.
+            void checkShaderContentIndex() {
+                using engine::resource::ShaderContentIndex;
+                using engine::resource::INVALID_SHADER;
+
+                std::vector<std::byte> code(256);
+                for (std::size_t i = 0; i < code.size(); ++i) {
+                    code[i] = static_cast<std::byte>(i * 7);
+                }
+                std::vector<std::byte> copy = code;
+                std::vector<std::byte> other = code;
+                other[100] ^= std::byte{1};
+
+                const engine::resource::ShaderResources no_resources;
+                engine::resource::ShaderResources one_sampler;
+                one_sampler.num_samplers = 1;
+
+                ShaderContentIndex index;
+                std::uint64_t hash = ShaderContentIndex::hash(code, SDL_GPU_SHADERSTAGE_VERTEX, no_resources);
+                index.add(hash, code, SDL_GPU_SHADERSTAGE_VERTEX, no_resources, 1);
+
+                auto find = [&index](std::span<const std::byte> content, SDL_GPUShaderStage stage, const engine::resource::ShaderResources& resources) {
+                    return index.find(ShaderContentIndex::hash(content, stage, resources), content, stage, resources);
+                };
+
+                if (find(copy, SDL_GPU_SHADERSTAGE_VERTEX, no_resources) != 1) {
+                    failures_.push_back("identical shader bytes were not deduplicated");
+                }
+                if (find(code, SDL_GPU_SHADERSTAGE_FRAGMENT, no_resources) != INVALID_SHADER ||
+                    find(code, SDL_GPU_SHADERSTAGE_VERTEX, one_sampler) != INVALID_SHADER) {
+                    failures_.push_back("shaders differing in stage or resources were deduplicated");
+                }
+
+                // A colliding hash: the bytes decide
+                if (index.find(hash, other, SDL_GPU_SHADERSTAGE_VERTEX, no_resources) != INVALID_SHADER) {
+                    failures_.push_back("different shader bytes under one hash were deduplicated");
+                }
+                index.add(hash, other, SDL_GPU_SHADERSTAGE_VERTEX, no_resources, 2);
+                if (index.find(hash, other, SDL_GPU_SHADERSTAGE_VERTEX, no_resources) != 2 ||
+                    index.find(hash, code, SDL_GPU_SHADERSTAGE_VERTEX, no_resources) != 1) {
+                    failures_.push_back("shaders sharing a hash were not told apart");
+                }
+            }
+        };
+
+    } // namespace
+
+    std::vector<std::unique_ptr<Scenario>> createScenarios() {
+        std::vector<std::unique_ptr<Scenario>> scenarios;
+        scenarios.push_back(std::make_unique<EmptyScenario>());
+        scenarios.push_back(std::make_unique<TitleSceneScenario>());
+        scenarios.push_back(std::make_unique<SpritesScenario>("sprites", 4000));
+        scenarios.push_back(std::make_unique<SpritesScenario>("sprites_1m", 1000000));
+        scenarios.push_back(std::make_unique<TilemapScenario>());
+        scenarios.push_back(std::make_unique<ParallaxScenario>());
+        scenarios.push_back(std::make_unique<UIButtonsScenario>());
+        scenarios.push_back(std::make_unique<InputScenario>());
+        scenarios.push_back(std::make_unique<InputReplayScenario>());
+        scenarios.push_back(std::make_unique<TextureBudgetScenario>());
+        scenarios.push_back(std::make_unique<AssetPackScenario>());
+        scenarios.push_back(std::make_unique<TextureCacheScenario>());
+        scenarios.push_back(std::make_unique<MixerScenario>());
+        scenarios.push_back(std::make_unique<SoundBusScenario>());
+        scenarios.push_back(std::make_unique<AudioPlayerScenario>());
+        scenarios.push_back(std::make_unique<FrameArenaScenario>());
+        scenarios.push_back(std::make_unique<ObjectChurnScenario>());
+        scenarios.push_back(std::make_unique<SceneChurnScenario>());
+        scenarios.push_back(std::make_unique<SceneCyclingScenario>());
+        scenarios.push_back(std::make_unique<ObjectQueriesScenario>());
+        scenarios.push_back(std::make_unique<PhysicsBroadphaseScenario>());
+        scenarios.push_back(std::make_unique<PhysicsScalingScenario>());
+        scenarios.push_back(std::make_unique<LockstepScenario>());
+        scenarios.push_back(std::make_unique<SceneSnapshotScenario>());
+        scenarios.push_back(std::make_unique<PipelineCacheScenario>());
+        scenarios.push_back(std::make_unique<UploadRingScenario>());
+        return scenarios;
+    }
+
+} // namespace bench